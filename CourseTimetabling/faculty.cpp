@@ -170,9 +170,11 @@ Timetable::Timetable(Faculty *f)
     Allocate(); 
 }
 
+// the timetable is allocated again if the input has changed, or it has
+// been loaded since (e.g., by the batch mode of the tester)
 void Timetable::SetInput(Faculty * f)
 {
-  if (fp != f)
+  if (fp != f || (f != NULL && T.size() != f->Courses()))
     {
       fp = f;
       Allocate(); 
@@ -180,7 +182,7 @@ void Timetable::SetInput(Faculty * f)
 }
 
 void Timetable::Allocate()
-{ T.resize(fp->Courses(), vector<unsigned>(fp->Periods(),0)); }
+{ T.assign(fp->Courses(), vector<unsigned>(fp->Periods(),0)); }
 
 // **************************************************************
 // ********************  FACULTY ********************************
@@ -376,6 +378,36 @@ void Faculty::Load(string dir) throw(CTTException)
 	  conflict[c1][c2] = true;
 	  conflict[c2][c1] = true;
 	}
+
+  SortRooms();
+}
+
+void Faculty::SortRooms()
+{
+  unsigned i, j, c, r;
+
+  // insertion sort, rooms of equal capacity keep the order of the file
+  room_by_capacity.resize(rooms);
+  for (i = 0; i < rooms; i++)
+    {
+      r = i + 1;
+      for (j = i; j > 0 && room_vect[room_by_capacity[j-1]].Capacity() > room_vect[r].Capacity(); j--)
+	room_by_capacity[j] = room_by_capacity[j-1];
+      room_by_capacity[j] = r;
+    }
+
+  capacity_rank.resize(rooms + 1);
+  for (i = 0; i < rooms; i++)
+    capacity_rank[room_by_capacity[i]] = i;
+
+  first_fitting_rank.resize(courses);
+  for (c = 0; c < courses; c++)
+    {
+      i = 0;
+      while (i < rooms && room_vect[room_by_capacity[i]].Capacity() < course_vect[c].Students())
+	i++;
+      first_fitting_rank[c] = i;
+    }
 }
 
 ostream& operator<<(ostream& os, const Faculty& f)
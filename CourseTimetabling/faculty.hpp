@@ -93,13 +93,14 @@ class Faculty
 {
   friend ostream& operator<<(ostream&, const Faculty&);
 public:
+  Faculty() : rooms(0), courses(0), periods(0), periods_per_day(0), groups(0) {} // empty until loaded
   void Load(string instance) throw(CTTException); // reads an instance from file(s)
 
   unsigned Courses() const { return courses; }
   unsigned Rooms() const { return rooms; }
   unsigned Periods() const { return periods; }
   unsigned PeriodsPerDay() const { return periods_per_day; }
-  unsigned Days() const { return periods/periods_per_day; }
+  unsigned Days() const { return periods_per_day > 0 ? periods/periods_per_day : 0; }
 
   bool  Available(unsigned c, unsigned p) const 
   { return availability[c][p]; } // availability matrix access
@@ -109,6 +110,13 @@ public:
   const Room& RoomVector(int i) const { return room_vect[i]; }
   const Period& PeriodVector(int i) const { return period_vect[i]; }
 
+  // rooms in order of increasing capacity (rank 0 is the smallest room)
+  unsigned RoomByCapacity(unsigned k) const { return room_by_capacity[k]; }
+  unsigned CapacityRank(unsigned r) const { return capacity_rank[r]; }
+  // rank of the smallest room that holds all the students of the course
+  // (the rooms of lower rank are too small, Rooms() if none is large enough)
+  unsigned FirstFittingRank(unsigned c) const { return first_fitting_rank[c]; }
+
   const CourseGroup& GroupVector(int i) const { return group_vect[i]; }
 
   unsigned RoomIndex(string) const throw(CTTException); 
@@ -135,8 +143,14 @@ protected:
   // course groups
   vector<CourseGroup> group_vect;
 
+  // rooms sorted by capacity
+  vector<unsigned> room_by_capacity; // rank -> room
+  vector<unsigned> capacity_rank;    // room -> rank (location 0 not used)
+  vector<unsigned> first_fitting_rank;
+
   // auxiliary functions
   const char* CreatePath(const string& file_name) const;
+  void SortRooms();
 };
 
 class Timetable
@@ -9,9 +9,30 @@ extern AbstractTester* main_tester;
 
 int main(int argc, char** argv)
 {
+  // course_tt [-s <snapshot file>] [-c <control file>] [<experiments>]
+  // (without experiments, the tester runs its interactive menu); for 
+  // the batch mode, the files can also follow the experiments:
+  // course_tt <experiments> [<snapshot file> [<control file>]]
+  string snapshot_file, control_file;
+  int opt;
+  while ((opt = getopt(argc, argv, "s:c:")) != -1)
+    if (opt == 's')
+      snapshot_file = optarg;
+    else if (opt == 'c')
+      control_file = optarg;
+    else
+      {
+	cerr << "Usage: " << argv[0] << " [-s <snapshot file>] [-c <control file>] [<experiments>]" << endl;
+	exit(-1);
+      }
+  bool interactive = optind == argc;
+  if (optind + 1 < argc)
+    snapshot_file = argv[optind + 1];
+  if (optind + 2 < argc)
+    control_file = argv[optind + 2];
 
   Faculty in; 
-  if (argc == 1)
+  if (interactive)
     {
       char term;
       string data_dir = "Data"; 
@@ -34,6 +55,7 @@ int main(int argc, char** argv)
 	  exit(-1);
 	}
       cout << "Load data of term " << term << " (done)" << endl;
+      assert(in.PeriodsPerDay() == 6);
     }
 
   Timetable out(&in);
@@ -44,6 +66,9 @@ int main(int argc, char** argv)
   TT_TimeNeighborhoodExplorer tnhe(&sm,&in);
   TT_RoomTabuListManager rtlm;
   TT_RoomNeighborhoodExplorer rnhe(&sm,&in);
+  TT_TimeRoomNeighborhoodExplorer trnhe(&sm,&tnhe,&rnhe,&in);
+  TT_TimeFrequencyManager tfm(&in,HARD_WEIGHT/100);
+  TT_RoomFrequencyManager rfm(&in,HARD_WEIGHT/100);
   TT_OutputManager om(&sm,&in);
 #ifdef NO_MINI
   TT_TimeRoomKicker trk(&tnhe,&rnhe);
@@ -52,17 +77,48 @@ int main(int argc, char** argv)
    // runners 
   TT_TimeHillClimbing thc(&sm,&tnhe,&in); 
   TT_TimeTabuSearch tts(&sm,&tnhe,&ttlm,&in);
+  tts.SetFrequencyManager(&tfm);
 
   TT_RoomHillClimbing rhc(&sm,&rnhe,&in); 
   TT_RoomTabuSearch rts(&sm,&rnhe,&rtlm,&in);
+  rts.SetFrequencyManager(&rfm);
+
+  TT_TimeReactiveTabuSearch trts(&sm,&tnhe,&ttlm,&in);
+  TT_RoomReactiveTabuSearch rrts(&sm,&rnhe,&rtlm,&in);
+#ifdef TENURE_LOG
+  ofstream tenure_log("tenure.log"); // tenure trajectory of the reactive runners
+  trts.SetTenureLogStream(&tenure_log);
+  rrts.SetTenureLogStream(&tenure_log);
+#endif
+
+  TT_TimeSimulatedAnnealing tsa(&sm,&tnhe,&in);
+  TT_RoomSimulatedAnnealing rsa(&sm,&rnhe,&in);
+  TT_TimeRoomSimulatedAnnealing trsa(&sm,&trnhe,&in);
+  TT_TimeLateAcceptance tla(&sm,&tnhe,&in);
+  TT_RoomLateAcceptance rla(&sm,&rnhe,&in);
+  TT_TimeRoomLateAcceptance trla(&sm,&trnhe,&in);
+  TT_TimeGreatDeluge tgd(&sm,&tnhe,&in);
+  TT_RoomGreatDeluge rgd(&sm,&rnhe,&in);
+  TT_TimeRoomGreatDeluge trgd(&sm,&trnhe,&in);
+  TT_TimeParallelTempering tpt(&sm,&tnhe,&in);
+  TT_RoomParallelTempering rpt(&sm,&rnhe,&in);
+  TT_TimeRoomParallelTempering trpt(&sm,&trnhe,&in);
+  TT_RoomMatching rm(&sm,&rnhe,&in);
 
    // solvers
   TT_TokenRingSolver trs(&sm,&om,&in,&out);
+  TT_IteratedLocalSearch ils(&sm,&om,&trnhe,&in,&out);
+  TT_VariableNeighborhoodSearch vns(&sm,&om,&tnhe,&rnhe,&in,&out);
+  TT_LargeNeighborhoodSearch lns(&sm,&om,&in,&out);
+  TT_ConcurrentComparativeSolver ccs(&sm,&om,&in,&out);
+  TT_IslandModelSolver ims(&sm,&om,&in,&out);
+  TT_ProcessPoolSolver pps(&sm,&om,&in,&out);
 
    // testers
   StateTester<Faculty,Timetable,TT_State> state_test(&sm,&om,&in);
   MoveTester<Faculty,Timetable,TT_State,TT_MoveTime> time_move_test(&sm,&om,&tnhe,"Change Time",&in);
   MoveTester<Faculty,Timetable,TT_State,TT_MoveRoom> room_move_test(&sm,&om,&rnhe,"Change Room",&in);
+  MoveTester<Faculty,Timetable,TT_State,TT_MoveTimeRoom> time_room_move_test(&sm,&om,&trnhe,"Change Time/Room",&in);
 #ifdef NO_MINI
   BimodalKickTester<Faculty,Timetable,TT_State,TT_MoveTime,TT_MoveRoom> time_room_kick_test(&sm,&om,&trk,"Kick Time/Room",&in);
 #endif
@@ -72,6 +128,7 @@ int main(int argc, char** argv)
   tester.SetStateTester(&state_test);
   tester.AddMoveTester(&time_move_test);
   tester.AddMoveTester(&room_move_test);
+  tester.AddMoveTester(&time_room_move_test);
 #ifdef NO_MINI
   tester.AddMoveTester(&time_room_kick_test);
 #endif
@@ -80,17 +137,76 @@ int main(int argc, char** argv)
   tester.AddRunner(&tts);
   tester.AddRunner(&rhc); 
   tester.AddRunner(&rts);
+  tester.AddRunner(&trts);
+  tester.AddRunner(&rrts);
+  tester.AddRunner(&tsa);
+  tester.AddRunner(&rsa);
+  tester.AddRunner(&trsa);
+  tester.AddRunner(&tla);
+  tester.AddRunner(&rla);
+  tester.AddRunner(&trla);
+  tester.AddRunner(&tgd);
+  tester.AddRunner(&rgd);
+  tester.AddRunner(&trgd);
+  tester.AddRunner(&tpt);
+  tester.AddRunner(&rpt);
+  tester.AddRunner(&trpt);
+  tester.AddRunner(&rm);
 
   tester.SetSolver(&trs);
+  // the other solvers, selected by "Solver:" in the batch file
+  tester.AddSolver(&ils,"iterated local search");
+  tester.AddRunnerSet(&ils);
+  tester.AddSolver(&vns,"variable neighborhood search");
+  tester.AddSolver(&lns,"large neighborhood search");
+  // each runner of the portfolio comes from a different set
+  tester.AddSolver(&ccs,"concurrent comparative");
+  for (unsigned i = 0; i < ccs.RunnerSets(); i++)
+    tester.AddRunnerSet(&ccs,ccs.Runners(i));
+  // each island runs all the runners of the experiment
+  tester.AddSolver(&ims,"island model");
+  for (unsigned i = 0; i < ims.NumberOfIslands(); i++)
+    tester.AddRunnerSet(ims.IslandSolver(i),ims.IslandSolver(i)->Runners());
+  // the token ring on several processes ("Processes:" in the batch file)
+  tester.SetProcessPool(&pps);
+  tester.AddRunnerSet(pps.Worker(),pps.Worker()->Runners());
   tester.SetInput(&in);
 
-  main_tester = &tester;
+  // workers of the parallel multi-start ("Workers:" in the batch file),
+  // one per processor
+  long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+  vector<TT_TokenRingWorker*> workers(cpus > 1 ? cpus : 1);
+  for (unsigned i = 0; i < workers.size(); i++)
+    {
+      workers[i] = new TT_TokenRingWorker(&sm,&om,&in);
+      tester.AddWorker(workers[i],workers[i]->Runners());
+    }
 
+  main_tester = &tester;
 
-  assert(in.PeriodsPerDay() == 6);
+  // SIGINT/SIGTERM (or a change of the control file) stops the search,
+  // which still delivers its best timetable; the best timetables can 
+  // also be written to the snapshot file while the search runs
+  StopRequest::InstallHandlers();
+  SnapshotWriter<Faculty,Timetable,TT_State> snapshot(&om,&in,snapshot_file);
+  if (snapshot_file != "")
+    {
+      trs.SetSnapshotWriter(&snapshot);
+      ils.SetSnapshotWriter(&snapshot);
+      vns.SetSnapshotWriter(&snapshot);
+      lns.SetSnapshotWriter(&snapshot);
+      ccs.SetSnapshotWriter(&snapshot);
+      ims.SetSnapshotWriter(&snapshot);
+      pps.SetSnapshotWriter(&snapshot);
+    }
+  if (control_file != "")
+    StopRequest::WatchFile(control_file);
 
-  if (argc == 1)
+  if (interactive)
     tester.RunMainMenu();
   else
-    tester.ProcessBatch(argv[1]);
+    tester.ProcessBatch(argv[optind]);
+  StopRequest::StopWatching();
+  for (unsigned i = 0; i < workers.size(); i++)
+    delete workers[i];
 }
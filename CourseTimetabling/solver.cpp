@@ -1,12 +1,72 @@
 // File solver.cpp
 #include "solver.hpp"
+#include <algorithm>
+#include <limits>
+#include <unistd.h>
 
 void TT_State::Allocate()
 {
   Timetable::Allocate();
-  room_lectures.resize(fp->Rooms() + 1, vector<unsigned>(fp->Periods()));
-  course_daily_lectures.resize(fp->Courses(), vector<unsigned>(fp->Days()));
+  room_lectures.assign(fp->Rooms() + 1, vector<unsigned>(fp->Periods()));
+  course_daily_lectures.assign(fp->Courses(), vector<unsigned>(fp->Days()));
   working_days.resize(fp->Courses());	
+  free_rooms.assign(fp->Periods(), vector<unsigned long>((fp->Rooms() + ROOM_WORD_BITS - 1) / ROOM_WORD_BITS));
+  period_order.assign(fp->Courses(), vector<unsigned>(fp->Periods()));
+  period_position.assign(fp->Courses(), vector<unsigned>(fp->Periods()));
+  open_periods.resize(fp->Courses());
+  first_lecture.resize(fp->Courses() + 1);
+}
+
+// builds the lecture index (see LectureCourse and OpenPeriod) from the 
+// timetable matrix
+void TT_State::IndexLectures()
+{
+  unsigned i, j, k;
+
+  lecture_course.clear();
+  for (i = 0; i < fp->Courses(); i++)
+    {
+      first_lecture[i] = lecture_course.size();
+      k = 0;
+      for (j = 0; j < fp->Periods(); j++)
+	if (T[i][j] != 0)
+	  {
+	    period_order[i][k++] = j;
+	    lecture_course.push_back(i);
+	  }
+      open_periods[i] = k;
+      for (j = 0; j < fp->Periods(); j++)
+	if (T[i][j] == 0 && fp->Available(i,j))
+	  period_order[i][k++] = j;
+      open_periods[i] = k - open_periods[i];
+      for (j = 0; j < fp->Periods(); j++)
+	if (T[i][j] == 0 && !fp->Available(i,j))
+	  period_order[i][k++] = j;
+      for (k = 0; k < fp->Periods(); k++)
+	period_position[i][period_order[i][k]] = k;
+    }
+  first_lecture[fp->Courses()] = lecture_course.size();
+}
+
+// the lecture of course i moves from period from to the free period 
+// to: the two periods exchange their places, then the vacated one is 
+// moved to the open or to the other periods, if needed
+void TT_State::MoveLecture(unsigned i, unsigned from, unsigned to)
+{
+  unsigned k = period_position[i][to];
+  unsigned open_end = CourseLectures(i) + open_periods[i];
+
+  SwapPeriods(i,period_position[i][from],k);
+  if (k < open_end && !fp->Available(i,from))
+    {
+      SwapPeriods(i,k,open_end - 1);
+      open_periods[i]--;
+    }
+  else if (k >= open_end && fp->Available(i,from))
+    {
+      SwapPeriods(i,k,open_end);
+      open_periods[i]++;
+    }
 }
 
 ostream& operator<<(ostream& os, const TT_State& as)
@@ -130,6 +190,44 @@ ostream& operator<<(ostream& os, const TT_MoveRoom& c)
 	    << ']' << c.old_room << "->" << c.new_room;
 }
 
+TT_MoveTimeRoom::TT_MoveTimeRoom()
+{
+  time = true;
+}
+
+bool TT_MoveTimeRoom::operator==(const TT_MoveTimeRoom& c) const
+{
+  if (time != c.time)
+    return false;
+  return time ? time_move == c.time_move : room_move == c.room_move;
+}
+
+bool TT_MoveTimeRoom::operator!=(const TT_MoveTimeRoom& c) const
+{
+  return !(*this == c);
+}
+
+// the two kinds of move are told apart by their format
+istream& operator>>(istream& is, TT_MoveTimeRoom& c)
+{
+  char ch; 
+  is >> ch;
+  is.putback(ch);
+  c.time = (ch != '[');
+  if (c.time)
+    return is >> c.time_move;
+  else
+    return is >> c.room_move;
+}
+
+ostream& operator<<(ostream& os, const TT_MoveTimeRoom& c)
+{
+  if (c.time)
+    return os << c.time_move;
+  else
+    return os << c.room_move;
+}
+
 // ***************************************************************************
 //                               Helpers
 // ***************************************************************************
@@ -142,7 +240,8 @@ TT_StateManager::TT_StateManager(Faculty* pin)
 
 
 // initial state builder (random rooms)
-void TT_StateManager::RandomState(TT_State& as) 
+template <class Generator>
+void TT_StateManager::BuildRandomState(TT_State& as, Generator& rng) 
 {
   ResetState(as); // make all elements of as equal to 0
   for (unsigned c = 0; c < p_in->Courses(); c++)
@@ -152,14 +251,145 @@ void TT_StateManager::RandomState(TT_State& as)
 	{
 	  unsigned p;
 	  do // cycle until the period is free and available
-	    p = Random(0,p_in->Periods()-1);
+	    p = rng.Uniform(0,p_in->Periods()-1);
 	  while (as(c,p) != 0 || !p_in->Available(c,p));
-	  as(c,p) = Random(1,p_in->Rooms());
+	  as(c,p) = rng.Uniform(1,p_in->Rooms());
 	}
     }
   UpdateRedundantStateData(as);
 } 
 
+// initial state builder (DSATUR graph coloring): the lectures are the
+// vertices, the periods are the colors, and the rooms are assigned by
+// best fit
+template <class Generator>
+void TT_StateManager::BuildGreedyState(TT_State& as, Generator& rng) 
+{
+  unsigned c, c2, p, k, r, best_c = 0, best_p = 0, best_r;
+  const unsigned courses = p_in->Courses(), periods = p_in->Periods();
+  // lectures of the conflicting courses (and of the course itself) in
+  // each period
+  vector<vector<unsigned> > clashes(courses, vector<unsigned>(periods, 0));
+  vector<vector<bool> > room_used(p_in->Rooms() + 1, vector<bool>(periods, false));
+  vector<vector<unsigned> > daily(courses, vector<unsigned>(p_in->Days(), 0));
+  vector<unsigned> unplaced(courses), degree(courses, 0);
+  unsigned lectures = 0;
+
+  ResetState(as);
+  for (c = 0; c < courses; c++)
+    {
+      unplaced[c] = p_in->CourseVector(c).Lectures();
+      lectures += unplaced[c];
+      for (c2 = 0; c2 < courses; c2++)
+	if (c2 != c && p_in->Conflict(c,c2))
+	  degree[c] += p_in->CourseVector(c2).Lectures();
+    }
+
+  while (lectures > 0)
+    {
+      // the lecture with the highest saturation (number of periods
+      // already forbidden), ties broken by degree and then at random
+      int best_saturation = -1;
+      unsigned ties = 0;
+      for (c = 0; c < courses; c++)
+	if (unplaced[c] > 0)
+	  {
+	    int saturation = 0;
+	    for (p = 0; p < periods; p++)
+	      if (clashes[c][p] > 0 || !p_in->Available(c,p))
+		saturation++;
+	    if (saturation > best_saturation 
+		|| (saturation == best_saturation && degree[c] > degree[best_c]))
+	      {
+		best_saturation = saturation;
+		best_c = c;
+		ties = 1;
+	      }
+	    else if (saturation == best_saturation && degree[c] == degree[best_c]
+		     && rng.Uniform(0,ties++) == 0)
+	      best_c = c;
+	  }
+      c = best_c;
+
+      // the period with the fewest clashes and a free room, preferring
+      // the days in which the course has no lecture yet; if the course 
+      // is not available in any of its free periods, the lecture goes
+      // to the least bad of them anyway
+      unsigned best_score = UINT_MAX;
+      ties = 0;
+      for (unsigned pass = 0; pass < 2 && best_score == UINT_MAX; pass++)
+	for (p = 0; p < periods; p++)
+	  {
+	    if (as(c,p) != 0 || (pass == 0 && !p_in->Available(c,p)))
+	      continue;
+	    unsigned score = HARD_WEIGHT * clashes[c][p];
+	    for (r = 1; r <= p_in->Rooms() && room_used[r][p]; r++)
+	      ;
+	    if (r > p_in->Rooms())
+	      score += HARD_WEIGHT;
+	    if (daily[c][p / p_in->PeriodsPerDay()] > 0)
+	      score++;
+	    if (score < best_score)
+	      {
+		best_score = score;
+		best_p = p;
+		ties = 1;
+	      }
+	    else if (score == best_score && rng.Uniform(0,ties++) == 0)
+	      best_p = p;
+	  }
+      assert(best_score < UINT_MAX); // more lectures than periods
+      p = best_p;
+
+      // the smallest free room that fits, otherwise the largest free room
+      best_r = 0;
+      for (k = p_in->FirstFittingRank(c); k < p_in->Rooms(); k++)
+	if (!room_used[p_in->RoomByCapacity(k)][p])
+	  {
+	    best_r = p_in->RoomByCapacity(k);
+	    break;
+	  }
+      for (k = p_in->FirstFittingRank(c); best_r == 0 && k > 0; k--)
+	if (!room_used[p_in->RoomByCapacity(k - 1)][p])
+	  best_r = p_in->RoomByCapacity(k - 1);
+      if (best_r == 0)
+	best_r = p_in->RoomByCapacity(p_in->Rooms() - 1);
+
+      as(c,p) = best_r;
+      room_used[best_r][p] = true;
+      daily[c][p / p_in->PeriodsPerDay()]++;
+      clashes[c][p]++;
+      for (c2 = 0; c2 < courses; c2++)
+	if (c2 != c && p_in->Conflict(c,c2))
+	  clashes[c2][p]++;
+      unplaced[c]--;
+      lectures--;
+    }
+  UpdateRedundantStateData(as);
+} 
+
+void TT_StateManager::RandomState(TT_State& as) 
+{
+  StandardRandom rng;
+  BuildRandomState(as,rng);
+}
+
+void TT_StateManager::GreedyState(TT_State& as) 
+{
+  StandardRandom rng;
+  BuildGreedyState(as,rng);
+}
+
+void TT_StateManager::RandomState(TT_State& as, FastRandom& rng) 
+{
+  BuildRandomState(as,rng);
+}
+
+void TT_StateManager::GreedyState(TT_State& as, FastRandom& rng) 
+{
+  BuildGreedyState(as,rng);
+}
+
 void TT_StateManager::ResetState(TT_State& as)
 {
   for (unsigned c = 0; c < p_in->Courses(); c++)
@@ -167,7 +397,7 @@ void TT_StateManager::ResetState(TT_State& as)
       as(c,p) = 0;
 }
 
-void TT_StateManager::UpdateRedundantStateData(TT_State& as) const
+void TT_StateManager::UpdateRedundantStateData(TT_State& as)
 {
   unsigned p, c, r, d;
   
@@ -175,13 +405,17 @@ void TT_StateManager::UpdateRedundantStateData(TT_State& as) const
     for (p = 0; p < p_in->Periods(); p++)
       as.ResetRoomLectures(r,p);
 
+  as.ResetHash();
   for (c = 0; c < p_in->Courses(); c++)
     {
       for (p = 0; p < p_in->Periods(); p++)
 	{
 	  r = as(c,p);
 	  if (r != 0)
-	    as.IncRoomLectures(r,p);
+	    {
+	      as.IncRoomLectures(r,p);
+	      as.ToggleHash(c,p,r);
+	    }
 	}
     }
 
@@ -201,6 +435,7 @@ void TT_StateManager::UpdateRedundantStateData(TT_State& as) const
 	  as.IncWorkingDays(c);
       }
     }
+  as.IndexLectures();
 } 
 
 // cost function components
@@ -216,6 +451,12 @@ fvalue TT_StateManager::Objective(const TT_State& as) const
   return RoomCapacity(as) + MinWorkingDays(as);
 } 
 
+// the hash is kept up to date by the moves (see TT_State::Hash)
+unsigned long TT_StateManager::StateHash(const TT_State& as) const 
+{
+  return as.Hash();
+} 
+
 unsigned TT_StateManager::Conflitcs(const TT_State& as) const
 {
   unsigned c1, c2, p, cost = 0;
@@ -314,31 +555,22 @@ bool TT_OutputManager::GroupLecture(const Timetable & tt, unsigned g, unsigned p
 // constructor
 TT_TimeNeighborhoodExplorer::TT_TimeNeighborhoodExplorer(StateManager<Faculty,TT_State>* psm, 
 							   Faculty* pin)
-  : NeighborhoodExplorer<Faculty,TT_State,TT_MoveTime>(psm, pin) 
+  : StaticNeighborhoodExplorer<Faculty,TT_State,TT_MoveTime,
+			       TT_TimeNeighborhoodExplorer,TT_TimeTabuListManager>(psm, pin) 
 {} 
 
 // initial move builder
 void TT_TimeNeighborhoodExplorer::RandomMove(const TT_State& as, TT_MoveTime& mv) 
 {
-  do 
-    AnyRandomMove(as,mv);
-  while (!FeasibleMove(as,mv));
+  StandardRandom rng;
+  RandomMove(as,mv,rng);
 }
 
-// initial move builder
-void TT_TimeNeighborhoodExplorer::AnyRandomMove(const TT_State& as, TT_MoveTime& mv) 
-{
-  mv.course = Random(0,p_in->Courses() - 1);
-  mv.from = Random(0,p_in->Periods() - 1);
-  mv.to = Random(0,p_in->Periods() - 1);
-} 
-
 // check move feasibility
 bool TT_TimeNeighborhoodExplorer::FeasibleMove(const TT_State& as, const TT_MoveTime& mv) 
 {
   return  as(mv.course,mv.from) != 0 
-    && as(mv.course,mv.to) == 0
-    && !p_in->Available(mv.course,mv.to);
+    && FreePeriod(as,mv.course,mv.to);
 } 
 
 // update the state according to the move 
@@ -354,6 +586,9 @@ void TT_TimeNeighborhoodExplorer::MakeMove(TT_State& as, const TT_MoveTime& mv)
   unsigned to_day= mv.to / p_in->PeriodsPerDay();
   as.DecRoomLectures(room,mv.from);
   as.IncRoomLectures(room,mv.to);
+  as.MoveLecture(mv.course,mv.from,mv.to);
+  as.ToggleHash(mv.course,mv.from,room);
+  as.ToggleHash(mv.course,mv.to,room);
 
   if (from_day != to_day)
     {
@@ -405,6 +640,16 @@ fvalue TT_TimeNeighborhoodExplorer::DeltaObjective(const TT_State& as, const TT_
   return DeltaMinWorkingDays(as,mv);
 } 
 
+// batch evaluation: the components are called directly, without
+// going through the virtual DeltaCostFunction, and weighted as it does
+void TT_TimeNeighborhoodExplorer::BatchDeltaCostFunction(const TT_State& as, const TT_MoveTime mv[], 
+							 unsigned n, fvalue delta[])
+{
+  for (unsigned i = 0; i < n; i++)
+    delta[i] = WeightedCost(TT_TimeNeighborhoodExplorer::DeltaViolations(as,mv[i]),
+			    TT_TimeNeighborhoodExplorer::DeltaObjective(as,mv[i]));
+}
+
 int TT_TimeNeighborhoodExplorer::DeltaConflitcs(const TT_State& as, const TT_MoveTime& mv) const
 {
   unsigned c;
@@ -457,13 +702,194 @@ int TT_TimeNeighborhoodExplorer::DeltaMinWorkingDays(const TT_State& as,
 }
 
 
+// exploration of the whole neighborhood: the moves of a lecture (c,from)
+// differ only in the destination period, so their deltas are computed
+// together, one row at a time, from period-indexed counters
+
+fvalue TT_TimeNeighborhoodExplorer::BestMove(const TT_State& as, TT_MoveTime& mv) 
+{
+  return ScanRows(as,mv,false,0,0);
+}
+
+fvalue TT_TimeNeighborhoodExplorer::BestNonProhibitedMove(const TT_State& as, TT_MoveTime& mv, 
+							  fvalue curr, fvalue best) 
+{
+  return ScanRows(as,mv,true,curr,best);
+}
+
+void TT_TimeNeighborhoodExplorer::DeltaCostRow(const TT_State& as, unsigned c, 
+					       unsigned from, vector<int>& delta) 
+{
+  ComputePeriodConflicts(as,c);
+  RowDeltas(as,c,from,delta);
+}
+
+// number of lectures of courses in conflict with c, for each period
+void TT_TimeNeighborhoodExplorer::ComputePeriodConflicts(const TT_State& as, unsigned c) 
+{
+  unsigned c2, p, periods = p_in->Periods();
+
+  period_conflicts.assign(periods,0);
+  for (c2 = 0; c2 < p_in->Courses(); c2++)
+    if (c2 != c && p_in->Conflict(c,c2))
+      for (p = 0; p < periods; p++)
+	period_conflicts[p] += as(c2,p) != 0;
+}
+
+// delta[to] is the cost of the move c:from->to (meaningful only for 
+// the periods that are free for the course); it requires the 
+// period_conflicts of the course c
+void TT_TimeNeighborhoodExplorer::RowDeltas(const TT_State& as, unsigned c, 
+					    unsigned from, vector<int>& delta) const
+{
+  unsigned p, d, periods = p_in->Periods(), ppd = p_in->PeriodsPerDay();
+  unsigned room = as(c,from), from_day = from / ppd;
+  unsigned working_days = as.WorkingDays(c);
+  unsigned min_working_days = p_in->CourseVector(c).MinWorkingDays();
+  unsigned from_lectures = as.CourseDailyLectures(c,from_day);
+  int leave, day_delta;
+
+  delta.resize(periods);
+
+  // violations (as DeltaConflitcs and DeltaRoomOccupation)
+  leave = period_conflicts[from] + (as.RoomLectures(room,from) > 1);
+  for (p = 0; p < periods; p++)
+    delta[p] = HARD_WEIGHT * (period_conflicts[p] 
+			      + (as.RoomLectures(room,p) > 0) - leave);
+
+  // objective (as DeltaMinWorkingDays), it depends only on the day
+  for (d = 0; d < p_in->Days(); d++)
+    {
+      if (d == from_day)
+	continue;
+      day_delta = 0;
+      if (working_days <= min_working_days && from_lectures == 1
+	  && as.CourseDailyLectures(c,d) >= 1)
+	day_delta = 1;
+      else if (working_days < min_working_days && from_lectures > 1
+	       && as.CourseDailyLectures(c,d) == 0)
+	day_delta = -1;
+      if (day_delta != 0)
+	for (p = d * ppd; p < (d+1) * ppd; p++)
+	  delta[p] += day_delta;
+    }
+}
+
+// visits the moves in the same order of NextMove, starting from a
+// random one, and selects the best (non prohibited) one; ties are
+// broken in favour of the first move found, as in the generic 
+// exploration (the non prohibited moves are compared on their value, 
+// i.e. the cost plus the penalty of the diversification phase)
+fvalue TT_TimeNeighborhoodExplorer::ScanRows(const TT_State& as, TT_MoveTime& mv, 
+					     bool prohibition, fvalue curr, fvalue best) 
+{
+  unsigned periods = p_in->Periods(), rows = p_in->Courses() * periods;
+  unsigned r, first_to, last_to, row_course = p_in->Courses();
+  fvalue mv_cost, mv_value, best_delta = 0, best_value = 0;
+  bool tabu_move, all_moves_tabu = true, first_move = true;
+  bool diversify = prohibition && Diversifying();
+  TT_MoveTime start;
+
+  FirstMove(as,mv);
+  start = mv;
+  best_move = mv;
+
+  // the row of the start move is visited twice: first from the start
+  // move on, at the end up to the start move
+  for (r = 0; r <= rows; r++)
+    {
+      unsigned row = (start.course * periods + start.from + r) % rows;
+      mv.course = row / periods;
+      mv.from = row % periods;
+      if (as(mv.course,mv.from) == 0)
+	continue;
+      if (mv.course != row_course)
+	{
+	  ComputePeriodConflicts(as,mv.course);
+	  row_course = mv.course;
+	}
+      RowDeltas(as,mv.course,mv.from,row_delta);
+
+      first_to = (r == 0) ? start.to : 0;
+      last_to = (r == rows) ? start.to : periods;
+      for (mv.to = first_to; mv.to < last_to; mv.to++)
+	{
+	  if (!FreePeriod(as,mv.course,mv.to))
+	    continue;
+	  mv_cost = row_delta[mv.to];
+	  mv_value = diversify ? mv_cost + p_fm->Penalty(mv) : mv_cost;
+	  if (first_move)
+	    {
+	      best_delta = mv_cost;
+	      best_value = mv_value;
+	      first_move = false;
+	    }
+	  if (!prohibition)
+	    {
+	      if (mv_cost < best_delta)
+		{
+		  best_move = mv;
+		  best_delta = mv_cost;
+		}
+	      continue;
+	    }
+	  // once a non prohibited move has been found, only the
+	  // improving ones need the (costly) prohibition test
+	  if (!all_moves_tabu && mv_value >= best_value)
+	    continue;
+	  tabu_move = Prohibited(mv,mv_cost,curr,best);
+	  if (   (mv_value < best_value && !tabu_move)
+		 || (mv_value < best_value && all_moves_tabu)
+		 || (all_moves_tabu && !tabu_move))
+	    {
+	      best_move = mv;
+	      best_delta = mv_cost;
+	      best_value = mv_value;
+	    }
+	  if (!tabu_move)
+	    all_moves_tabu = false;
+	}
+    }
+  mv = best_move;
+  return best_delta;
+}
+
 /*****************************************************************************
  * Time Tabu List Manager Methods
  *****************************************************************************/
 
+// The prohibitions of both tabu list managers are kept in tables indexed
+// by (course, period), in place of the list of moves. An entry holds the
+// iteration counter (plus one) at which the prohibition expires, so that
+// insertion, membership and expiry take constant time. The tables grow
+// on demand, since the managers do not know the size of the input.
+
+static void Prohibit(vector<vector<unsigned long> >& table, unsigned c, unsigned p, 
+		     unsigned long until)
+{
+  if (c >= table.size())
+    table.resize(c + 1);
+  if (p >= table[c].size())
+    table[c].resize(p + 1, 0);
+  if (table[c][p] < until)
+    table[c][p] = until;
+}
+
+static inline unsigned long ProhibitedUntil(const vector<vector<unsigned long> >& table, 
+					    unsigned c, unsigned p)
+{
+  return c < table.size() && p < table[c].size() ? table[c][p] : 0;
+}
+
+static void ClearProhibitions(vector<vector<unsigned long> >& table)
+{
+  for (unsigned c = 0; c < table.size(); c++)
+    table[c].assign(table[c].size(), 0);
+}
+
 // constructor
 TT_TimeTabuListManager::TT_TimeTabuListManager(int min, int max)
-  : TabuListManager<TT_MoveTime>(min,max) 
+  : StaticTabuListManager<TT_MoveTime,TT_TimeTabuListManager>(min,max) 
 {}
 
 // the inverse move definition
@@ -472,6 +898,64 @@ bool TT_TimeTabuListManager::Inverse(const TT_MoveTime& m1, const TT_MoveTime& m
   return m1.course == m2.course && (m1.from == m2.to || m2.from == m1.to); 
 } 
 
+// a move is tabu if it is the inverse of a tabu one (see Inverse), i.e. 
+// if it takes a lecture away from a period where a tabu move placed one
+// or it brings a lecture into a period that a tabu move has vacated
+bool TT_TimeTabuListManager::ListMember(const TT_MoveTime& mv) const 
+{
+  return ProhibitedUntil(placed,mv.course,mv.from) > iter
+    || ProhibitedUntil(vacated,mv.course,mv.to) > iter;
+}
+
+void TT_TimeTabuListManager::InsertIntoList(const TT_MoveTime& mv) 
+{
+  unsigned long until = iter + Random(min_tenure,max_tenure) + 1;
+  Prohibit(placed,mv.course,mv.to,until);
+  Prohibit(vacated,mv.course,mv.from,until);
+  iter++;
+}
+
+void TT_TimeTabuListManager::Clean() 
+{
+  StaticTabuListManager<TT_MoveTime,TT_TimeTabuListManager>::Clean();
+  ClearProhibitions(placed);
+  ClearProhibitions(vacated);
+}
+
+/*****************************************************************************
+ * Time Frequency Manager Methods
+ *****************************************************************************/
+
+// The frequencies of both managers are the number of moves that have
+// brought a lecture of a course into a period (or a room); they are kept
+// in flat tables, indexed by course and period (or room), that are sized
+// at the beginning of each run. The penalty of a move is the weight
+// times the fraction of the recorded moves that have taken its attribute.
+
+// constructor
+TT_TimeFrequencyManager::TT_TimeFrequencyManager(Faculty* pin, fvalue w)
+  : p_in(pin), weight(w), moves(0)
+{}
+
+void TT_TimeFrequencyManager::InsertMove(const TT_MoveTime& mv) 
+{
+  frequency[mv.course * p_in->Periods() + mv.to]++;
+  moves++;
+}
+
+fvalue TT_TimeFrequencyManager::Penalty(const TT_MoveTime& mv) const 
+{
+  if (moves == 0)
+    return 0;
+  return weight * frequency[mv.course * p_in->Periods() + mv.to] / moves;
+}
+
+void TT_TimeFrequencyManager::Clean() 
+{
+  frequency.assign(p_in->Courses() * p_in->Periods(),0);
+  moves = 0;
+}
+
 /*****************************************************************************
  * Room Neighborhood Explorer Methods
  *****************************************************************************/
@@ -479,27 +963,20 @@ bool TT_TimeTabuListManager::Inverse(const TT_MoveTime& m1, const TT_MoveTime& m
 // constructor
 TT_RoomNeighborhoodExplorer::TT_RoomNeighborhoodExplorer(StateManager<Faculty,TT_State>* psm, 
 							   Faculty* pin)
-  : NeighborhoodExplorer<Faculty,TT_State,TT_MoveRoom>(psm, pin) 
+  : StaticNeighborhoodExplorer<Faculty,TT_State,TT_MoveRoom,
+			       TT_RoomNeighborhoodExplorer,TT_RoomTabuListManager>(psm, pin) 
 {} 
 
 // initial move builder
 void TT_RoomNeighborhoodExplorer::RandomMove(const TT_State& as, TT_MoveRoom& mv) 
 {
-  mv.course = Random(0,p_in->Courses() - 1);
-
-  do 
-    mv.period = Random(0,p_in->Periods() - 1);
-  while (as(mv.course,mv.period) == 0);
-  mv.old_room = as(mv.course,mv.period);
-  
-  do 
-    mv.new_room = Random(1,p_in->Rooms());
-  while (mv.new_room == mv.old_room);
+  StandardRandom rng;
+  RandomMove(as,mv,rng);
 } 
 
 bool TT_RoomNeighborhoodExplorer::FeasibleMove(const TT_State& as, const TT_MoveRoom& mv) 
 {
-  return as(mv.course,mv.period) == mv.old_room;
+  return as(mv.course,mv.period) == mv.old_room && mv.new_room != mv.old_room;
 }
 
 // update the state according to the move 
@@ -509,6 +986,8 @@ void TT_RoomNeighborhoodExplorer::MakeMove(TT_State& as, const TT_MoveRoom& mv)
   as(mv.course,mv.period) = mv.new_room;
   as.DecRoomLectures(mv.old_room,mv.period);
   as.IncRoomLectures(mv.new_room,mv.period);
+  as.ToggleHash(mv.course,mv.period,mv.old_room);
+  as.ToggleHash(mv.course,mv.period,mv.new_room);
 } 
 
 // compute the next move in the exploration of the neighborhood
@@ -553,6 +1032,15 @@ fvalue TT_RoomNeighborhoodExplorer::DeltaObjective(const TT_State& as, const TT_
   return DeltaRoomCapacity(as,mv);
 } 
 
+// batch evaluation (see the time neighborhood explorer)
+void TT_RoomNeighborhoodExplorer::BatchDeltaCostFunction(const TT_State& as, const TT_MoveRoom mv[], 
+							 unsigned n, fvalue delta[])
+{
+  for (unsigned i = 0; i < n; i++)
+    delta[i] = WeightedCost(TT_RoomNeighborhoodExplorer::DeltaViolations(as,mv[i]),
+			    TT_RoomNeighborhoodExplorer::DeltaObjective(as,mv[i]));
+}
+
 int TT_RoomNeighborhoodExplorer::DeltaRoomOccupation(const TT_State& as, const TT_MoveRoom& mv) const
 {
   int cost = 0;
@@ -573,13 +1061,163 @@ int TT_RoomNeighborhoodExplorer::DeltaRoomCapacity(const TT_State& as, const TT_
   return cost;
 }
 
+// exploration of the whole neighborhood: the moves of a lecture towards
+// the new rooms fall in four classes of cost (free or occupied room,
+// large enough or not), therefore only the first room of each class, in
+// order of capacity, is evaluated. The rooms of a class are found with a
+// find-first-set on the bitmaps of the free rooms of the period.
+
+static inline unsigned FirstSetBit(unsigned long w)
+{
+#ifdef __GNUC__
+  return __builtin_ctzl(w);
+#else
+  unsigned i = 0;
+  while ((w & 1UL) == 0)
+    {
+      w >>= 1;
+      i++;
+    }
+  return i;
+#endif
+}
+
+fvalue TT_RoomNeighborhoodExplorer::BestMove(const TT_State& as, TT_MoveRoom& mv) 
+{
+  return ScanLectures(as,mv,false,0,0);
+}
+
+// the penalties of the diversification phase break the order of the 
+// candidate rooms, then all the rooms are explored
+fvalue TT_RoomNeighborhoodExplorer::BestNonProhibitedMove(const TT_State& as, TT_MoveRoom& mv, 
+							  fvalue curr, fvalue best) 
+{
+  if (Diversifying())
+    return StaticNeighborhoodExplorer<Faculty,TT_State,TT_MoveRoom,
+      TT_RoomNeighborhoodExplorer,TT_RoomTabuListManager>::BestNonProhibitedMove(as,mv,curr,best);
+  return ScanLectures(as,mv,true,curr,best);
+}
+
+// the first room (in order of capacity) with rank in [lo,hi) that is 
+// free (or occupied) in period p, apart from the room of rank skip;
+// it returns 0 if no such room exists
+unsigned TT_RoomNeighborhoodExplorer::FirstRoom(const TT_State& as, unsigned p, 
+						unsigned lo, unsigned hi, 
+						bool free, unsigned skip) const
+{
+  unsigned w;
+  unsigned long bits;
+
+  for (w = lo / ROOM_WORD_BITS; w * ROOM_WORD_BITS < hi; w++)
+    {
+      bits = as.FreeRooms(p,w);
+      if (!free)
+	bits = ~bits;
+      if (w == lo / ROOM_WORD_BITS)
+	bits &= ~0UL << (lo % ROOM_WORD_BITS);
+      if (w == skip / ROOM_WORD_BITS)
+	bits &= ~(1UL << (skip % ROOM_WORD_BITS));
+      if (bits != 0)
+	{
+	  unsigned k = w * ROOM_WORD_BITS + FirstSetBit(bits);
+	  return k < hi ? p_in->RoomByCapacity(k) : 0;
+	}
+    }
+  return 0;
+}
+
+// the new rooms for the lecture (c,p), one per class, in order of 
+// increasing cost; it returns their number
+unsigned TT_RoomNeighborhoodExplorer::CandidateRooms(const TT_State& as, unsigned c, 
+						     unsigned p, unsigned candidate[]) const
+{
+  unsigned n = 0, r, i;
+  unsigned fit = p_in->FirstFittingRank(c), old = p_in->CapacityRank(as(c,p));
+
+  for (i = 0; i < 2; i++)
+    {
+      bool free = (i == 0);
+      r = FirstRoom(as,p,fit,p_in->Rooms(),free,old);
+      if (r != 0)
+	candidate[n++] = r;
+      r = FirstRoom(as,p,0,fit,free,old);
+      if (r != 0)
+	candidate[n++] = r;
+    }
+  return n;
+}
+
+// visits the lectures in the same order of NextMove, starting from a 
+// random one; ties between lectures are broken in favour of the first 
+// one found, ties within a lecture in favour of the smallest room
+fvalue TT_RoomNeighborhoodExplorer::ScanLectures(const TT_State& as, TT_MoveRoom& mv, 
+						 bool prohibition, fvalue curr, fvalue best) 
+{
+  unsigned periods = p_in->Periods(), rows = p_in->Courses() * periods;
+  unsigned r, i, n, candidate[4];
+  fvalue mv_cost, best_delta = 0;
+  bool tabu_move, all_moves_tabu = true, first_move = true;
+
+  FirstMove(as,mv);
+  best_move = mv;
+  unsigned start = mv.course * periods + mv.period;
+
+  for (r = 0; r < rows; r++)
+    {
+      unsigned row = (start + r) % rows;
+      mv.course = row / periods;
+      mv.period = row % periods;
+      mv.old_room = as(mv.course,mv.period);
+      if (mv.old_room == 0)
+	continue;
+      n = CandidateRooms(as,mv.course,mv.period,candidate);
+      for (i = 0; i < n; i++)
+	{
+	  mv.new_room = candidate[i];
+	  mv_cost = DeltaCostFunction(as,mv);
+	  if (first_move)
+	    {
+	      best_move = mv;
+	      best_delta = mv_cost;
+	      first_move = false;
+	    }
+	  if (!prohibition)
+	    {
+	      if (mv_cost < best_delta)
+		{
+		  best_move = mv;
+		  best_delta = mv_cost;
+		}
+	      break; // the other candidates are not better
+	    }
+	  if (!all_moves_tabu && mv_cost >= best_delta)
+	    break;
+	  tabu_move = Prohibited(mv,mv_cost,curr,best);
+	  if (   (mv_cost < best_delta && !tabu_move)
+		 || (mv_cost < best_delta && all_moves_tabu)
+		 || (all_moves_tabu && !tabu_move))
+	    {
+	      best_move = mv;
+	      best_delta = mv_cost;
+	    }
+	  if (!tabu_move)
+	    {
+	      all_moves_tabu = false;
+	      break;
+	    }
+	}
+    }
+  mv = best_move;
+  return best_delta;
+}
+
 /*****************************************************************************
  * Room Tabu List Manager Methods
  *****************************************************************************/
 
 // constructor
 TT_RoomTabuListManager::TT_RoomTabuListManager(int min, int max)
-  : TabuListManager<TT_MoveRoom>(min,max) 
+  : StaticTabuListManager<TT_MoveRoom,TT_RoomTabuListManager>(min,max) 
 {}
 
 // the inverse move definition
@@ -588,6 +1226,152 @@ bool TT_RoomTabuListManager::Inverse(const TT_MoveRoom& m1, const TT_MoveRoom& m
   return m1.course == m2.course && m1.period == m2.period;
 } 
 
+// a move is tabu if the room of the same lecture has been changed by a
+// tabu move (see Inverse)
+bool TT_RoomTabuListManager::ListMember(const TT_MoveRoom& mv) const 
+{
+  return ProhibitedUntil(changed,mv.course,mv.period) > iter;
+}
+
+void TT_RoomTabuListManager::InsertIntoList(const TT_MoveRoom& mv) 
+{
+  Prohibit(changed,mv.course,mv.period,iter + Random(min_tenure,max_tenure) + 1);
+  iter++;
+}
+
+void TT_RoomTabuListManager::Clean() 
+{
+  StaticTabuListManager<TT_MoveRoom,TT_RoomTabuListManager>::Clean();
+  ClearProhibitions(changed);
+}
+
+/*****************************************************************************
+ * Room Frequency Manager Methods
+ *****************************************************************************/
+
+// constructor
+TT_RoomFrequencyManager::TT_RoomFrequencyManager(Faculty* pin, fvalue w)
+  : p_in(pin), weight(w), moves(0)
+{}
+
+// rooms are numbered from 1
+void TT_RoomFrequencyManager::InsertMove(const TT_MoveRoom& mv) 
+{
+  frequency[mv.course * (p_in->Rooms() + 1) + mv.new_room]++;
+  moves++;
+}
+
+fvalue TT_RoomFrequencyManager::Penalty(const TT_MoveRoom& mv) const 
+{
+  if (moves == 0)
+    return 0;
+  return weight * frequency[mv.course * (p_in->Rooms() + 1) + mv.new_room] / moves;
+}
+
+void TT_RoomFrequencyManager::Clean() 
+{
+  frequency.assign(p_in->Courses() * (p_in->Rooms() + 1),0);
+  moves = 0;
+}
+
+/*****************************************************************************
+ * Time/Room Neighborhood Explorer Methods
+ *****************************************************************************/
+
+// constructor
+TT_TimeRoomNeighborhoodExplorer::TT_TimeRoomNeighborhoodExplorer(StateManager<Faculty,TT_State>* psm, 
+								 TT_TimeNeighborhoodExplorer* ptnhe,
+								 TT_RoomNeighborhoodExplorer* prnhe,
+								 Faculty* pin)
+  : NeighborhoodExplorer<Faculty,TT_State,TT_MoveTimeRoom>(psm, pin), 
+    p_tnhe(ptnhe), p_rnhe(prnhe)
+{} 
+
+void TT_TimeRoomNeighborhoodExplorer::RandomMove(const TT_State& as, TT_MoveTimeRoom& mv) 
+{
+  StandardRandom rng;
+  RandomMove(as,mv,rng);
+} 
+
+bool TT_TimeRoomNeighborhoodExplorer::FeasibleMove(const TT_State& as, const TT_MoveTimeRoom& mv) 
+{
+  if (mv.time)
+    return p_tnhe->FeasibleMove(as,mv.time_move);
+  else
+    return p_rnhe->FeasibleMove(as,mv.room_move);
+}
+
+void TT_TimeRoomNeighborhoodExplorer::MakeMove(TT_State& as, const TT_MoveTimeRoom& mv) 
+{
+  if (mv.time)
+    p_tnhe->MakeMove(as,mv.time_move);
+  else
+    p_rnhe->MakeMove(as,mv.room_move);
+}
+
+fvalue TT_TimeRoomNeighborhoodExplorer::DeltaCostFunction(const TT_State& as, const TT_MoveTimeRoom& mv) 
+{
+  if (mv.time)
+    return p_tnhe->TT_TimeNeighborhoodExplorer::DeltaCostFunction(as,mv.time_move);
+  else
+    return p_rnhe->TT_RoomNeighborhoodExplorer::DeltaCostFunction(as,mv.room_move);
+}
+
+fvalue TT_TimeRoomNeighborhoodExplorer::DeltaViolations(const TT_State& as, const TT_MoveTimeRoom& mv) 
+{
+  if (mv.time)
+    return p_tnhe->DeltaViolations(as,mv.time_move);
+  else
+    return p_rnhe->DeltaViolations(as,mv.room_move);
+}
+
+fvalue TT_TimeRoomNeighborhoodExplorer::DeltaObjective(const TT_State& as, const TT_MoveTimeRoom& mv) 
+{
+  if (mv.time)
+    return p_tnhe->DeltaObjective(as,mv.time_move);
+  else
+    return p_rnhe->DeltaObjective(as,mv.room_move);
+}
+
+// the moves are enumerated lecture by lecture (in the order of the 
+// lecture index): first the ones to the open periods, then the ones to
+// the other rooms
+void TT_TimeRoomNeighborhoodExplorer::NextMove(const TT_State& as, TT_MoveTimeRoom& mv) 
+{
+  unsigned k;
+  if (mv.time)
+    {
+      TT_MoveTime& tm = mv.time_move;
+      unsigned i = as.OpenPeriodIndex(tm.course,tm.to) + 1;
+      if (i < as.OpenPeriods(tm.course))
+	{
+	  tm.to = as.OpenPeriod(tm.course,i);
+	  return;
+	}
+      mv.time = false;
+      mv.room_move = TT_MoveRoom(tm.course,tm.from,as(tm.course,tm.from),0);
+    }
+  TT_MoveRoom& rm = mv.room_move;
+  rm.new_room++;
+  if (rm.new_room == rm.old_room)
+    rm.new_room++;
+  if (rm.new_room <= p_in->Rooms())
+    return;
+  k = (as.LectureIndex(rm.course,rm.period) + 1) % as.Lectures();
+  FirstLectureMove(as,k,mv);
+}
+
+void TT_TimeRoomNeighborhoodExplorer::FirstLectureMove(const TT_State& as, unsigned k, 
+						       TT_MoveTimeRoom& mv) const
+{
+  unsigned c = as.LectureCourse(k), p = as.LecturePeriod(k);
+  mv.time = as.OpenPeriods(c) > 0;
+  if (mv.time)
+    mv.time_move = TT_MoveTime(c,p,as.OpenPeriod(c,0));
+  else
+    mv.room_move = TT_MoveRoom(c,p,as(c,p),as(c,p) == 1 ? 2 : 1);
+}
+
 #ifdef NO_MINI
 TT_TimeRoomKicker::TT_TimeRoomKicker(TT_TimeNeighborhoodExplorer *tnhe, 
 				   TT_RoomNeighborhoodExplorer *rnhe)
@@ -631,8 +1415,8 @@ bool TT_TimeRoomKicker::RelatedMoves(const TT_MoveRoom &mv1, const TT_MoveRoom &
  *****************************************************************************/
 
 // constructor
-TT_TimeTabuSearch::TT_TimeTabuSearch(StateManager<Faculty,TT_State>* psm, NeighborhoodExplorer<Faculty,TT_State,TT_MoveTime>* pnhe, TabuListManager<TT_MoveTime>* ptlm, Faculty* pin)
-  : TabuSearch<Faculty,TT_State,TT_MoveTime>(psm,pnhe,ptlm,pin) 
+TT_TimeTabuSearch::TT_TimeTabuSearch(StateManager<Faculty,TT_State>* psm, TT_TimeNeighborhoodExplorer* pnhe, TT_TimeTabuListManager* ptlm, Faculty* pin)
+  : StaticTabuSearch<Faculty,TT_State,TT_MoveTime,TT_TimeNeighborhoodExplorer,TT_TimeTabuListManager>(psm,pnhe,ptlm,pin) 
 {
   SetName("TS-Timetabler");
 }
@@ -642,8 +1426,8 @@ TT_TimeTabuSearch::TT_TimeTabuSearch(StateManager<Faculty,TT_State>* psm, Neighb
  *****************************************************************************/
 
 // constructor
-TT_TimeHillClimbing::TT_TimeHillClimbing(StateManager<Faculty,TT_State>* psm, NeighborhoodExplorer<Faculty,TT_State,TT_MoveTime>* pnhe, Faculty* pin)
-  : HillClimbing<Faculty,TT_State,TT_MoveTime>(psm,pnhe,pin) 
+TT_TimeHillClimbing::TT_TimeHillClimbing(StateManager<Faculty,TT_State>* psm, TT_TimeNeighborhoodExplorer* pnhe, Faculty* pin)
+  : StaticHillClimbing<Faculty,TT_State,TT_MoveTime,TT_TimeNeighborhoodExplorer>(psm,pnhe,pin) 
 {
   SetName("HC-Timetabler");
 }
@@ -654,9 +1438,10 @@ TT_TimeHillClimbing::TT_TimeHillClimbing(StateManager<Faculty,TT_State>* psm, Ne
 
 // constructor
 TT_RoomTabuSearch::TT_RoomTabuSearch(StateManager<Faculty,TT_State>* psm, 
-				   NeighborhoodExplorer<Faculty,TT_State,TT_MoveRoom>* pnhe, 
-				   TabuListManager<TT_MoveRoom>* ptlm, Faculty* pin)
-  : TabuSearch<Faculty,TT_State,TT_MoveRoom>(psm,pnhe,ptlm,pin) 
+				   TT_RoomNeighborhoodExplorer* pnhe, 
+				   TT_RoomTabuListManager* ptlm, Faculty* pin)
+  : StaticTabuSearch<Faculty,TT_State,TT_MoveRoom,
+		     TT_RoomNeighborhoodExplorer,TT_RoomTabuListManager>(psm,pnhe,ptlm,pin) 
 {
    SetName("TS-Roomtabler");
 }
@@ -667,21 +1452,838 @@ TT_RoomTabuSearch::TT_RoomTabuSearch(StateManager<Faculty,TT_State>* psm,
  *****************************************************************************/
 
 // constructor
-TT_RoomHillClimbing::TT_RoomHillClimbing(StateManager<Faculty,TT_State>* psm, NeighborhoodExplorer<Faculty,TT_State,TT_MoveRoom>* pnhe, Faculty* pin)
-  : HillClimbing<Faculty,TT_State,TT_MoveRoom>(psm,pnhe,pin) 
+TT_RoomHillClimbing::TT_RoomHillClimbing(StateManager<Faculty,TT_State>* psm, TT_RoomNeighborhoodExplorer* pnhe, Faculty* pin)
+  : StaticHillClimbing<Faculty,TT_State,TT_MoveRoom,TT_RoomNeighborhoodExplorer>(psm,pnhe,pin) 
 {
    SetName("HC-Roomtabler");
 }
 
 /*****************************************************************************
- * Token Ring Solver Methods
+ * Time Reactive Tabu Search Runner Methods
  *****************************************************************************/
 
-TT_TokenRingSolver::TT_TokenRingSolver(StateManager<Faculty,TT_State>* psm, 
-						 OutputManager<Faculty,Timetable,TT_State>* pom, 
-						 Faculty* pin, Timetable* pout)
+// constructor
+TT_TimeReactiveTabuSearch::TT_TimeReactiveTabuSearch(StateManager<Faculty,TT_State>* psm, 
+						     TT_TimeNeighborhoodExplorer* pnhe, 
+						     TT_TimeTabuListManager* ptlm, Faculty* pin)
+  : ReactiveTabuSearch<Faculty,TT_State,TT_MoveTime>(psm,pnhe,ptlm,pin) 
+{
+  SetName("RTS-Timetabler");
+}
+
+/*****************************************************************************
+ * Room Reactive Tabu Search Runner Methods
+ *****************************************************************************/
+
+// constructor
+TT_RoomReactiveTabuSearch::TT_RoomReactiveTabuSearch(StateManager<Faculty,TT_State>* psm, 
+						     TT_RoomNeighborhoodExplorer* pnhe, 
+						     TT_RoomTabuListManager* ptlm, Faculty* pin)
+  : ReactiveTabuSearch<Faculty,TT_State,TT_MoveRoom>(psm,pnhe,ptlm,pin) 
+{
+  SetName("RTS-Roomtabler");
+}
+
+/*****************************************************************************
+ * Time Simulated Annealing Runner Methods
+ *****************************************************************************/
+
+// constructor
+TT_TimeSimulatedAnnealing::TT_TimeSimulatedAnnealing(StateManager<Faculty,TT_State>* psm, 
+						     TT_TimeNeighborhoodExplorer* pnhe, 
+						     Faculty* pin)
+  : StaticSimulatedAnnealing<Faculty,TT_State,TT_MoveTime,TT_TimeNeighborhoodExplorer>(psm,pnhe,pin) 
+{
+  SetName("SA-Timetabler");
+}
+
+/*****************************************************************************
+ * Room Simulated Annealing Runner Methods
+ *****************************************************************************/
+
+// constructor
+TT_RoomSimulatedAnnealing::TT_RoomSimulatedAnnealing(StateManager<Faculty,TT_State>* psm, 
+						     TT_RoomNeighborhoodExplorer* pnhe, 
+						     Faculty* pin)
+  : StaticSimulatedAnnealing<Faculty,TT_State,TT_MoveRoom,TT_RoomNeighborhoodExplorer>(psm,pnhe,pin) 
+{
+  SetName("SA-Roomtabler");
+}
+
+/*****************************************************************************
+ * Time/Room Simulated Annealing Runner Methods
+ *****************************************************************************/
+
+// constructor
+TT_TimeRoomSimulatedAnnealing::TT_TimeRoomSimulatedAnnealing(StateManager<Faculty,TT_State>* psm, 
+							     TT_TimeRoomNeighborhoodExplorer* pnhe, 
+							     Faculty* pin)
+  : StaticSimulatedAnnealing<Faculty,TT_State,TT_MoveTimeRoom,
+			     TT_TimeRoomNeighborhoodExplorer>(psm,pnhe,pin) 
+{
+  SetName("SA-TimeRoomtabler");
+}
+
+/*****************************************************************************
+ * Time Late Acceptance Hill Climbing Runner Methods
+ *****************************************************************************/
+
+// constructor
+TT_TimeLateAcceptance::TT_TimeLateAcceptance(StateManager<Faculty,TT_State>* psm, 
+					     TT_TimeNeighborhoodExplorer* pnhe, 
+					     Faculty* pin)
+  : StaticLateAcceptanceHillClimbing<Faculty,TT_State,TT_MoveTime,TT_TimeNeighborhoodExplorer>(psm,pnhe,pin) 
+{
+  SetName("LAHC-Timetabler");
+}
+
+/*****************************************************************************
+ * Room Late Acceptance Hill Climbing Runner Methods
+ *****************************************************************************/
+
+// constructor
+TT_RoomLateAcceptance::TT_RoomLateAcceptance(StateManager<Faculty,TT_State>* psm, 
+					     TT_RoomNeighborhoodExplorer* pnhe, 
+					     Faculty* pin)
+  : StaticLateAcceptanceHillClimbing<Faculty,TT_State,TT_MoveRoom,TT_RoomNeighborhoodExplorer>(psm,pnhe,pin) 
+{
+  SetName("LAHC-Roomtabler");
+}
+
+/*****************************************************************************
+ * Time/Room Late Acceptance Hill Climbing Runner Methods
+ *****************************************************************************/
+
+// constructor
+TT_TimeRoomLateAcceptance::TT_TimeRoomLateAcceptance(StateManager<Faculty,TT_State>* psm, 
+						     TT_TimeRoomNeighborhoodExplorer* pnhe, 
+						     Faculty* pin)
+  : StaticLateAcceptanceHillClimbing<Faculty,TT_State,TT_MoveTimeRoom,
+				     TT_TimeRoomNeighborhoodExplorer>(psm,pnhe,pin) 
+{
+  SetName("LAHC-TimeRoomtabler");
+}
+
+/*****************************************************************************
+ * Time Great Deluge Runner Methods
+ *****************************************************************************/
+
+// constructor
+TT_TimeGreatDeluge::TT_TimeGreatDeluge(StateManager<Faculty,TT_State>* psm, 
+				       TT_TimeNeighborhoodExplorer* pnhe, 
+				       Faculty* pin)
+  : StaticGreatDeluge<Faculty,TT_State,TT_MoveTime,TT_TimeNeighborhoodExplorer>(psm,pnhe,pin) 
+{
+  SetName("GD-Timetabler");
+}
+
+/*****************************************************************************
+ * Room Great Deluge Runner Methods
+ *****************************************************************************/
+
+// constructor
+TT_RoomGreatDeluge::TT_RoomGreatDeluge(StateManager<Faculty,TT_State>* psm, 
+				       TT_RoomNeighborhoodExplorer* pnhe, 
+				       Faculty* pin)
+  : StaticGreatDeluge<Faculty,TT_State,TT_MoveRoom,TT_RoomNeighborhoodExplorer>(psm,pnhe,pin) 
+{
+  SetName("GD-Roomtabler");
+}
+
+/*****************************************************************************
+ * Time/Room Great Deluge Runner Methods
+ *****************************************************************************/
+
+// constructor
+TT_TimeRoomGreatDeluge::TT_TimeRoomGreatDeluge(StateManager<Faculty,TT_State>* psm, 
+					       TT_TimeRoomNeighborhoodExplorer* pnhe, 
+					       Faculty* pin)
+  : StaticGreatDeluge<Faculty,TT_State,TT_MoveTimeRoom,
+		      TT_TimeRoomNeighborhoodExplorer>(psm,pnhe,pin) 
+{
+  SetName("GD-TimeRoomtabler");
+}
+
+/*****************************************************************************
+ * Time Parallel Tempering Runner Methods
+ *****************************************************************************/
+
+// constructor
+TT_TimeParallelTempering::TT_TimeParallelTempering(StateManager<Faculty,TT_State>* psm, 
+						   TT_TimeNeighborhoodExplorer* pnhe, 
+						   Faculty* pin)
+  : ParallelTempering<Faculty,TT_State,TT_MoveTime,TT_TimeNeighborhoodExplorer>(psm,pnhe,pin) 
+{
+  SetName("PT-Timetabler");
+}
+
+/*****************************************************************************
+ * Room Parallel Tempering Runner Methods
+ *****************************************************************************/
+
+// constructor
+TT_RoomParallelTempering::TT_RoomParallelTempering(StateManager<Faculty,TT_State>* psm, 
+						   TT_RoomNeighborhoodExplorer* pnhe, 
+						   Faculty* pin)
+  : ParallelTempering<Faculty,TT_State,TT_MoveRoom,TT_RoomNeighborhoodExplorer>(psm,pnhe,pin) 
+{
+  SetName("PT-Roomtabler");
+}
+
+/*****************************************************************************
+ * Time/Room Parallel Tempering Runner Methods
+ *****************************************************************************/
+
+// constructor
+TT_TimeRoomParallelTempering::TT_TimeRoomParallelTempering(StateManager<Faculty,TT_State>* psm, 
+							   TT_TimeRoomNeighborhoodExplorer* pnhe, 
+							   Faculty* pin)
+  : ParallelTempering<Faculty,TT_State,TT_MoveTimeRoom,
+		      TT_TimeRoomNeighborhoodExplorer>(psm,pnhe,pin) 
+{
+  SetName("PT-TimeRoomtabler");
+}
+
+/*****************************************************************************
+ * Room Matching Runner Methods
+ *****************************************************************************/
+
+// constructor
+TT_RoomMatching::TT_RoomMatching(StateManager<Faculty,TT_State>* psm, 
+				 TT_RoomNeighborhoodExplorer* pnhe, Faculty* pin)
+  : MoveRunner<Faculty,TT_State,TT_MoveRoom>(psm,pnhe,pin,"Runner name","Room Matching")
+{
+  long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+  threads = cpus > 0 ? cpus : 1;
+  SetName("RM-Roomtabler");
+}
+
+void TT_RoomMatching::ReadParameters()
+{
+  cout << "ROOM MATCHING -- INPUT PARAMETERS" << endl;
+  cout << "Number of threads: ";
+  cin >> threads;
+}
+
+void TT_RoomMatching::SetParameters(const ParameterBox& pb)
+{
+  pb.Get("threads", threads);
+}
+
+void TT_RoomMatching::Print(ostream& os) const
+{
+  MoveRunner<Faculty,TT_State,TT_MoveRoom>::Print(os);
+  os << "PARAMETERS: " << endl;
+  os << "  Threads : " << threads << endl;
+  os << "RESULTS : " << endl;
+  os << "  Rooms changed : " << number_of_iterations << endl;
+}
+
+// the threads compute the new rooms from the current state, then the 
+// changes are performed as room moves, which keep the redundant data;
+// the periods left when the run is interrupted keep their rooms. Inside
+// a concurrent search (e.g., a worker of a parallel multi-start) the 
+// processors are already busy, and a single thread is used
+void TT_RoomMatching::Go()
+{
+  assert(current_state_set && threads > 0);
+  InitializeRun();
+  unsigned p, w, workers = ConcurrentThread() ? 1 : threads;
+  if (workers > p_in->Periods())
+    workers = p_in->Periods();
+  vector<Worker> worker(workers);
+  vector<pthread_t> thread(workers);
+  period_rooms.resize(p_in->Periods());
+  for (p = 0; p < p_in->Periods(); p++)
+    period_rooms[p].clear();
+  for (w = 0; w < workers; w++)
+    {
+      worker[w].runner = this;
+      worker[w].first = w;
+      worker[w].step = workers;
+      if (w > 0)
+	pthread_create(&thread[w], NULL, WorkerThread, &worker[w]);
+    }
+  WorkerThread(&worker[0]);
+  for (w = 1; w < workers; w++)
+    pthread_join(thread[w], NULL);
+
+  for (p = 0; p < p_in->Periods(); p++)
+    for (unsigned c = 0; c < period_rooms[p].size(); c++)
+      if (current_state(c,p) != 0 && period_rooms[p][c] != current_state(c,p))
+	{
+	  p_nhe->MakeMove(current_state,TT_MoveRoom(c,p,current_state(c,p),period_rooms[p][c]));
+	  number_of_iterations++;
+	}
+  ComputeCost();
+  best_state = current_state;
+  best_state_cost = current_state_cost;
+  iteration_of_best = number_of_iterations;
+  TerminateRun();
+  NotifyRunStopped();
+}
+
+void* TT_RoomMatching::WorkerThread(void* arg)
+{
+  Worker* w = static_cast<Worker*>(arg);
+  for (unsigned p = w->first; p < w->runner->p_in->Periods(); p += w->step)
+    {
+      if (w->runner->Interrupted())
+	break;
+      w->runner->AssignRooms(p);
+    }
+  return NULL;
+}
+
+// assignment of the n lectures of period p to m = k * Rooms() columns: 
+// column (q, r) is the q-th lecture in room r, which costs q violations
+// of room occupation (plus the room capacity one)
+void TT_RoomMatching::AssignRooms(unsigned p)
+{
+  const TT_State& as = current_state;
+  unsigned rooms = p_in->Rooms(), i, j, r;
+  vector<unsigned> course;
+  for (unsigned c = 0; c < p_in->Courses(); c++)
+    if (as(c,p) != 0)
+      course.push_back(c);
+  period_rooms[p].assign(p_in->Courses(), 0);
+  unsigned n = course.size(), m = ((n + rooms - 1) / rooms) * rooms;
+  if (n == 0)
+    return;
+
+  vector<fvalue> capacity_cost(n * rooms);
+  for (i = 0; i < n; i++)
+    for (r = 1; r <= rooms; r++)
+      capacity_cost[i * rooms + r - 1] = 
+	p_in->RoomVector(r).Capacity() < p_in->CourseVector(course[i]).Students() ? 1 : 0;
+
+  // Hungarian method (rows and columns from 1, row 0 and column 0 are dummy)
+  const fvalue INF = numeric_limits<fvalue>::max();
+  vector<fvalue> u(n + 1, 0), v(m + 1, 0), minv(m + 1);
+  vector<unsigned> row(m + 1, 0), way(m + 1, 0);
+  vector<bool> used(m + 1);
+  for (i = 1; i <= n; i++)
+    {
+      unsigned j0 = 0, j1 = 0;
+      row[0] = i;
+      minv.assign(m + 1, INF);
+      used.assign(m + 1, false);
+      do
+	{
+	  used[j0] = true;
+	  unsigned i0 = row[j0];
+	  fvalue delta = INF;
+	  for (j = 1; j <= m; j++)
+	    if (!used[j])
+	      {
+		fvalue cur = HARD_WEIGHT * ((j - 1) / rooms) 
+		  + capacity_cost[(i0 - 1) * rooms + (j - 1) % rooms] - u[i0] - v[j];
+		if (cur < minv[j])
+		  {
+		    minv[j] = cur;
+		    way[j] = j0;
+		  }
+		if (minv[j] < delta)
+		  {
+		    delta = minv[j];
+		    j1 = j;
+		  }
+	      }
+	  for (j = 0; j <= m; j++)
+	    if (used[j])
+	      {
+		u[row[j]] += delta;
+		v[j] -= delta;
+	      }
+	    else
+	      minv[j] -= delta;
+	  j0 = j1;
+	}
+      while (row[j0] != 0);
+      do
+	{
+	  j1 = way[j0];
+	  row[j0] = row[j1];
+	  j0 = j1;
+	}
+      while (j0 != 0);
+    }
+  for (j = 1; j <= m; j++)
+    if (row[j] != 0)
+      period_rooms[p][course[row[j] - 1]] = (j - 1) % rooms + 1;
+}
+
+/*****************************************************************************
+ * Runner Set Methods
+ *****************************************************************************/
+
+TT_RunnerSet::TT_RunnerSet(StateManager<Faculty,TT_State>* psm, Faculty* pin)
+  :  tnhe(psm,pin), rnhe(psm,pin), trnhe(psm,&tnhe,&rnhe,pin),
+     thc(psm,&tnhe,pin), tts(psm,&tnhe,&ttlm,pin),
+     rhc(psm,&rnhe,pin), rts(psm,&rnhe,&rtlm,pin),
+     trts(psm,&tnhe,&ttlm,pin), rrts(psm,&rnhe,&rtlm,pin),
+     tsa(psm,&tnhe,pin), rsa(psm,&rnhe,pin), trsa(psm,&trnhe,pin),
+     tla(psm,&tnhe,pin), rla(psm,&rnhe,pin), trla(psm,&trnhe,pin),
+     tgd(psm,&tnhe,pin), rgd(psm,&rnhe,pin), trgd(psm,&trnhe,pin),
+     tpt(psm,&tnhe,pin), rpt(psm,&rnhe,pin), trpt(psm,&trnhe,pin),
+     rm(psm,&rnhe,pin)
+{
+  Runner<Faculty,TT_State>* r[] = { &thc, &tts, &rhc, &rts, &trts, &rrts,
+				    &tsa, &rsa, &trsa, &tla, &rla, &trla,
+				    &tgd, &rgd, &trgd, &tpt, &rpt, &trpt, &rm };
+  all_runners.assign(r, r + sizeof(r) / sizeof(r[0]));
+}
+
+/*****************************************************************************
+ * Token Ring Solver Methods
+ *****************************************************************************/
+
+TT_TokenRingSolver::TT_TokenRingSolver(StateManager<Faculty,TT_State>* psm, 
+						 OutputManager<Faculty,Timetable,TT_State>* pom, 
+						 Faculty* pin, Timetable* pout)
   :  TokenRingSolver<Faculty,Timetable,TT_State>(psm,pom,pin,pout) 
 {
 
 }
 
+TT_TokenRingWorker::TT_TokenRingWorker(StateManager<Faculty,TT_State>* psm, 
+				       OutputManager<Faculty,Timetable,TT_State>* pom, 
+				       Faculty* pin)
+  :  TT_TokenRingSolver(psm,pom,pin,NULL), runner_set(psm,pin), timetable(pin)
+{
+  SetOutput(&timetable);
+}
+
+void TT_TokenRingWorker::SetInput(Faculty* pin)
+{
+  TT_TokenRingSolver::SetInput(pin);
+  timetable.SetInput(pin);
+}
+
+/*****************************************************************************
+ * Concurrent Comparative Solver Methods
+ *****************************************************************************/
+
+TT_ConcurrentComparativeSolver::TT_ConcurrentComparativeSolver(StateManager<Faculty,TT_State>* psm, 
+							       OutputManager<Faculty,Timetable,TT_State>* pom, 
+							       Faculty* pin, Timetable* pout,
+							       unsigned sets)
+  :  ConcurrentComparativeSolver<Faculty,Timetable,TT_State>(psm,pom,pin,pout),
+     runner_sets(sets)
+{
+  for (unsigned i = 0; i < sets; i++)
+    runner_sets[i] = new TT_RunnerSet(psm,pin);
+}
+
+TT_ConcurrentComparativeSolver::~TT_ConcurrentComparativeSolver()
+{
+  for (unsigned i = 0; i < runner_sets.size(); i++)
+    delete runner_sets[i];
+}
+
+void TT_ConcurrentComparativeSolver::Run()
+{
+  if (runners.size() > runner_sets.size())
+    {
+      cerr << "Warning: the portfolio runs only its first " << runner_sets.size() 
+	   << " runners" << endl;
+      runners.resize(runner_sets.size());
+    }
+  ConcurrentComparativeSolver<Faculty,Timetable,TT_State>::Run();
+}
+
+/*****************************************************************************
+ * Island Model Solver Methods
+ *****************************************************************************/
+
+TT_IslandModelSolver::TT_IslandModelSolver(StateManager<Faculty,TT_State>* psm, 
+					   OutputManager<Faculty,Timetable,TT_State>* pom, 
+					   Faculty* pin, Timetable* pout,
+					   unsigned islands)
+  :  IslandModelSolver<Faculty,Timetable,TT_State>(psm,pom,pin,pout),
+     token_rings(islands)
+{
+  for (unsigned k = 0; k < islands; k++)
+    {
+      token_rings[k] = new TT_TokenRingWorker(psm,pom,pin);
+      AddIsland(token_rings[k]);
+    }
+}
+
+TT_IslandModelSolver::~TT_IslandModelSolver()
+{
+  for (unsigned k = 0; k < token_rings.size(); k++)
+    delete token_rings[k];
+}
+
+// the parameters of the token rings depend on their runners, which are
+// known only when the solver runs
+void TT_IslandModelSolver::Run()
+{
+  for (unsigned k = 0; k < token_rings.size(); k++)
+    {
+      unsigned n = token_rings[k]->NumberOfRunners();
+      if (n == 0)
+	{
+	  cerr << "Error: the islands have no runners" << endl;
+	  return;
+	}
+      token_rings[k]->SetStartRunner(k % n);
+      token_rings[k]->SetRounds(1 + k % 2);
+    }
+  IslandModelSolver<Faculty,Timetable,TT_State>::Run();
+}
+
+/*****************************************************************************
+ * Process Pool Solver Methods
+ *****************************************************************************/
+
+TT_ProcessPoolSolver::TT_ProcessPoolSolver(StateManager<Faculty,TT_State>* psm, 
+					   OutputManager<Faculty,Timetable,TT_State>* pom, 
+					   Faculty* pin, Timetable* pout)
+  :  ProcessPoolSolver<Faculty,Timetable,TT_State>(psm,pom,pin,pout),
+     worker(psm,pom,pin)
+{
+  SetWorker(&worker);
+}
+
+void TT_ProcessPoolSolver::SetInput(Faculty* pin)
+{
+  ProcessPoolSolver<Faculty,Timetable,TT_State>::SetInput(pin);
+  worker.SetInput(pin);
+}
+
+/*****************************************************************************
+ * Iterated Local Search Solver Methods
+ *****************************************************************************/
+
+TT_IteratedLocalSearch::TT_IteratedLocalSearch(StateManager<Faculty,TT_State>* psm, 
+					       OutputManager<Faculty,Timetable,TT_State>* pom, 
+					       TT_TimeRoomNeighborhoodExplorer* pnhe,
+					       Faculty* pin, Timetable* pout)
+  : IteratedLocalSearch<Faculty,Timetable,TT_State,TT_MoveTimeRoom>(psm,pom,pnhe,pin,pout),
+    targeted_rate(0.5)
+{}
+
+// whether lecture of course c in period p is in conflict or shares its room
+bool TT_IteratedLocalSearch::HardViolated(const TT_State& as, unsigned c, unsigned p) const
+{
+  if (as.RoomLectures(as(c,p),p) > 1)
+    return true;
+  for (unsigned c2 = 0; c2 < p_in->Courses(); c2++)
+    if (c2 != c && as(c2,p) != 0 && p_in->Conflict(c,c2))
+      return true;
+  return false;
+}
+
+// a hard violated lecture goes to another period (or room if it has no
+// open period), a lecture in a too small room goes to a large enough one
+void TT_IteratedLocalSearch::SelectKickMove(const TT_State& as, TT_MoveTimeRoom& mv)
+{
+  if (((float)Random(0,RAND_MAX - 1))/RAND_MAX >= targeted_rate)
+    {
+      p_nhe->RandomMove(as,mv);
+      return;
+    }
+  hard_lectures.clear();
+  soft_lectures.clear();
+  for (unsigned k = 0; k < as.Lectures(); k++)
+    {
+      unsigned c = as.LectureCourse(k), p = as.LecturePeriod(k);
+      if (HardViolated(as,c,p))
+	hard_lectures.push_back(k);
+      else if (p_in->FirstFittingRank(c) < p_in->Rooms()
+	       && p_in->CapacityRank(as(c,p)) < p_in->FirstFittingRank(c))
+	soft_lectures.push_back(k);
+    }
+  unsigned k, c, p;
+  if (!hard_lectures.empty())
+    {
+      k = hard_lectures[Random(0,hard_lectures.size() - 1)];
+      c = as.LectureCourse(k);
+      p = as.LecturePeriod(k);
+      mv.time = as.OpenPeriods(c) > 0;
+      if (mv.time)
+	{
+	  mv.time_move = TT_MoveTime(c,p,as.OpenPeriod(c,Random(0,as.OpenPeriods(c) - 1)));
+	  return;
+	}
+    }
+  else if (!soft_lectures.empty())
+    {
+      k = soft_lectures[Random(0,soft_lectures.size() - 1)];
+      c = as.LectureCourse(k);
+      p = as.LecturePeriod(k);
+    }
+  else
+    {
+      p_nhe->RandomMove(as,mv);
+      return;
+    }
+  // room move, to a large enough room if there is one
+  unsigned first = p_in->FirstFittingRank(c) < p_in->Rooms() ? p_in->FirstFittingRank(c) : 0;
+  unsigned r;
+  do
+    r = p_in->RoomByCapacity(Random(first,p_in->Rooms() - 1));
+  while (r == as(c,p) && first < p_in->Rooms() - 1);
+  mv.time = false;
+  mv.room_move = TT_MoveRoom(c,p,as(c,p),r);
+}
+
+/*****************************************************************************
+ * Variable Neighborhood Search Solver Methods
+ *****************************************************************************/
+
+TT_VariableNeighborhoodSearch::TT_VariableNeighborhoodSearch(StateManager<Faculty,TT_State>* psm, 
+							     OutputManager<Faculty,Timetable,TT_State>* pom, 
+							     TT_TimeNeighborhoodExplorer* ptnhe,
+							     TT_RoomNeighborhoodExplorer* prnhe,
+							     Faculty* pin, Timetable* pout)
+  : VariableNeighborhoodSearch<Faculty,Timetable,TT_State>(psm,pom,pin,pout),
+    time_neighborhood(ptnhe), room_neighborhood(prnhe)
+{
+  AddNeighborhood(&time_neighborhood);
+  AddNeighborhood(&room_neighborhood);
+}
+
+/*****************************************************************************
+ * Large Neighborhood Search Solver Methods
+ *****************************************************************************/
+
+TT_LargeNeighborhoodSearch::TT_LargeNeighborhoodSearch(StateManager<Faculty,TT_State>* psm, 
+						       OutputManager<Faculty,Timetable,TT_State>* pom, 
+						       Faculty* pin, Timetable* pout)
+  : LargeNeighborhoodSearch<Faculty,Timetable,TT_State>(psm,pom,METHODS,pin,pout),
+    max_lectures(6), max_nodes(20000)
+{}
+
+// the removed lectures are put back in the best placement, if it is 
+// not worse than the current one and differs from it (so that the search
+// can also drift across plateaus)
+fvalue TT_LargeNeighborhoodSearch::DestroyAndRepair(TT_State& as, unsigned int method)
+{
+  unsigned i;
+  Destroy(as,method);
+  if (removed.empty())
+    return 0;
+  InitializeRepair(as);
+
+  fvalue current_cost = 0;
+  for (i = 0; i < removed.size(); i++)
+    {
+      current_cost += InsertionCost(i,removed[i].period,removed[i].room);
+      Place(i,removed[i].period,removed[i].room,1);
+    }
+  for (i = removed.size(); i > 0; i--)
+    Place(i - 1,removed[i - 1].period,removed[i - 1].room,-1);
+
+  placement = removed;
+  best_placement = removed;
+  best_cost = current_cost;
+  best_differs = false;
+  nodes = 0;
+  Search(0,0);
+  if (!best_differs)
+    return 0;
+
+  for (i = 0; i < removed.size(); i++)
+    as(removed[i].course,removed[i].period) = 0;
+  for (i = 0; i < removed.size(); i++)
+    as(best_placement[i].course,best_placement[i].period) = best_placement[i].room;
+  p_sm->UpdateRedundantStateData(as);
+  return best_cost - current_cost;
+}
+
+void TT_LargeNeighborhoodSearch::Destroy(const TT_State& as, unsigned int method)
+{
+  unsigned k, c, d = 0, c0 = as.LectureCourse(Random(0,as.Lectures() - 1));
+  vector<bool> chosen(p_in->Courses(),false);
+  Lecture l;
+
+  removed.clear();
+  if (method == DAY)
+    d = Random(0,p_in->Days() - 1);
+  else if (method == CURRICULUM && p_in->Groups() > 0)
+    {
+      const CourseGroup& g = p_in->GroupVector(Random(0,p_in->Groups() - 1));
+      for (k = 0; k < g.Size(); k++)
+	chosen[g[k]] = true;
+    }
+  else
+    for (c = 0; c < p_in->Courses(); c++)
+      chosen[c] = c == c0
+	|| (method == TEACHER && p_in->CourseVector(c).Teacher() == p_in->CourseVector(c0).Teacher())
+	|| (method == CONFLICTS && p_in->Conflict(c0,c));
+
+  for (k = 0; k < as.Lectures(); k++)
+    {
+      l.course = as.LectureCourse(k);
+      l.period = as.LecturePeriod(k);
+      if (method == DAY ? l.period / p_in->PeriodsPerDay() == d : chosen[l.course])
+	{
+	  l.room = as(l.course,l.period);
+	  removed.push_back(l);
+	}
+    }
+
+  // at most max_lectures of them, drawn at random
+  for (k = 0; k < removed.size() && k < max_lectures; k++)
+    swap(removed[k],removed[Random(k,removed.size() - 1)]);
+  if (removed.size() > max_lectures)
+    removed.resize(max_lectures);
+  sort(removed.begin(),removed.end());
+}
+
+// the data of the state are restricted to the courses of the removed
+// lectures, which are then taken away
+void TT_LargeNeighborhoodSearch::InitializeRepair(const TT_State& as)
+{
+  unsigned i, k, c, c2, p, r;
+  courses.clear();
+  course_index.resize(removed.size());
+  for (i = 0; i < removed.size(); i++)
+    {
+      if (i == 0 || removed[i].course != removed[i - 1].course)
+	courses.push_back(removed[i].course);
+      course_index[i] = courses.size() - 1;
+    }
+
+  busy.assign(courses.size(),vector<int>(p_in->Periods(),0));
+  daily.assign(courses.size(),vector<int>(p_in->Days(),0));
+  conflicts.assign(courses.size(),vector<int>(p_in->Periods(),0));
+  working_days.resize(courses.size());
+  for (k = 0; k < courses.size(); k++)
+    {
+      c = courses[k];
+      working_days[k] = as.WorkingDays(c);
+      for (p = 0; p < p_in->Periods(); p++)
+	{
+	  busy[k][p] = as(c,p) != 0;
+	  daily[k][p / p_in->PeriodsPerDay()] += busy[k][p];
+	  for (c2 = 0; c2 < p_in->Courses(); c2++)
+	    if (c2 != c && as(c2,p) != 0 && p_in->Conflict(c,c2))
+	      conflicts[k][p]++;
+	}
+    }
+  occupation.assign(p_in->Periods(),vector<int>(p_in->Rooms() + 1,0));
+  for (p = 0; p < p_in->Periods(); p++)
+    for (r = 1; r <= p_in->Rooms(); r++)
+      occupation[p][r] = as.RoomLectures(r,p);
+
+  // the class of a room is the number of courses that fit in it
+  room_class.assign(p_in->Rooms() + 1,0);
+  for (r = 1; r <= p_in->Rooms(); r++)
+    for (k = 0; k < courses.size(); k++)
+      if (p_in->CourseVector(courses[k]).Students() <= p_in->RoomVector(r).Capacity())
+	room_class[r]++;
+  seen_class.resize(2 * (courses.size() + 1));
+
+  for (i = 0; i < removed.size(); i++)
+    Place(i,removed[i].period,removed[i].room,-1);
+}
+
+// whether the course of removed lecture i can take place in period p
+bool TT_LargeNeighborhoodSearch::Allowed(unsigned i, unsigned p) const
+{
+  return p_in->Available(removed[i].course,p) && busy[course_index[i]][p] == 0;
+}
+
+// variation of the cost due to placing removed lecture i in period p and room r
+fvalue TT_LargeNeighborhoodSearch::InsertionCost(unsigned i, unsigned p, unsigned r) const
+{
+  unsigned k = course_index[i], c = courses[k];
+  fvalue cost = HARD_WEIGHT * (conflicts[k][p] + (occupation[p][r] > 0));
+  if (p_in->RoomVector(r).Capacity() < p_in->CourseVector(c).Students())
+    cost += 1;
+  if (daily[k][p / p_in->PeriodsPerDay()] == 0 
+      && working_days[k] < (int)p_in->CourseVector(c).MinWorkingDays())
+    cost -= 1;
+  return cost;
+}
+
+// lower bound of the cost of placing removed lecture i, which can only 
+// increase as other lectures are placed
+fvalue TT_LargeNeighborhoodSearch::MinInsertionCost(unsigned i) const
+{
+  fvalue min_cost = numeric_limits<fvalue>::max();
+  for (unsigned p = 0; p < p_in->Periods(); p++)
+    if (Allowed(i,p))
+      for (unsigned r = 1; r <= p_in->Rooms(); r++)
+	min_cost = min(min_cost,InsertionCost(i,p,r));
+  return min_cost;
+}
+
+// places (sign = 1) or removes (sign = -1) removed lecture i
+void TT_LargeNeighborhoodSearch::Place(unsigned i, unsigned p, unsigned r, int sign)
+{
+  unsigned k = course_index[i], c = courses[k], d = p / p_in->PeriodsPerDay();
+  busy[k][p] += sign;
+  if (sign > 0 ? daily[k][d]++ == 0 : --daily[k][d] == 0)
+    working_days[k] += sign;
+  occupation[p][r] += sign;
+  for (unsigned k2 = 0; k2 < courses.size(); k2++)
+    if (k2 != k && p_in->Conflict(c,courses[k2]))
+      conflicts[k2][p] += sign;
+}
+
+// depth first branch and bound: the candidates of lecture i are its 
+// allowed periods (later than the previous lecture of the same course)
+// with a room of each class, ordered by cost
+void TT_LargeNeighborhoodSearch::Search(unsigned i, fvalue cost)
+{
+  if (i == removed.size())
+    {
+      if (cost < best_cost || !(placement == removed))
+	{
+	  best_cost = cost;
+	  best_placement = placement;
+	  best_differs = true;
+	}
+      return;
+    }
+  if (nodes++ >= max_nodes)
+    return;
+
+  fvalue bound = 0;
+  unsigned j, p, r;
+  for (j = i + 1; j < removed.size(); j++)
+    bound += MinInsertionCost(j);
+  if (Pruned(cost + bound))
+    return;
+
+  vector<Candidate> candidate;
+  Candidate cd;
+  for (p = 0; p < p_in->Periods(); p++)
+    {
+      if (!Allowed(i,p) 
+	  || (i > 0 && course_index[i - 1] == course_index[i] && p <= placement[i - 1].period))
+	continue;
+      seen_class.assign(seen_class.size(),false);
+      for (r = 1; r <= p_in->Rooms(); r++)
+	{
+	  unsigned cl = 2 * room_class[r] + (occupation[p][r] > 0);
+	  if (seen_class[cl])
+	    continue;
+	  seen_class[cl] = true;
+	  cd.cost = InsertionCost(i,p,r);
+	  if (!Pruned(cost + cd.cost + bound))
+	    {
+	      cd.period = p;
+	      cd.room = r;
+	      candidate.push_back(cd);
+	    }
+	}
+    }
+  sort(candidate.begin(),candidate.end());
+
+  for (j = 0; j < candidate.size(); j++)
+    {
+      if (Pruned(cost + candidate[j].cost + bound))
+	break;
+      placement[i].period = candidate[j].period;
+      placement[i].room = candidate[j].room;
+      Place(i,candidate[j].period,candidate[j].room,1);
+      Search(i + 1,cost + candidate[j].cost);
+      Place(i,candidate[j].period,candidate[j].room,-1);
+    }
+}
@@ -8,16 +8,26 @@
 
 using namespace easylocal;
 
+const unsigned ROOM_WORD_BITS = 8 * sizeof(unsigned long);
+
 class TT_State : public Timetable
 {  friend ostream& operator<<(ostream&, const TT_State&);
 public:
-  TT_State(Faculty *f = NULL) : Timetable(f) {}
+  TT_State(Faculty *f = NULL) : Timetable(f), hash(0) {}
 
   unsigned RoomLectures(unsigned i, unsigned j) const 
           { return room_lectures[i][j]; }
-  void ResetRoomLectures(unsigned i, unsigned j) { room_lectures[i][j] = 0; }
-  void IncRoomLectures(unsigned i, unsigned j) { room_lectures[i][j]++; }
-  void DecRoomLectures(unsigned i, unsigned j) { room_lectures[i][j]--; }
+  void ResetRoomLectures(unsigned i, unsigned j) 
+    { room_lectures[i][j] = 0; SetFreeRoom(i,j,true); }
+  void IncRoomLectures(unsigned i, unsigned j) 
+    { if (room_lectures[i][j]++ == 0) SetFreeRoom(i,j,false); }
+  void DecRoomLectures(unsigned i, unsigned j) 
+    { if (--room_lectures[i][j] == 0) SetFreeRoom(i,j,true); }
+
+  // word w of the bitmap of the rooms free in period j (bit k refers to
+  // the room of capacity rank k)
+  unsigned long FreeRooms(unsigned j, unsigned w) const 
+    { return free_rooms[j][w]; }
 
   unsigned CourseDailyLectures(unsigned i, unsigned j) const 
     { return course_daily_lectures[i][j]; }
@@ -34,6 +44,32 @@ public:
   void IncWorkingDays(unsigned i) { working_days[i]++; }
   void DecWorkingDays(unsigned i) { working_days[i]--; }
 
+  // lectures, numbered course by course: lecture k is of course 
+  // LectureCourse(k) and takes place at period LecturePeriod(k)
+  unsigned Lectures() const { return lecture_course.size(); }
+  unsigned LectureCourse(unsigned k) const { return lecture_course[k]; }
+  unsigned LecturePeriod(unsigned k) const 
+    { unsigned i = lecture_course[k]; return period_order[i][k - first_lecture[i]]; }
+  unsigned LectureIndex(unsigned i, unsigned j) const 
+    { return first_lecture[i] + period_position[i][j]; }
+
+  // open periods of course i (free and available), in no particular order
+  unsigned OpenPeriods(unsigned i) const { return open_periods[i]; }
+  unsigned OpenPeriod(unsigned i, unsigned k) const 
+    { return period_order[i][CourseLectures(i) + k]; }
+  unsigned OpenPeriodIndex(unsigned i, unsigned j) const 
+    { return period_position[i][j] - CourseLectures(i); }
+
+  void IndexLectures();
+  void MoveLecture(unsigned i, unsigned from, unsigned to);
+
+  // Zobrist hash of the timetable: the xor of the keys of the lectures,
+  // updated at each change of the room of course i at period j
+  unsigned long Hash() const { return hash; }
+  void ResetHash() { hash = 0; }
+  void ToggleHash(unsigned i, unsigned j, unsigned r) 
+    { hash ^= ZobristKey(i,j,r); }
+
  protected:
   void Allocate();
 
@@ -42,6 +78,44 @@ public:
 
   vector<vector<unsigned> > course_daily_lectures; // number of lectures per course per day
   vector<unsigned> working_days; // number of days of lecture per course
+  vector<vector<unsigned long> > free_rooms; // free rooms per period (bitmaps, see FreeRooms)
+
+  // periods of each course, ordered as: the ones with a lecture, the 
+  // open ones, the others; period_position is the inverse permutation
+  vector<vector<unsigned> > period_order;
+  vector<vector<unsigned> > period_position;
+  vector<unsigned> open_periods;   // number of open periods per course
+  vector<unsigned> first_lecture;  // index of the first lecture per course
+  vector<unsigned> lecture_course; // course of each lecture
+  unsigned long hash; // see Hash
+
+  unsigned CourseLectures(unsigned i) const 
+    { return first_lecture[i+1] - first_lecture[i]; }
+  void SwapPeriods(unsigned i, unsigned k1, unsigned k2)
+  {
+    unsigned j1 = period_order[i][k1], j2 = period_order[i][k2];
+    period_order[i][k1] = j2; period_position[i][j2] = k1;
+    period_order[i][k2] = j1; period_position[i][j1] = k2;
+  }
+
+  // the key of the lecture of course i at period j in room r: the 
+  // triple is mixed instead of being looked up in a table of random keys
+  unsigned long ZobristKey(unsigned i, unsigned j, unsigned r) const
+  {
+    unsigned long x = ((i * fp->Periods() + j) * (fp->Rooms() + 1) + r) * 2654435761UL;
+    x = (x ^ (x >> 16)) * 0x45d9f3bUL;
+    x = (x ^ (x >> 16)) * 0x45d9f3bUL;
+    return x ^ (x >> 16);
+  }
+
+  void SetFreeRoom(unsigned i, unsigned j, bool free)
+  {
+    unsigned k = fp->CapacityRank(i);
+    if (free)
+      free_rooms[j][k / ROOM_WORD_BITS] |= 1UL << (k % ROOM_WORD_BITS);
+    else
+      free_rooms[j][k / ROOM_WORD_BITS] &= ~(1UL << (k % ROOM_WORD_BITS));
+  }
 };
 
 class TT_MoveTime
@@ -68,6 +142,20 @@ class TT_MoveRoom
   unsigned course, period, old_room, new_room;
 };
 
+// a move of either neighborhood (the union of the two)
+class TT_MoveTimeRoom
+{
+  friend ostream& operator<<(ostream& os, const TT_MoveTimeRoom& c);
+  friend istream& operator>>(istream& is, TT_MoveTimeRoom& c);
+ public:
+  TT_MoveTimeRoom();
+  bool operator==(const TT_MoveTimeRoom&) const;
+  bool operator!=(const TT_MoveTimeRoom&) const;
+  bool time; // whether it is a time move (or a room one)
+  TT_MoveTime time_move;
+  TT_MoveRoom room_move;
+};
+
 /***************************************************************************
  * State Manager 
  ***************************************************************************/
@@ -77,33 +165,59 @@ class TT_StateManager : public StateManager<Faculty,TT_State>
 public:
   TT_StateManager(Faculty*);
   void RandomState(TT_State&);   // mustdef 
+  void GreedyState(TT_State&);   // mayredef 
+  void RandomState(TT_State&, FastRandom&);   // mayredef 
+  void GreedyState(TT_State&, FastRandom&);   // mayredef 
 protected:
   fvalue Violations(const TT_State& as) const;   // mayredef 
   fvalue Objective(const TT_State& as) const;    // mayredef 
+  unsigned long StateHash(const TT_State& as) const; // mayredef 
 
-  void UpdateRedundantStateData(TT_State& as) const;  // mayredef 
+  void UpdateRedundantStateData(TT_State& as);  // mayredef 
   void ResetState(TT_State& as);
 
   unsigned Conflitcs(const TT_State& as) const;
   unsigned RoomOccupation(const TT_State& as) const;
   unsigned RoomCapacity(const TT_State& as) const;
   unsigned MinWorkingDays(const TT_State& as) const;
-
-
+private:
+  // state builders drawing from rng (FastRandom or StandardRandom)
+  template <class Generator>
+  void BuildRandomState(TT_State& as, Generator& rng);
+  template <class Generator>
+  void BuildGreedyState(TT_State& as, Generator& rng);
 }; 
 
 /***************************************************************************
  * Time Neighborhood Explorer:
  ***************************************************************************/
 
+class TT_TimeTabuListManager;
+
 class TT_TimeNeighborhoodExplorer
-  : public NeighborhoodExplorer<Faculty,TT_State,TT_MoveTime> 
+  : public StaticNeighborhoodExplorer<Faculty,TT_State,TT_MoveTime,
+				      TT_TimeNeighborhoodExplorer,TT_TimeTabuListManager> 
 {
+  friend class StaticNeighborhoodExplorer<Faculty,TT_State,TT_MoveTime,
+					  TT_TimeNeighborhoodExplorer,TT_TimeTabuListManager>;
+  friend class TT_TimeRoomNeighborhoodExplorer;
 public:
   TT_TimeNeighborhoodExplorer(StateManager<Faculty,TT_State>*, Faculty*);
   void RandomMove(const TT_State&, TT_MoveTime&);          // mustdef 
+  // random move drawn from rng (FastRandom or StandardRandom)
+  template <class Generator>
+  void RandomMove(const TT_State&, TT_MoveTime&, Generator& rng) const;
   bool FeasibleMove(const TT_State&, const TT_MoveTime&);  // mayredef 
   void MakeMove(TT_State&,const TT_MoveTime&);             // mustdef 
+  fvalue BestMove(const TT_State&, TT_MoveTime&);          // mayredef 
+  fvalue BestNonProhibitedMove(const TT_State&, TT_MoveTime&,
+			       fvalue curr, fvalue best);  // mayredef 
+  void BatchDeltaCostFunction(const TT_State&, const TT_MoveTime[],
+			      unsigned n, fvalue[]);      // mayredef 
+
+  // deltas of the moves of the lecture (c,from) towards every period
+  void DeltaCostRow(const TT_State& as, unsigned c, unsigned from,
+		    vector<int>& delta);
 protected:
   fvalue DeltaViolations(const TT_State&, const TT_MoveTime&); // mayredef 
   fvalue DeltaObjective(const TT_State&, const TT_MoveTime&);  // mayredef 
@@ -114,33 +228,83 @@ protected:
   void NextMove(const TT_State&,TT_MoveTime&);   // mustdef 
 private:
   void AnyNextMove(const TT_State&,TT_MoveTime&);
-  void AnyRandomMove(const TT_State&, TT_MoveTime&);
+  bool FreePeriod(const TT_State& as, unsigned c, unsigned p) const
+  { return as(c,p) == 0 && p_in->Available(c,p); }
+
+  void ComputePeriodConflicts(const TT_State& as, unsigned c);
+  void RowDeltas(const TT_State& as, unsigned c, unsigned from,
+		 vector<int>& delta) const;
+  fvalue ScanRows(const TT_State& as, TT_MoveTime& mv, bool prohibition,
+		  fvalue curr, fvalue best);
+
+  // row kernel buffers (one entry per period)
+  vector<int> period_conflicts; // lectures of conflicting courses
+  vector<int> row_delta;        // deltas of the row being scanned
 };
   
 /***************************************************************************
  * Time Tabu List Manager:
  ***************************************************************************/
 class TT_TimeTabuListManager
-  : public TabuListManager<TT_MoveTime> 
+  : public StaticTabuListManager<TT_MoveTime,TT_TimeTabuListManager> 
 {
+  friend class StaticTabuListManager<TT_MoveTime,TT_TimeTabuListManager>;
 public:
   TT_TimeTabuListManager(int min = 0, int max = 0);
+  void Clean();                                              // mayredef 
 protected:
   bool Inverse(const TT_MoveTime&,const TT_MoveTime&) const; // mustdef 
+  bool ListMember(const TT_MoveTime&) const;                 // mayredef 
+  void InsertIntoList(const TT_MoveTime&);                   // mayredef 
 private:
+  // prohibitions, as iteration (plus one) of expiry per course and period
+  vector<vector<unsigned long> > placed;  // lectures moved into the period
+  vector<vector<unsigned long> > vacated; // lectures moved out of the period
+}; 
+
+/***************************************************************************
+ * Time Frequency Manager:
+ ***************************************************************************/
+class TT_TimeFrequencyManager
+  : public FrequencyManager<TT_MoveTime> 
+{
+public:
+  TT_TimeFrequencyManager(Faculty* pin, fvalue w);
+  void InsertMove(const TT_MoveTime&);       // mustdef 
+  fvalue Penalty(const TT_MoveTime&) const;  // mustdef 
+  void Clean();                              // mustdef 
+private:
+  Faculty* p_in;
+  fvalue weight;       // penalty of a period taken by every move 
+  unsigned long moves; // moves recorded
+  vector<unsigned long> frequency; // moves into each (course, period)
 }; 
  
 /***************************************************************************
  * Room Neighborhood Explorer:
  ***************************************************************************/
+class TT_RoomTabuListManager;
+
 class TT_RoomNeighborhoodExplorer
-  : public NeighborhoodExplorer<Faculty,TT_State,TT_MoveRoom> 
+  : public StaticNeighborhoodExplorer<Faculty,TT_State,TT_MoveRoom,
+				      TT_RoomNeighborhoodExplorer,TT_RoomTabuListManager> 
 {
+  friend class StaticNeighborhoodExplorer<Faculty,TT_State,TT_MoveRoom,
+					  TT_RoomNeighborhoodExplorer,TT_RoomTabuListManager>;
+  friend class TT_TimeRoomNeighborhoodExplorer;
 public:
   TT_RoomNeighborhoodExplorer(StateManager<Faculty,TT_State>*, Faculty*);
   void RandomMove(const TT_State&, TT_MoveRoom&);        // mustdef 
+  // random move drawn from rng (FastRandom or StandardRandom)
+  template <class Generator>
+  void RandomMove(const TT_State&, TT_MoveRoom&, Generator& rng) const;
   bool FeasibleMove(const TT_State&, const TT_MoveRoom&);// mayredef 
   void MakeMove(TT_State&,const TT_MoveRoom&);           // mustdef 
+  fvalue BestMove(const TT_State&, TT_MoveRoom&);        // mayredef 
+  fvalue BestNonProhibitedMove(const TT_State&, TT_MoveRoom&,
+			       fvalue curr, fvalue best); // mayredef 
+  void BatchDeltaCostFunction(const TT_State&, const TT_MoveRoom[],
+			      unsigned n, fvalue[]);     // mayredef 
 protected:
   fvalue DeltaViolations(const TT_State&, const TT_MoveRoom&); // mayredef 
   fvalue DeltaObjective(const TT_State&, const TT_MoveRoom&);  // mayredef 
@@ -149,19 +313,77 @@ protected:
   int DeltaRoomCapacity(const TT_State& as, const TT_MoveRoom& mv) const;
 
   void NextMove(const TT_State&, TT_MoveRoom&);  // mustdef 
+private:
+  unsigned FirstRoom(const TT_State& as, unsigned p, unsigned lo, unsigned hi,
+		     bool free, unsigned skip) const;
+  unsigned CandidateRooms(const TT_State& as, unsigned c, unsigned p,
+			  unsigned candidate[]) const;
+  fvalue ScanLectures(const TT_State& as, TT_MoveRoom& mv, bool prohibition,
+		      fvalue curr, fvalue best);
 };
   
 /***************************************************************************
  * Room Tabu List Manager:
  ***************************************************************************/
 class TT_RoomTabuListManager
-  : public TabuListManager<TT_MoveRoom> 
+  : public StaticTabuListManager<TT_MoveRoom,TT_RoomTabuListManager> 
 {
+  friend class StaticTabuListManager<TT_MoveRoom,TT_RoomTabuListManager>;
 public:
   TT_RoomTabuListManager(int min = 0, int max = 0);
+  void Clean();                                              // mayredef 
 protected:
   bool Inverse(const TT_MoveRoom&,const TT_MoveRoom&) const; // mustdef 
+  bool ListMember(const TT_MoveRoom&) const;                 // mayredef 
+  void InsertIntoList(const TT_MoveRoom&);                   // mayredef 
+private:
+  // prohibitions, as iteration (plus one) of expiry per course and period
+  vector<vector<unsigned long> > changed; // lectures whose room was changed
 }; 
+
+/***************************************************************************
+ * Room Frequency Manager:
+ ***************************************************************************/
+class TT_RoomFrequencyManager
+  : public FrequencyManager<TT_MoveRoom> 
+{
+public:
+  TT_RoomFrequencyManager(Faculty* pin, fvalue w);
+  void InsertMove(const TT_MoveRoom&);       // mustdef 
+  fvalue Penalty(const TT_MoveRoom&) const;  // mustdef 
+  void Clean();                              // mustdef 
+private:
+  Faculty* p_in;
+  fvalue weight;       // penalty of a room taken by every move 
+  unsigned long moves; // moves recorded
+  vector<unsigned long> frequency; // moves into each (course, room)
+}; 
+
+/***************************************************************************
+ * Time/Room Neighborhood Explorer:
+ ***************************************************************************/
+class TT_TimeRoomNeighborhoodExplorer
+  : public NeighborhoodExplorer<Faculty,TT_State,TT_MoveTimeRoom> 
+{
+public:
+  TT_TimeRoomNeighborhoodExplorer(StateManager<Faculty,TT_State>*, 
+				  TT_TimeNeighborhoodExplorer*,
+				  TT_RoomNeighborhoodExplorer*, Faculty*);
+  void RandomMove(const TT_State&, TT_MoveTimeRoom&);         // mustdef 
+  template <class Generator>
+  void RandomMove(const TT_State&, TT_MoveTimeRoom&, Generator& rng) const;
+  bool FeasibleMove(const TT_State&, const TT_MoveTimeRoom&); // mayredef 
+  void MakeMove(TT_State&,const TT_MoveTimeRoom&);            // mustdef 
+  fvalue DeltaCostFunction(const TT_State&, const TT_MoveTimeRoom&); // mayredef 
+protected:
+  fvalue DeltaViolations(const TT_State&, const TT_MoveTimeRoom&); // mayredef 
+  fvalue DeltaObjective(const TT_State&, const TT_MoveTimeRoom&);  // mayredef 
+  void NextMove(const TT_State&, TT_MoveTimeRoom&);  // mustdef 
+private:
+  void FirstLectureMove(const TT_State& as, unsigned k, TT_MoveTimeRoom& mv) const;
+  TT_TimeNeighborhoodExplorer* p_tnhe;
+  TT_RoomNeighborhoodExplorer* p_rnhe;
+};
  
 /***************************************************************************
  * Output Manager:
@@ -200,23 +422,24 @@ public:
  * Time Tabu Search Runner:
  ***************************************************************************/
 class TT_TimeTabuSearch
-  : public TabuSearch<Faculty,TT_State,TT_MoveTime> 
+  : public StaticTabuSearch<Faculty,TT_State,TT_MoveTime,
+			    TT_TimeNeighborhoodExplorer,TT_TimeTabuListManager> 
 {
 public:
   TT_TimeTabuSearch(StateManager<Faculty,TT_State>* psm,
-		NeighborhoodExplorer<Faculty,TT_State,TT_MoveTime>* pnhe, 
-		TabuListManager<TT_MoveTime>* ptlm, Faculty* pin);
+		TT_TimeNeighborhoodExplorer* pnhe, 
+		TT_TimeTabuListManager* ptlm, Faculty* pin);
 };
 
 /***************************************************************************
  * Time Hill Climbing Runner:
  ***************************************************************************/
 class TT_TimeHillClimbing
-  : public HillClimbing<Faculty,TT_State,TT_MoveTime> 
+  : public StaticHillClimbing<Faculty,TT_State,TT_MoveTime,TT_TimeNeighborhoodExplorer> 
 {
 public:
   TT_TimeHillClimbing(StateManager<Faculty,TT_State>* psm,
-		       NeighborhoodExplorer<Faculty,TT_State,TT_MoveTime>* pnhe,
+		       TT_TimeNeighborhoodExplorer* pnhe,
 		       Faculty* pin);
 };
 
@@ -224,26 +447,233 @@ public:
  * Room Tabu Search Runner:
  ***************************************************************************/
 class TT_RoomTabuSearch
-  : public TabuSearch<Faculty,TT_State,TT_MoveRoom> 
+  : public StaticTabuSearch<Faculty,TT_State,TT_MoveRoom,
+			    TT_RoomNeighborhoodExplorer,TT_RoomTabuListManager> 
 {
 public:
   TT_RoomTabuSearch(StateManager<Faculty,TT_State>* psm,
-		NeighborhoodExplorer<Faculty,TT_State,TT_MoveRoom>* pnhe, 
-		TabuListManager<TT_MoveRoom>* ptlm, Faculty* pin);
+		TT_RoomNeighborhoodExplorer* pnhe, 
+		TT_RoomTabuListManager* ptlm, Faculty* pin);
 };
  
 /***************************************************************************
  * Room Hill Climbing Runner:
  ***************************************************************************/
 class TT_RoomHillClimbing
-  : public HillClimbing<Faculty,TT_State,TT_MoveRoom> 
+  : public StaticHillClimbing<Faculty,TT_State,TT_MoveRoom,TT_RoomNeighborhoodExplorer> 
 {
 public:
   TT_RoomHillClimbing(StateManager<Faculty,TT_State>* psm,
-		       NeighborhoodExplorer<Faculty,TT_State,TT_MoveRoom>* pnhe,
+		       TT_RoomNeighborhoodExplorer* pnhe,
 		       Faculty* pin);
 };
 
+/***************************************************************************
+ * Time Reactive Tabu Search Runner:
+ ***************************************************************************/
+class TT_TimeReactiveTabuSearch
+  : public ReactiveTabuSearch<Faculty,TT_State,TT_MoveTime> 
+{
+public:
+  TT_TimeReactiveTabuSearch(StateManager<Faculty,TT_State>* psm,
+			    TT_TimeNeighborhoodExplorer* pnhe, 
+			    TT_TimeTabuListManager* ptlm, Faculty* pin);
+};
+
+/***************************************************************************
+ * Room Reactive Tabu Search Runner:
+ ***************************************************************************/
+class TT_RoomReactiveTabuSearch
+  : public ReactiveTabuSearch<Faculty,TT_State,TT_MoveRoom> 
+{
+public:
+  TT_RoomReactiveTabuSearch(StateManager<Faculty,TT_State>* psm,
+			    TT_RoomNeighborhoodExplorer* pnhe, 
+			    TT_RoomTabuListManager* ptlm, Faculty* pin);
+};
+
+/***************************************************************************
+ * Time Simulated Annealing Runner:
+ ***************************************************************************/
+class TT_TimeSimulatedAnnealing
+  : public StaticSimulatedAnnealing<Faculty,TT_State,TT_MoveTime,TT_TimeNeighborhoodExplorer> 
+{
+public:
+  TT_TimeSimulatedAnnealing(StateManager<Faculty,TT_State>* psm,
+			    TT_TimeNeighborhoodExplorer* pnhe,
+			    Faculty* pin);
+};
+
+/***************************************************************************
+ * Room Simulated Annealing Runner:
+ ***************************************************************************/
+class TT_RoomSimulatedAnnealing
+  : public StaticSimulatedAnnealing<Faculty,TT_State,TT_MoveRoom,TT_RoomNeighborhoodExplorer> 
+{
+public:
+  TT_RoomSimulatedAnnealing(StateManager<Faculty,TT_State>* psm,
+			    TT_RoomNeighborhoodExplorer* pnhe,
+			    Faculty* pin);
+};
+
+/***************************************************************************
+ * Time/Room Simulated Annealing Runner:
+ ***************************************************************************/
+class TT_TimeRoomSimulatedAnnealing
+  : public StaticSimulatedAnnealing<Faculty,TT_State,TT_MoveTimeRoom,
+				    TT_TimeRoomNeighborhoodExplorer> 
+{
+public:
+  TT_TimeRoomSimulatedAnnealing(StateManager<Faculty,TT_State>* psm,
+				TT_TimeRoomNeighborhoodExplorer* pnhe,
+				Faculty* pin);
+};
+
+/***************************************************************************
+ * Time Late Acceptance Hill Climbing Runner:
+ ***************************************************************************/
+class TT_TimeLateAcceptance
+  : public StaticLateAcceptanceHillClimbing<Faculty,TT_State,TT_MoveTime,TT_TimeNeighborhoodExplorer> 
+{
+public:
+  TT_TimeLateAcceptance(StateManager<Faculty,TT_State>* psm,
+			TT_TimeNeighborhoodExplorer* pnhe,
+			Faculty* pin);
+};
+
+/***************************************************************************
+ * Room Late Acceptance Hill Climbing Runner:
+ ***************************************************************************/
+class TT_RoomLateAcceptance
+  : public StaticLateAcceptanceHillClimbing<Faculty,TT_State,TT_MoveRoom,TT_RoomNeighborhoodExplorer> 
+{
+public:
+  TT_RoomLateAcceptance(StateManager<Faculty,TT_State>* psm,
+			TT_RoomNeighborhoodExplorer* pnhe,
+			Faculty* pin);
+};
+
+/***************************************************************************
+ * Time/Room Late Acceptance Hill Climbing Runner:
+ ***************************************************************************/
+class TT_TimeRoomLateAcceptance
+  : public StaticLateAcceptanceHillClimbing<Faculty,TT_State,TT_MoveTimeRoom,
+					    TT_TimeRoomNeighborhoodExplorer> 
+{
+public:
+  TT_TimeRoomLateAcceptance(StateManager<Faculty,TT_State>* psm,
+			    TT_TimeRoomNeighborhoodExplorer* pnhe,
+			    Faculty* pin);
+};
+
+/***************************************************************************
+ * Time Great Deluge Runner:
+ ***************************************************************************/
+class TT_TimeGreatDeluge
+  : public StaticGreatDeluge<Faculty,TT_State,TT_MoveTime,TT_TimeNeighborhoodExplorer> 
+{
+public:
+  TT_TimeGreatDeluge(StateManager<Faculty,TT_State>* psm,
+		     TT_TimeNeighborhoodExplorer* pnhe,
+		     Faculty* pin);
+};
+
+/***************************************************************************
+ * Room Great Deluge Runner:
+ ***************************************************************************/
+class TT_RoomGreatDeluge
+  : public StaticGreatDeluge<Faculty,TT_State,TT_MoveRoom,TT_RoomNeighborhoodExplorer> 
+{
+public:
+  TT_RoomGreatDeluge(StateManager<Faculty,TT_State>* psm,
+		     TT_RoomNeighborhoodExplorer* pnhe,
+		     Faculty* pin);
+};
+
+/***************************************************************************
+ * Time/Room Great Deluge Runner:
+ ***************************************************************************/
+class TT_TimeRoomGreatDeluge
+  : public StaticGreatDeluge<Faculty,TT_State,TT_MoveTimeRoom,
+			     TT_TimeRoomNeighborhoodExplorer> 
+{
+public:
+  TT_TimeRoomGreatDeluge(StateManager<Faculty,TT_State>* psm,
+			 TT_TimeRoomNeighborhoodExplorer* pnhe,
+			 Faculty* pin);
+};
+
+/***************************************************************************
+ * Time Parallel Tempering Runner:
+ ***************************************************************************/
+class TT_TimeParallelTempering
+  : public ParallelTempering<Faculty,TT_State,TT_MoveTime,TT_TimeNeighborhoodExplorer> 
+{
+public:
+  TT_TimeParallelTempering(StateManager<Faculty,TT_State>* psm,
+			   TT_TimeNeighborhoodExplorer* pnhe,
+			   Faculty* pin);
+};
+
+/***************************************************************************
+ * Room Parallel Tempering Runner:
+ ***************************************************************************/
+class TT_RoomParallelTempering
+  : public ParallelTempering<Faculty,TT_State,TT_MoveRoom,TT_RoomNeighborhoodExplorer> 
+{
+public:
+  TT_RoomParallelTempering(StateManager<Faculty,TT_State>* psm,
+			   TT_RoomNeighborhoodExplorer* pnhe,
+			   Faculty* pin);
+};
+
+/***************************************************************************
+ * Time/Room Parallel Tempering Runner:
+ ***************************************************************************/
+class TT_TimeRoomParallelTempering
+  : public ParallelTempering<Faculty,TT_State,TT_MoveTimeRoom,
+			     TT_TimeRoomNeighborhoodExplorer> 
+{
+public:
+  TT_TimeRoomParallelTempering(StateManager<Faculty,TT_State>* psm,
+			       TT_TimeRoomNeighborhoodExplorer* pnhe,
+			       Faculty* pin);
+};
+
+/***************************************************************************
+ * Room Matching Runner:
+ * the rooms of the lectures of each period are an optimal assignment 
+ * (Hungarian method) for room capacity and room occupation, which are 
+ * the only components of the cost that depend on the rooms. The 
+ * periods are independent, and they are solved by parallel threads.
+ ***************************************************************************/
+class TT_RoomMatching
+  : public MoveRunner<Faculty,TT_State,TT_MoveRoom>
+{
+public:
+  TT_RoomMatching(StateManager<Faculty,TT_State>*, TT_RoomNeighborhoodExplorer*, Faculty*);
+  void Go();
+  void ReadParameters();
+  void SetParameters(const ParameterBox& pb);
+  void Print(ostream& os = cout) const;
+protected:
+  bool StopCriterion() { return true; }
+  void SelectMove() {}
+  struct Worker
+  {
+    TT_RoomMatching* runner;
+    unsigned first, step; // the worker assigns the periods first, first + step, ...
+  };
+  static void* WorkerThread(void*);
+  // the time of the run is over, or a stop has been requested (safe for 
+  // the workers, unlike TimeExpired)
+  bool Interrupted() const 
+    { return (end_time > 0 && WallClock::Now() >= end_time) || StopRequest::Pending(); }
+  void AssignRooms(unsigned p);
+  unsigned threads;
+  vector<vector<unsigned> > period_rooms; // new room of each course, per period
+};
+
 /***************************************************************************
  * The Token Ring Solver
  ***************************************************************************/
@@ -256,4 +686,308 @@ public:
 		    Faculty*,Timetable*);
 }; 
 
+/***************************************************************************
+ * A set of runners of all kinds (named as the ones of main), with their 
+ * own neighborhood explorers and tabu lists, so that they can run in a 
+ * thread of their own
+ ***************************************************************************/
+class TT_RunnerSet
+{
+public:
+  TT_RunnerSet(StateManager<Faculty,TT_State>*, Faculty*);
+  const vector<Runner<Faculty,TT_State>*>& Runners() const { return all_runners; }
+protected:
+  TT_TimeTabuListManager ttlm;
+  TT_TimeNeighborhoodExplorer tnhe;
+  TT_RoomTabuListManager rtlm;
+  TT_RoomNeighborhoodExplorer rnhe;
+  TT_TimeRoomNeighborhoodExplorer trnhe;
+  TT_TimeHillClimbing thc;
+  TT_TimeTabuSearch tts;
+  TT_RoomHillClimbing rhc;
+  TT_RoomTabuSearch rts;
+  TT_TimeReactiveTabuSearch trts;
+  TT_RoomReactiveTabuSearch rrts;
+  TT_TimeSimulatedAnnealing tsa;
+  TT_RoomSimulatedAnnealing rsa;
+  TT_TimeRoomSimulatedAnnealing trsa;
+  TT_TimeLateAcceptance tla;
+  TT_RoomLateAcceptance rla;
+  TT_TimeRoomLateAcceptance trla;
+  TT_TimeGreatDeluge tgd;
+  TT_RoomGreatDeluge rgd;
+  TT_TimeRoomGreatDeluge trgd;
+  TT_TimeParallelTempering tpt;
+  TT_RoomParallelTempering rpt;
+  TT_TimeRoomParallelTempering trpt;
+  TT_RoomMatching rm;
+  vector<Runner<Faculty,TT_State>*> all_runners;
+}; 
+
+/***************************************************************************
+ * A worker of the parallel multi-start of the token ring solver: it runs
+ * the runners of its own set, and delivers its output to its own 
+ * timetable
+ ***************************************************************************/
+class TT_TokenRingWorker
+  : public TT_TokenRingSolver
+{
+public:
+  TT_TokenRingWorker(StateManager<Faculty,TT_State>*,
+		     OutputManager<Faculty,Timetable,TT_State>*,
+		     Faculty*);
+  void SetInput(Faculty*);
+  const vector<Runner<Faculty,TT_State>*>& Runners() const { return runner_set.Runners(); }
+protected:
+  TT_RunnerSet runner_set;
+  Timetable timetable;
+}; 
+
+/***************************************************************************
+ * The Concurrent Comparative Solver (portfolio): the runners must have 
+ * their own neighborhood explorers, since the explorers keep cached data,
+ * hence the i-th runner is taken from the i-th of its sets (and the 
+ * runners beyond the sets are dropped)
+ ***************************************************************************/
+class TT_ConcurrentComparativeSolver
+  : public ConcurrentComparativeSolver<Faculty,Timetable,TT_State> 
+{
+public:
+  TT_ConcurrentComparativeSolver(StateManager<Faculty,TT_State>*,
+				 OutputManager<Faculty,Timetable,TT_State>*,
+				 Faculty*,Timetable*,unsigned sets = 8);
+  ~TT_ConcurrentComparativeSolver();
+  unsigned RunnerSets() const { return runner_sets.size(); }
+  const vector<Runner<Faculty,TT_State>*>& Runners(unsigned i) const 
+    { return runner_sets[i]->Runners(); }
+protected:
+  void Run();
+  vector<TT_RunnerSet*> runner_sets;
+}; 
+
+/***************************************************************************
+ * The Island Model Solver: the islands are token rings of time and room 
+ * runners, each one with its own neighborhood explorers and generator;
+ * island k starts its rounds from its k-th runner, and stops after one 
+ * or two idle rounds (for even and odd k)
+ ***************************************************************************/
+class TT_IslandModelSolver
+  : public IslandModelSolver<Faculty,Timetable,TT_State> 
+{
+public:
+  TT_IslandModelSolver(StateManager<Faculty,TT_State>*,
+		       OutputManager<Faculty,Timetable,TT_State>*,
+		       Faculty*,Timetable*,unsigned islands = 4);
+  ~TT_IslandModelSolver();
+  unsigned NumberOfIslands() const { return token_rings.size(); }
+  TT_TokenRingWorker* IslandSolver(unsigned i) const { return token_rings[i]; }
+protected:
+  void Run();
+  vector<TT_TokenRingWorker*> token_rings;
+}; 
+
+/***************************************************************************
+ * The Process Pool Solver: the workers are processes that run a token 
+ * ring with different seeds, and publish their best timetables to an 
+ * incumbent in shared memory; the token ring has its own runners
+ ***************************************************************************/
+class TT_ProcessPoolSolver
+  : public ProcessPoolSolver<Faculty,Timetable,TT_State> 
+{
+public:
+  TT_ProcessPoolSolver(StateManager<Faculty,TT_State>*,
+		       OutputManager<Faculty,Timetable,TT_State>*,
+		       Faculty*,Timetable*);
+  void SetInput(Faculty*);
+  TT_TokenRingWorker* Worker() { return &worker; }
+protected:
+  TT_TokenRingWorker worker;
+}; 
+
+/***************************************************************************
+ * Iterated Local Search Solver:
+ * the kicks move, with a given probability, a lecture involved in a 
+ * conflict, a room occupation or a room capacity violation (chosen at
+ * random), and otherwise a random one.
+ ***************************************************************************/
+class TT_IteratedLocalSearch
+  : public IteratedLocalSearch<Faculty,Timetable,TT_State,TT_MoveTimeRoom> 
+{
+public:
+  TT_IteratedLocalSearch(StateManager<Faculty,TT_State>*,
+			 OutputManager<Faculty,Timetable,TT_State>*,
+			 TT_TimeRoomNeighborhoodExplorer*,
+			 Faculty*,Timetable*);
+  void SetTargetedRate(double r) { targeted_rate = r; }
+protected:
+  void SelectKickMove(const TT_State&, TT_MoveTimeRoom&);
+  bool HardViolated(const TT_State&, unsigned c, unsigned p) const;
+  double targeted_rate; // probability of a targeted kick move
+  vector<unsigned> hard_lectures, soft_lectures; // violated lectures (buffers)
+};
+
+/***************************************************************************
+ * Variable Neighborhood Search Solver:
+ * descent in the time neighborhood, then in the room one
+ ***************************************************************************/
+class TT_VariableNeighborhoodSearch
+  : public VariableNeighborhoodSearch<Faculty,Timetable,TT_State> 
+{
+public:
+  TT_VariableNeighborhoodSearch(StateManager<Faculty,TT_State>*,
+				OutputManager<Faculty,Timetable,TT_State>*,
+				TT_TimeNeighborhoodExplorer*,
+				TT_RoomNeighborhoodExplorer*,
+				Faculty*,Timetable*);
+protected:
+  MoveNeighborhood<Faculty,TT_State,TT_MoveTime> time_neighborhood;
+  MoveNeighborhood<Faculty,TT_State,TT_MoveRoom> room_neighborhood;
+};
+
+/***************************************************************************
+ * Large Neighborhood Search Solver:
+ * the lectures of a curriculum, of a teacher, of a day, or of a course 
+ * and of the courses in conflict with it (at most max_lectures of them,
+ * drawn at random) are removed, and they are put back optimally by a
+ * branch and bound over their periods and rooms (exact unless it 
+ * explores more than max_nodes nodes)
+ ***************************************************************************/
+class TT_LargeNeighborhoodSearch
+  : public LargeNeighborhoodSearch<Faculty,Timetable,TT_State> 
+{
+public:
+  enum { CURRICULUM, TEACHER, DAY, CONFLICTS, METHODS };
+  TT_LargeNeighborhoodSearch(StateManager<Faculty,TT_State>*,
+			     OutputManager<Faculty,Timetable,TT_State>*,
+			     Faculty*,Timetable*);
+  void SetMaxLectures(unsigned n) { max_lectures = n; }
+  void SetMaxNodes(unsigned long n) { max_nodes = n; }
+protected:
+  fvalue DestroyAndRepair(TT_State&, unsigned int method);
+  void Destroy(const TT_State&, unsigned int method);
+  void InitializeRepair(const TT_State&);
+  bool Allowed(unsigned i, unsigned p) const;
+  fvalue InsertionCost(unsigned i, unsigned p, unsigned r) const;
+  fvalue MinInsertionCost(unsigned i) const;
+  void Place(unsigned i, unsigned p, unsigned r, int sign);
+  void Search(unsigned i, fvalue cost);
+  // a partial placement of the given cost (plus bound) cannot lead to a 
+  // new best one: placements as good as the removed one are looked for 
+  // only until one different from it is found
+  bool Pruned(fvalue cost) const 
+    { return cost > best_cost || (cost == best_cost && best_differs); }
+
+  struct Lecture
+  {
+    unsigned course, period, room;
+    bool operator<(const Lecture& l) const 
+    { return course < l.course || (course == l.course && period < l.period); }
+    bool operator==(const Lecture& l) const 
+    { return course == l.course && period == l.period && room == l.room; }
+  };
+  struct Candidate
+  {
+    fvalue cost;
+    unsigned period, room;
+    bool operator<(const Candidate& c) const { return cost < c.cost; }
+  };
+  unsigned max_lectures;
+  unsigned long max_nodes, nodes;
+  // the lectures removed (ordered by course and period), their current
+  // and best placement, and the index of their course among the removed ones
+  vector<Lecture> removed, placement, best_placement;
+  vector<unsigned> course_index;
+  vector<unsigned> courses; // the courses of the removed lectures
+  fvalue best_cost;
+  bool best_differs; // the best placement is not the removed one
+  // data of the state without the removed lectures (plus the placed ones):
+  // lectures per course and period, lectures per course and day, working
+  // days per course, lectures in conflict per course and period, and
+  // lectures per period and room (for the courses of the removed lectures)
+  vector<vector<int> > busy, daily, conflicts, occupation;
+  vector<int> working_days;
+  vector<unsigned> room_class; // rooms with the same class are equivalent
+  vector<bool> seen_class;
+};
+
+/***************************************************************************
+ * Random moves without rejection: a lecture is drawn among all of them, 
+ * then its new period among the open ones of the course, or its new 
+ * room among the other ones (or a new period or room, for the union). 
+ * Only the lectures of a course without open periods are drawn again, 
+ * for time moves.
+ * Preconditions: the state has at least one lecture, some course with a 
+ * lecture has an open period (for time moves) and there are at least two
+ * rooms (for room moves). They are asserted; without assertions, a move 
+ * that FeasibleMove rejects is returned when the neighborhood is empty, 
+ * that is, a time move to the same period or a room move to the same room.
+ ***************************************************************************/
+
+template <class Generator>
+void TT_TimeNeighborhoodExplorer::RandomMove(const TT_State& as, TT_MoveTime& mv, 
+					     Generator& rng) const
+{
+  assert(as.Lectures() > 0);
+  unsigned k = rng.Uniform(0,as.Lectures() - 1), n;
+  for (n = 1; as.OpenPeriods(as.LectureCourse(k)) == 0 && n < as.Lectures(); n++)
+    k = rng.Uniform(0,as.Lectures() - 1);
+  // after as many failed draws as lectures, the lectures are scanned
+  for (n = 0; as.OpenPeriods(as.LectureCourse(k)) == 0 && n < as.Lectures(); n++)
+    k = (k + 1) % as.Lectures();
+  mv.course = as.LectureCourse(k);
+  mv.from = as.LecturePeriod(k);
+  if (as.OpenPeriods(mv.course) == 0)
+    { // no lecture can be moved
+      assert(false);
+      mv.to = mv.from;
+      return;
+    }
+  mv.to = as.OpenPeriod(mv.course,rng.Uniform(0,as.OpenPeriods(mv.course) - 1));
+}
+
+template <class Generator>
+void TT_RoomNeighborhoodExplorer::RandomMove(const TT_State& as, TT_MoveRoom& mv, 
+					     Generator& rng) const
+{
+  assert(as.Lectures() > 0);
+  unsigned k = rng.Uniform(0,as.Lectures() - 1);
+  mv.course = as.LectureCourse(k);
+  mv.period = as.LecturePeriod(k);
+  mv.old_room = as(mv.course,mv.period);
+  if (p_in->Rooms() < 2)
+    { // no other room
+      assert(false);
+      mv.new_room = mv.old_room;
+      return;
+    }
+  mv.new_room = rng.Uniform(1,p_in->Rooms() - 1);
+  if (mv.new_room >= mv.old_room)
+    mv.new_room++;
+}
+
+template <class Generator>
+void TT_TimeRoomNeighborhoodExplorer::RandomMove(const TT_State& as, TT_MoveTimeRoom& mv, 
+						 Generator& rng) const
+{
+  if (p_in->Rooms() < 2)
+    { // only time moves
+      mv.time = true;
+      p_tnhe->RandomMove(as,mv.time_move,rng);
+      return;
+    }
+  assert(as.Lectures() > 0);
+  unsigned k = rng.Uniform(0,as.Lectures() - 1);
+  unsigned c = as.LectureCourse(k), p = as.LecturePeriod(k);
+  unsigned j = rng.Uniform(0,as.OpenPeriods(c) + p_in->Rooms() - 2);
+  mv.time = j < as.OpenPeriods(c);
+  if (mv.time)
+    mv.time_move = TT_MoveTime(c,p,as.OpenPeriod(c,j));
+  else
+    {
+      mv.room_move = TT_MoveRoom(c,p,as(c,p),j - as.OpenPeriods(c) + 1);
+      if (mv.room_move.new_room >= mv.room_move.old_room)
+	mv.room_move.new_room++;
+    }
+}
+
 #endif
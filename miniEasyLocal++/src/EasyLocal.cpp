@@ -19,13 +19,28 @@
 */
 #include <ctime>
 #include <cstdlib>
+#include <cstring>
 #include <iostream>
+#include <csignal>
+#include <unistd.h>
+#include <sys/stat.h>
 #include <FlexLexer.h>
 
 #include "EasyLocal.h"
 
 namespace easylocal {
+
+  /** The generator Random draws from in the current thread (NULL for
+      rand()). */
+  static __thread FastRandom* thread_random = NULL;
+  /** Whether the current thread is one of several concurrent searches
+      (see SetConcurrentThread). */
+  static __thread bool thread_concurrent = false;
   
+  /** Initializes the random source of rand() with the clock. */
+  static void SeedRand()
+  { srand(time(0)); }
+
   /** 
       Uniform random generator, it picks an integer value in the range
       [i, j].
@@ -36,15 +51,331 @@ namespace easylocal {
   */
   int Random(int i, int j)
   { 
-    static bool init = false;
-    if (init == false)  // if the random source has not been 
-      {                 // initialized yet
-	srand(time(0)); // let's initialize it
-	init = true;
-      }
+    static pthread_once_t init = PTHREAD_ONCE_INIT;
+    if (thread_random != NULL) // the thread has its own generator
+      return thread_random->Uniform(i,j);
+    pthread_once(&init, SeedRand); // the random source is initialized
+				   // once, by the first thread
     return (rand() % (j - i + 1)) + i; // return the randomly picked value
   }
 
+  /**
+     Makes Random draw from the given generator in the calling thread
+     (e.g., a worker of a parallel solver that has to be reproducible,
+     since the sequence of rand() depends on the interleaving of the
+     threads).
+
+     @param rng the generator (NULL for going back to rand())
+     @return the previous generator of the thread
+  */
+  FastRandom* SetThreadRandom(FastRandom* rng)
+  { 
+    FastRandom* previous = thread_random;
+    thread_random = rng; 
+    return previous;
+  }
+
+  /**
+     Marks the calling thread as one of several searches that run at
+     the same time (a thread of a parallel solver, or a process of a
+     pool), so that the runners it performs do not start threads of
+     their own, which would only oversubscribe the processors.
+
+     @param concurrent whether the thread is a concurrent one
+  */
+  void SetConcurrentThread(bool concurrent)
+  { thread_concurrent = concurrent; }
+
+  /**
+     @return true if the calling thread has been marked as a concurrent
+     one by SetConcurrentThread
+  */
+  bool ConcurrentThread()
+  { return thread_concurrent; }
+
+  /**
+     Derives the seed of a worker (or of a task) from a master seed
+     by means of the splitmix64 mixing function, so that the seeds of
+     neighbouring indices are unrelated.
+
+     @param master the master seed
+     @param index the index of the worker
+     @return the seed (32 bits, never 0)
+  */
+  unsigned long DerivedSeed(unsigned long master, unsigned long index)
+  {
+    unsigned long long z = master + (index + 1) * 0x9E3779B97F4A7C15ULL;
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    z = (z ^ (z >> 31)) & 0xFFFFFFFFULL;
+    return z != 0 ? (unsigned long)z : 1;
+  }
+
+  /**
+     Sets the seed of the generator. The xorshift sequence never 
+     leaves 0, which is then replaced by a fixed value.
+
+     @param seed the seed (only the lower 32 bits are used)
+  */
+  void FastRandom::Seed(unsigned long seed)
+  {
+    x = seed & 0xFFFFFFFFUL;
+    if (x == 0)
+      x = 2463534242UL;
+  }
+
+  /**
+     Reads the monotonic clock of the system.
+
+     @return the current time in seconds, from an arbitrary origin
+  */
+  double WallClock::Now()
+  {
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec + t.tv_nsec * 1e-9;
+  }
+
+  volatile sig_atomic_t StopRequest::requested = 0;
+  std::string StopRequest::watched_file;
+  double StopRequest::watch_period = 0.5;
+  volatile int StopRequest::watching = 0;
+  pthread_t StopRequest::watcher;
+
+  /**
+     Makes SIGINT and SIGTERM request a stop of the search (the second
+     signal terminates the process, as usual).
+  */
+  void StopRequest::InstallHandlers()
+  {
+    signal(SIGINT, Handler);
+    signal(SIGTERM, Handler);
+  }
+
+  /**
+     The handler of the signals: it only sets the flag (or restores
+     the default action and raises the signal again, if the flag was 
+     already set).
+
+     @param sig the signal
+  */
+  void StopRequest::Handler(int sig)
+  {
+    if (__sync_fetch_and_or(&requested, 1) != 0)
+      {
+	signal(sig, SIG_DFL);
+	raise(sig);
+      }
+  }
+
+  /**
+     Starts a thread that requests a stop when the given control file 
+     changes, i.e., when it is created, removed, or modified with 
+     respect to its status at the time of the call.
+
+     @param file the name of the control file
+     @param period the time between two polls, in seconds
+  */
+  void StopRequest::WatchFile(const std::string& file, double period)
+  {
+    StopWatching();
+    watched_file = file;
+    watch_period = period;
+    __sync_lock_test_and_set(&watching, 1);
+    pthread_create(&watcher, NULL, WatcherThread, NULL);
+  }
+
+  /**
+     Stops the watcher thread of the control file, if it runs.
+  */
+  void StopRequest::StopWatching()
+  {
+    if (__sync_lock_test_and_set(&watching, 0) == 0)
+      return;
+    pthread_join(watcher, NULL);
+  }
+
+  /**
+     The body of the watcher thread: it polls the status of the control
+     file till it changes, or the watch is over.
+  */
+  void* StopRequest::WatcherThread(void* arg)
+  {
+    struct stat initial, current;
+    bool existed = stat(watched_file.c_str(), &initial) == 0;
+    while (__sync_fetch_and_or(&watching, 0) != 0)
+      {
+	usleep((useconds_t)(watch_period * 1e6));
+	bool exists = stat(watched_file.c_str(), &current) == 0;
+	if (exists != existed 
+	    || (exists && (current.st_mtim.tv_sec != initial.st_mtim.tv_sec 
+			   || current.st_mtim.tv_nsec != initial.st_mtim.tv_nsec
+			   || current.st_size != initial.st_size)))
+	  {
+	    Raise();
+	    break;
+	  }
+      }
+    return NULL;
+  }
+
+  /**
+     Requests a stop of the search.
+  */
+  void StopRequest::Raise()
+  { __sync_fetch_and_or(&requested, 1); }
+
+  /**
+     Withdraws the pending request, e.g. before a new solving 
+     procedure.
+  */
+  void StopRequest::Clear()
+  { __sync_fetch_and_and(&requested, 0); }
+
+  /**
+     Constructs a stream observer that writes on the given stream.
+
+     @param o the output stream (cerr for default)
+  */
+  StreamObserver::StreamObserver(std::ostream& o)
+    : os(o)
+  {}
+
+  /**
+     Writes the iteration and the cost of the new best state.
+  */
+  void StreamObserver::NewBest(const std::string& runner, unsigned long iteration, fvalue cost)
+  { os << runner << "\t" << iteration << "\t" << cost << std::endl; }
+
+  /**
+     Writes the number of iterations and the best cost of the run.
+  */
+  void StreamObserver::RunStopped(const std::string& runner, unsigned long iterations, fvalue best_cost)
+  { os << runner << "\t" << iterations << "\t" << best_cost << "\tstop" << std::endl; }
+
+  /**
+     Writes the round and the cost of the solver.
+
+     @return true, since the observer never stops the solver
+  */
+  bool StreamObserver::SolverRound(unsigned int round, fvalue cost)
+  { 
+    os << "Round " << round << "\t" << cost << std::endl; 
+    return true;
+  }
+
+  /**
+     Constructs a shared cost with a given initial value.
+
+     @param c the initial value
+  */
+  SharedCost::SharedCost(fvalue c)
+  { Set(c); }
+
+  /**
+     Sets the shared cost, regardless of its current value.
+
+     @param c the new value
+  */
+  void SharedCost::Set(fvalue c)
+  { 
+    word = Encode(c); 
+    __sync_synchronize();
+  }
+
+  /**
+     Reads the shared cost.
+
+     @return the current value
+  */
+  fvalue SharedCost::Get() const
+  { return Decode(__sync_fetch_and_or(&word, 0ULL)); }
+
+  /**
+     Lowers the shared cost to the given value, unless it is already
+     lower. The compare and swap is repeated while other threads
+     change the cost in between.
+
+     @param c the proposed value
+     @return true if the shared cost has been lowered to c
+  */
+  bool SharedCost::Improve(fvalue c)
+  {
+    unsigned long long seen = __sync_fetch_and_or(&word, 0ULL), 
+      proposed = Encode(c);
+    while (c < Decode(seen))
+      {
+	unsigned long long old = __sync_val_compare_and_swap(&word, seen, proposed);
+	if (old == seen)
+	  return true;
+	seen = old;
+      }
+    return false;
+  }
+
+  /**
+     Encodes a cost as a word.
+  */
+  unsigned long long SharedCost::Encode(fvalue c)
+  {
+    unsigned long long w = 0;
+    memcpy(&w, &c, sizeof(fvalue));
+    return w;
+  }
+
+  /**
+     Decodes a word into the cost it encodes.
+  */
+  fvalue SharedCost::Decode(unsigned long long w)
+  {
+    fvalue c;
+    memcpy(&c, &w, sizeof(fvalue));
+    return c;
+  }
+
+  /**
+     Constructs an incumbent observer on a shared cost.
+
+     @param c the shared cost
+     @param r the ratio above which a run is dominated (0 for never 
+     stopping the runs)
+     @param lb whether the runs stop when the shared cost is 0
+     @param ref the cost the runs are compared with (NULL for c)
+  */
+  IncumbentObserver::IncumbentObserver(SharedCost* c, double r, bool lb,
+				       const SharedCost* ref)
+    : p_incumbent(c), p_reference(ref != NULL ? ref : c), ratio(r), 
+      stop_at_lower_bound(lb)
+  {}
+
+  /**
+     Publishes the new best cost of the run.
+  */
+  void IncumbentObserver::NewBest(const std::string& runner, unsigned long iteration, fvalue cost)
+  { p_incumbent->Improve(cost); }
+
+  /**
+     Publishes the best cost of the run that has stopped.
+  */
+  void IncumbentObserver::RunStopped(const std::string& runner, unsigned long iterations, fvalue best_cost)
+  { p_incumbent->Improve(best_cost); }
+
+  /**
+     Publishes the best cost of the run, and checks whether the run is
+     dominated.
+
+     @return false if the run has to stop
+  */
+  bool IncumbentObserver::IterationBatch(const std::string& runner, unsigned long iteration,
+					 fvalue current_cost, fvalue best_cost)
+  { 
+    p_incumbent->Improve(best_cost);
+    fvalue incumbent = p_reference->Get();
+    if (stop_at_lower_bound && incumbent == 0)
+      return false;
+    return ratio <= 0 || best_cost <= ratio * incumbent;
+  }
+
   /**
      Sets the number of experiments the solver shall perform.
 
@@ -53,6 +384,60 @@ namespace easylocal {
   void AbstractTester::SetSolverTrials(unsigned int t)
   { trials = t; }
 
+  /**
+     Sets the maximum wall time of each trial of the solver.
+
+     @param s the time limit in seconds (0 for no limit)
+  */
+  void AbstractTester::SetSolverTimeLimit(double s)
+  { solver_time_limit = s; }
+
+  /**
+     Sets the number of workers on which each trial of the solver is
+     run as a parallel multi-start, with one restart per worker.
+
+     @param n the number of workers (0 for running the trials in the
+     calling thread); at most the workers attached to the tester are used
+  */
+  void AbstractTester::SetSolverWorkers(unsigned int n)
+  { solver_workers = n; }
+
+  /**
+     Sets the number of processes on which each trial of the solver is
+     run by the process pool: they restart the solver till the time 
+     limit of the trial, or perform one restart each if it has none.
+
+     @param n the number of processes (0 for running the trials in the
+     calling process)
+  */
+  void AbstractTester::SetSolverProcesses(unsigned int n)
+  { solver_processes = n; }
+
+  /**
+     Makes the trials of the solver reproducible (see 
+     LocalSearchSolver::SetDeterministic), or lets them run freely.
+     Trial i uses the master seed plus i - 1.
+
+     @param d whether the trials are reproducible
+     @param seed the master seed of the first trial
+     @param width the number of restarts between two synchronizations
+     of a parallel multi-start (0 for the number of workers)
+  */
+  void AbstractTester::SetSolverDeterministic(bool d, unsigned long seed, unsigned int width)
+  { 
+    solver_deterministic = d;
+    solver_seed = seed;
+    solver_batch_width = width;
+  }
+
+  /**
+     Sets the method the solver uses for generating its initial states.
+
+     @param m the method (random or greedy)
+  */
+  void AbstractTester::SetInitialState(InitialStateMethod m)
+  { initial_state_method = m; }
+
   /** 
       Sets the name of the file to be used as log for the 
       experiments.
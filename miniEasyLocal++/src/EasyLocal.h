@@ -21,10 +21,15 @@
 #include <vector>
 #include <string>
 #include <list>
+#include <map>
 #include <cmath>
 #include <cassert>
 #include <ctime>
 #include <cstdio>
+#include <climits>
+#include <csignal>
+#include <pthread.h>
+#include <sys/types.h>
 
 /** This function is provided by a bison parser for batch 
     experiment file processing */
@@ -38,13 +43,125 @@ extern FILE *yyout;
 /** The easylocal namespace embeds all the classes of the framework. */
 namespace easylocal {
   /** A random number generator. Generates pseudo-random integer values in the
-      range [a, b].
+      range [a, b]. They are drawn from rand(), unless a generator has
+      been set for the calling thread by SetThreadRandom.
       @param a the lower bound of the range
       @param b the upper bound of the range
       @return a value in the range [a, b]
   */
   int Random(int a, int b);
 
+  /** A fast pseudo-random generator (a 32 bit xorshift), meant to be
+      owned by a single runner. Unlike Random, it does not share the
+      state of rand(), and a draw costs a few shifts.
+  */
+  class FastRandom
+  {
+  public:
+    /** Creates a generator with a given seed.
+	@param seed the seed */
+    FastRandom(unsigned long seed = 1) 
+    { Seed(seed); }
+    void Seed(unsigned long seed);
+    /** Generates 32 pseudo-random bits.
+	@return a value in the range [0, 2^32 - 1] */
+    unsigned long Next()
+    { 
+      x ^= (x << 13) & 0xFFFFFFFFUL;
+      x ^= x >> 17;
+      x ^= (x << 5) & 0xFFFFFFFFUL;
+      return x;
+    }
+    /** Generates a pseudo-random integer value in the range [a, b].
+	@param a the lower bound of the range
+	@param b the upper bound of the range
+	@return a value in the range [a, b] */
+    int Uniform(int a, int b)
+    { return a + (int)(Next() * ((b - a + 1) / 4294967296.0)); }
+  protected:
+    unsigned long x; /**< The state of the generator (never 0). */
+  };
+
+  /** An adapter that gives Random the interface of FastRandom, so that
+      the code written for a generator can also draw from rand(). */
+  class StandardRandom
+  {
+  public:
+    /** Generates a pseudo-random integer value in the range [a, b]
+	by means of Random. */
+    int Uniform(int a, int b) 
+    { return Random(a,b); }
+  };
+
+  FastRandom* SetThreadRandom(FastRandom* rng);
+  void SetConcurrentThread(bool concurrent);
+  bool ConcurrentThread();
+  unsigned long DerivedSeed(unsigned long master, unsigned long index);
+
+  /** A stopwatch on the monotonic clock of the system, that measures
+      the wall time (unlike clock(), which measures the processor time
+      of the process).
+  */
+  class WallClock
+  {
+  public:
+    /** Creates a stopwatch, started at the time of creation. */
+    WallClock() 
+    { Start(); }
+    /** Restarts the stopwatch. */
+    void Start() 
+    { start = Now(); }
+    /** Returns the time elapsed since the last start.
+	@return the elapsed time in seconds */
+    double Elapsed() const 
+    { return Now() - start; }
+    static double Now();
+  protected:
+    double start; /**< The time of the last start, in seconds. */
+  };
+
+  /** The requests of stopping the search that come from outside the
+      process: a SIGINT or SIGTERM signal, or a change of a control
+      file (e.g., touched by a script), which is polled by a watcher
+      thread. A pending request stops the runners at their next 
+      iteration and the solvers at their next round, so that the 
+      solving procedures still deliver their best states (anytime
+      solving). A second signal terminates the process. The flags are
+      shared by the threads, and they are written with atomic 
+      operations.
+  */
+  class StopRequest
+  {
+  public:
+    static void InstallHandlers();
+    static void WatchFile(const std::string& file, double period = 0.5);
+    static void StopWatching();
+    /** Checks whether a stop has been requested (a read of a flag,
+	which can be made in the inner loop of a runner; the barrier is
+	only paid once the request is seen).
+	@return true if the search has to stop */
+    static bool Pending()
+    { 
+      if (requested == 0)
+	return false;
+      __sync_synchronize();
+      return true;
+    }
+    static void Raise();
+    static void Clear();
+  protected:
+    static void Handler(int sig);
+    static void* WatcherThread(void* arg);
+    static volatile sig_atomic_t requested; /**< Whether a stop has been
+					       requested. */
+    static std::string watched_file; /**< The control file. */
+    static double watch_period; /**< The time between two polls of the
+				   control file, in seconds. */
+    static volatile int watching; /**< Whether the watcher thread 
+				     runs. */
+    static pthread_t watcher; /**< The watcher thread. */
+  };
+
   /** This constant multiplies the value of the Violations function in the
       hierarchical formulation of the Cost function (i.e., 
       CostFunction(s) = HARD_WEIGHT * Violations(s) + Objective(s)).
@@ -58,7 +175,12 @@ namespace easylocal {
 	
   /** These are used by the Tester class for returning 
       a code error to the parser. */
-  const int RUNNER_NOT_FOUND = 1, RUNNER_TYPE_MISMATCH = 2;
+  const int RUNNER_NOT_FOUND = 1, RUNNER_TYPE_MISMATCH = 2, SOLVER_NOT_FOUND = 3;
+
+  /** The wall time, in seconds, between two readings of the clock by a
+      runner with a time limit. The number of iterations between two
+      readings is adapted to the speed of the runner. */
+  const double TIME_CHECK_PERIOD = 0.001;
 	
   /** The fvalue definition represent the codomain of the cost and of the 
       objective function. For default it is set to double, but the user 
@@ -84,6 +206,17 @@ namespace easylocal {
       @return the distance between x and y
   */
   inline double distance(fvalue x, fvalue y);
+
+  /** This function weights a value of the violations function and one of
+      the objective function (or their variations) into a value of the
+      cost function, as described for HARD_WEIGHT.
+
+      @param violations the violations, or their variation
+      @param objective the objective, or its variation
+      @return the corresponding value of the cost function
+  */
+  inline fvalue WeightedCost(fvalue violations, fvalue objective)
+  { return HARD_WEIGHT * violations + objective; }
 		
   /** @defgroup Helpers Helper classes 
       Helper classes perform actions related to some specific aspects of the
@@ -107,6 +240,15 @@ namespace easylocal {
   // forward class tag declaration
   template <class Input, class State> class Runner;
 
+  /** The methods a solver can use for generating its initial state.
+      @ingroup Helpers
+  */
+  enum InitialStateMethod 
+    { 
+      RANDOM_INITIAL_STATE, /**< the state manager's RandomState */
+      GREEDY_INITIAL_STATE  /**< the state manager's GreedyState */
+    };
+
   /** The State Manager is responsible for all operations on the state
       which are independent of the neighborhood definition, such as
       generating a random state, and computing the cost of a state.
@@ -121,19 +263,45 @@ namespace easylocal {
 	@note @bf To be implemented in the application.
 	@param st the state generated */
     virtual void RandomState(State &st) = 0; 
+    /** Generates a state by means of a constructive heuristic. 
+	The tentative definition falls back to RandomState.
+	@note @bf It should be redefined in the application.
+	@param st the state generated */
+    virtual void GreedyState(State &st)
+    { RandomState(st); }
+    /** Generates a random state drawing from the given generator, so 
+	that different threads can generate their states at the same
+	time. The tentative definition ignores the generator and
+	calls RandomState(st).
+	@param st the state generated
+	@param rng the generator owned by the calling thread */
+    virtual void RandomState(State &st, FastRandom& rng)
+    { RandomState(st); }
+    /** Generates a state by means of the constructive heuristic,
+	drawing from the given generator. The tentative definition
+	ignores the generator and calls GreedyState(st).
+	@param st the state generated
+	@param rng the generator owned by the calling thread */
+    virtual void GreedyState(State &st, FastRandom& rng)
+    { GreedyState(st); }
     /** Possibly updates redundant state data. It is used by the
 	output manager to make the state consistent.
 	@param st the state to be updated
     */
     virtual void UpdateRedundantStateData(State &st) 
     {}
-    virtual fvalue SampleState(State &st, int samples);
+    virtual fvalue SampleState(State &st, int samples, 
+			       InitialStateMethod method = RANDOM_INITIAL_STATE);
     virtual fvalue ImprovedSampleState(State &st, int samples, Runner<Input,State>* r);      
+    virtual fvalue ImprovedSampleState(State &st, int samples, 
+				       const std::vector<Runner<Input,State>*>& r);
+    void SetSampleThreads(unsigned int t);
 		
     // State Evaluation functions
     virtual fvalue CostFunction(const State& st) const;
     virtual fvalue Objective(const State& st) const;
     virtual fvalue Violations(const State& st) const;
+    virtual unsigned long StateHash(const State& st) const;
 				
     // debug functions
     virtual void PrintState(const State& st) const;
@@ -143,7 +311,31 @@ namespace easylocal {
     Input* GetInput();
   protected:
     StateManager(Input* in = NULL);
+    /** The data of a thread that samples states, owned by the thread
+	until it is joined. */
+    struct Sampler
+    {
+      StateManager* sm; /**< The state manager. */
+      Runner<Input,State>* runner; /**< The runner that improves the 
+				      samples (NULL if none). */
+      InitialStateMethod method; /**< The generation method. */
+      int first; /**< The index of the first sample of the thread. */
+      int step; /**< The distance between two samples of the thread. */
+      int samples; /**< The total number of samples. */
+      unsigned long base_seed; /**< The seed the seeds of the samples 
+				  are derived from. */
+      FastRandom rng; /**< The generator of the current sample. */
+      State state; /**< The state being sampled. */
+      State best; /**< The best sample of the thread. */
+      fvalue best_cost; /**< The cost of the best sample. */
+      int best_sample; /**< The index of the best sample. */
+    };
+    static void* SamplerThread(void* arg);
+    fvalue ParallelSampleState(State &st, int samples, InitialStateMethod method,
+			       const std::vector<Runner<Input,State>*>& r);
     Input* p_in; /**< A pointer to the input object. */
+    unsigned int sample_threads; /**< The number of threads used for
+				    sampling the states. */
   };
 
   /** The Output Manager is responsible for translating between
@@ -272,7 +464,7 @@ namespace easylocal {
     /** Virtual destructor. */
     virtual ~TabuListManager() {}
     virtual bool Aspiration(const Move&, fvalue mv_cost, fvalue curr, fvalue best) const; 
-    void InsertIntoList(const Move& mv); 
+    virtual void InsertIntoList(const Move& mv); 
     /** Updates the function associated with the aspiration criterion. 
 	For default it does nothing.
 	@param mv_cost the cost of the move
@@ -280,7 +472,7 @@ namespace easylocal {
 	@param best the cost of the best solution found so far */
     void UpdateAspirationFunction(fvalue mv_cost, fvalue curr_cost, fvalue best_cost) 
     {}
-    bool ListMember(const Move&) const;
+    virtual bool ListMember(const Move&) const;
 		
     unsigned int min_tenure, /**< The minimum tenure of the tabu list. */
       max_tenure;  /**< The maximum tenure of the tabu list. */
@@ -296,6 +488,7 @@ namespace easylocal {
   class ListItem
   {
     friend class TabuListManager<Move>;
+    template <class M, class Manager> friend class StaticTabuListManager;
 #ifndef __GNUC_MINOR__
     friend std::ostream& operator<<(std::ostream&, const TabuListManager<Move>&);
 #elif __GNUC_MINOR__ > 7 
@@ -320,6 +513,70 @@ namespace easylocal {
   /** Prints out the current status of the Tabu List Manager. */
   template <class Move>
   std::ostream& operator<<(std::ostream&, const TabuListManager<Move>&);
+
+  /** The Static Tabu List Manager is a tabu list manager whose
+      prohibition test is statically bound to the @c ListMember, @c Inverse
+      and @c Aspiration functions of the concrete class @c Manager, which
+      derives from it (curiously recurring template pattern).
+      The virtual interface is kept, so that the manager can be used
+      everywhere a tabu list manager is expected, but the calls made
+      for each item of the list can be inlined.
+      If @c Inverse or @c ListMember are protected in @c Manager, the
+      latter must declare this class as a friend.
+      @ingroup Helpers
+  */
+  template <class Move, class Manager>
+  class StaticTabuListManager : public TabuListManager<Move>
+  {
+  public:
+    bool ProhibitedMove(const Move& mv, fvalue mv_cost, fvalue curr, 
+			fvalue best) const;
+  protected:
+    StaticTabuListManager(int min = 0, int max = 0);
+    bool ListMember(const Move&) const;
+  };
+
+  /** The Frequency Manager is the long-term memory of the search: it
+      counts how often the attributes of the solutions have been 
+      introduced by the moves performed. During a diversification phase
+      the neighborhood explorer adds its penalty to the cost of the
+      moves, so that the ones that lead to the less visited attributes
+      are preferred.
+      The penalty does not change the cost of the moves returned by the
+      explorer, nor the aspiration criterion.
+      @ingroup Helpers
+  */
+  template <class Move>
+  class FrequencyManager
+  {
+  public:
+    /** Virtual destructor. */
+    virtual ~FrequencyManager() {}
+    /** Records the attributes introduced by a performed move.
+	@note @bf To be implemented in the application.
+	@param mv the move performed */
+    virtual void InsertMove(const Move& mv) = 0;
+    /** Returns the penalty of a move, according to the frequency of
+	the attributes it introduces.
+	@note @bf To be implemented in the application.
+	@param mv the move
+	@return the penalty of mv */
+    virtual fvalue Penalty(const Move& mv) const = 0;
+    /** Resets the frequencies.
+	@note @bf To be implemented in the application. */
+    virtual void Clean() = 0;
+    /** Starts or ends a diversification phase.
+	@param d true for starting the phase, false for ending it */
+    void SetDiversification(bool d) 
+    { diversification = d; }
+    /** States whether the search is in a diversification phase.
+	@return true if the moves are penalized, false otherwise */
+    bool Diversification() const 
+    { return diversification; }
+  protected:
+    FrequencyManager() : diversification(false) {}
+    bool diversification; /**< Whether the moves are penalized. */
+  };
 		 
 
   /** The Neighborhood Explorer is responsible for the strategy
@@ -372,6 +629,7 @@ namespace easylocal {
     { return true; }
 
     virtual void SetProhibitionManager(ProhibitionManager<Move> *pm);
+    void SetFrequencyManager(FrequencyManager<Move> *fm);
 
     /** Modifies the state passed as parameter by applying a given
 	move upon it.
@@ -384,6 +642,8 @@ namespace easylocal {
 		
     // evaluation function
     virtual fvalue DeltaCostFunction(const State& st, const Move & mv);
+    virtual void BatchDeltaCostFunction(const State& st, const Move mv[], 
+					unsigned n, fvalue delta[]);
 		
     // debugging/statistic functions
     virtual void NeighborhoodStatistics(const State &st);
@@ -418,10 +678,51 @@ namespace easylocal {
 
     Move start_move;  /**< The start move in the exploration of 
 			 the neighborhood. */
+    void SampleMoves(const State& st, int samples);
+    std::vector<Move> sample_moves; /**< The moves drawn by SampleMoves. */
+    std::vector<fvalue> sample_deltas; /**< Their cost variations. */
     // the prohibition manager used with memory based strategies
     ProhibitionManager<Move>* p_pm; /**< A pointer to the attached
 				       prohibition manager (used in case
 				       of memory based strategy. */
+    /** States whether the attached frequency manager is in a
+	diversification phase. */
+    bool Diversifying() const
+    { return p_fm != NULL && p_fm->Diversification(); }
+    FrequencyManager<Move>* p_fm; /**< A pointer to the attached 
+				     frequency manager (NULL for none). */
+  };
+
+  /** The Static Neighborhood Explorer is a neighborhood explorer whose
+      exploration functions are statically bound to the functions of the
+      concrete class @c Explorer, which derives from it (curiously 
+      recurring template pattern). The calls to @c NextMove, 
+      @c DeltaViolations, @c DeltaObjective and, when the attached
+      prohibition manager is a @c Manager, to @c ProhibitedMove are made
+      without virtual dispatch, so that they can be inlined in the 
+      exploration loops.
+      The virtual interface of the neighborhood explorer is kept as an
+      adapter to the static one.
+      If those functions are protected in @c Explorer, the latter must 
+      declare this class as a friend.
+      @ingroup Helpers
+  */
+  template <class Input, class State, class Move, class Explorer, class Manager>
+  class StaticNeighborhoodExplorer 
+    : public NeighborhoodExplorer<Input,State,Move>
+  {
+  public:
+    fvalue BestMove(const State &st, Move& mv);
+    fvalue BestNonProhibitedMove(const State &st, Move& mv, fvalue curr, fvalue best);
+    fvalue DeltaCostFunction(const State& st, const Move & mv);
+    void SetProhibitionManager(ProhibitionManager<Move> *pm);
+  protected:
+    StaticNeighborhoodExplorer(StateManager<Input,State>* sm, Input* in = NULL);
+    bool Prohibited(const Move& mv, fvalue mv_cost, fvalue curr, fvalue best) const;
+    /** Returns the object as the concrete explorer. */
+    Explorer& Self() { return *static_cast<Explorer*>(this); }
+    Manager* p_static_pm; /**< The attached prohibition manager, if it is
+			     a @c Manager (NULL otherwise). */
   };
 
   /** @defgroup Parameters Parameter handling classes
@@ -476,6 +777,156 @@ namespace easylocal {
 					    in the parameter box. */
   };
 
+  /** A search observer receives the events of the runners and of the
+      solvers it is attached to, e.g., for logging the search, showing
+      its progress or stopping it on some external condition. All the
+      events do nothing by default.
+
+      A runner delivers the new best and iteration batch events once
+      every @c batch iterations (as set by MoveRunner::SetObserver),
+      so that the observer costs nothing in the iterations in between
+      and nothing at all when it is not attached.
+      @ingroup Runners
+  */
+  class SearchObserver
+  {
+  public:
+    /** Virtual destructor. */
+    virtual ~SearchObserver() {}
+    /** A run has started.
+	@param runner the name of the runner
+	@param cost the cost of the initial state */
+    virtual void RunStarted(const std::string& runner, fvalue cost) {}
+    /** The runner has found a state better than all those previously 
+	delivered in the run. 
+	@param runner the name of the runner
+	@param iteration the current iteration
+	@param cost the cost of the new best state */
+    virtual void NewBest(const std::string& runner, unsigned long iteration, 
+			 fvalue cost) {}
+    /** A batch of iterations has been performed.
+	@param runner the name of the runner
+	@param iteration the current iteration
+	@param current_cost the cost of the current state
+	@param best_cost the cost of the best state
+	@return false if the run has to be stopped */
+    virtual bool IterationBatch(const std::string& runner, unsigned long iteration, 
+				fvalue current_cost, fvalue best_cost) 
+    { return true; }
+    /** A run has stopped.
+	@param runner the name of the runner
+	@param iterations the number of iterations of the run
+	@param best_cost the cost of the best state */
+    virtual void RunStopped(const std::string& runner, unsigned long iterations, 
+			    fvalue best_cost) {}
+    /** A solver has completed a round (e.g., a round of the token ring 
+	or a trial of a multi-start).
+	@param round the number of the round, starting from 0
+	@param cost the cost of the internal state of the solver
+	@return false if the solving procedure has to be stopped */
+    virtual bool SolverRound(unsigned int round, fvalue cost)
+    { return true; }
+  };
+
+  /** A search observer that writes the new best states and the end of 
+      the runs on an output stream, one line per event, in the 
+      format of the plot data.
+      @ingroup Runners
+  */
+  class StreamObserver : public SearchObserver
+  {
+  public:
+    StreamObserver(std::ostream& os = std::cerr);
+    void NewBest(const std::string& runner, unsigned long iteration, fvalue cost);
+    void RunStopped(const std::string& runner, unsigned long iterations, 
+		    fvalue best_cost);
+    bool SolverRound(unsigned int round, fvalue cost);
+  protected:
+    std::ostream& os; /**< The output stream. */
+  };
+
+  /** A cost shared by concurrent searches, such as the cost of the best
+      state found by any of them. It is read and lowered without locks:
+      the value is kept as a word that is replaced by compare and swap.
+      @note fvalue must fit in 64 bits.
+  */
+  class SharedCost
+  {
+  public:
+    SharedCost(fvalue c);
+    void Set(fvalue c);
+    fvalue Get() const;
+    bool Improve(fvalue c);
+  protected:
+    static unsigned long long Encode(fvalue c);
+    static fvalue Decode(unsigned long long w);
+    mutable volatile unsigned long long word; /**< The encoded cost. */
+  };
+
+  /** An observer that publishes the best costs of a run to a shared
+      cost, and stops the run when it is clearly dominated, that is 
+      when its best cost exceeds the shared one by a given ratio. 
+      Optionally, it also stops the run as soon as the shared cost 
+      has reached the lower bound (0) of the cost function.
+      The run can be compared with another shared cost than the one it
+      publishes to (e.g., a cost that only changes when the runs are 
+      synchronized, so that the decisions do not depend on timing).
+      @ingroup Runners
+  */
+  class IncumbentObserver : public SearchObserver
+  {
+  public:
+    IncumbentObserver(SharedCost* c = NULL, double r = 0.0, bool lb = false,
+		      const SharedCost* ref = NULL);
+    void NewBest(const std::string& runner, unsigned long iteration, fvalue cost);
+    bool IterationBatch(const std::string& runner, unsigned long iteration,
+			fvalue current_cost, fvalue best_cost);
+    void RunStopped(const std::string& runner, unsigned long iterations, 
+		    fvalue best_cost);
+  protected:
+    SharedCost* p_incumbent; /**< The shared cost. */
+    const SharedCost* p_reference; /**< The cost the runs are compared
+				      with. */
+    double ratio; /**< The ratio above which a run is dominated
+		     (0 for never stopping the runs). */
+    bool stop_at_lower_bound; /**< Whether the runs stop when the shared
+				 cost is 0. */
+  };
+
+  /** A bounded queue that can be used by several producer and consumer
+      threads without locks (the array-based queue of D. Vyukov). Each 
+      cell carries a sequence number, which tells whether it is ready 
+      for the next push or the next pop; the positions of the pushes 
+      and pops are claimed by compare and swap.
+  */
+  template <class T>
+  class BoundedQueue
+  {
+  public:
+    BoundedQueue(unsigned long capacity);
+    bool Push(const T& x);
+    bool Pop(T& x);
+    /** Returns the number of elements the queue can hold.
+	@return the capacity (a power of 2) */
+    unsigned long Capacity() const
+    { return mask + 1; }
+  protected:
+    /** A cell of the queue. */
+    struct Cell
+    {
+      volatile unsigned long sequence; /**< The position of the push (if
+					  equal to the position) or of the
+					  pop (if one more) it waits for. */
+      T data; /**< The element. */
+    };
+    std::vector<Cell> cell; /**< The cells. */
+    unsigned long mask; /**< The capacity minus 1. */
+    volatile unsigned long push_position; /**< The position of the next 
+					     push. */
+    volatile unsigned long pop_position; /**< The position of the next 
+					    pop. */
+  };
+
   /** @defgroup Runners Runner classes
       Runner classes are the algorithmic core of the framework. They are 
       responsible for performing a run of a local search technique, 
@@ -550,6 +1001,18 @@ namespace easylocal {
 	@param pb the object containing the parameter setting 
 	for the runner */
     virtual void SetParameters(const ParameterBox& pb) = 0;
+    /** Sets the maximum wall time of a run.
+	@param s the time limit in seconds (0 for no limit) */
+    virtual void SetTimeLimit(double s) = 0;
+    /** Sets the time at which a run has to stop anyway (e.g., the end 
+	of the time limit of a solver), as given by WallClock::Now().
+	@param t the deadline (0 for no deadline) */
+    virtual void SetDeadline(double t) = 0;
+    /** Attaches an observer to the runner.
+	@param o the observer (NULL for detaching it)
+	@param batch the number of iterations between two deliveries 
+	of the events */
+    virtual void SetObserver(SearchObserver* o, unsigned long batch = 1000) = 0;
   protected:
     std::string name, /**< The name of the runner. */
       type; /**< The type of the runner. */
@@ -582,6 +1045,9 @@ namespace easylocal {
     Input* GetInput();
     void Print(std::ostream& os = std::cout) const;
     void SetParameters(const ParameterBox& pb);
+    void SetTimeLimit(double s);
+    void SetDeadline(double t);
+    void SetObserver(SearchObserver* o, unsigned long batch = 1000);
     /** Sets the output stream which is used to write the plot of the
 	cost function during a run.
 	@param os the output stream to use (cerr for default).
@@ -599,6 +1065,23 @@ namespace easylocal {
     virtual void ComputeMoveCost(); 
     virtual void UpdateIterationCounter();
     bool MaxIterationExpired();
+    /** Checks whether the time of the run is over. The clock is read
+	only every @c time_check_interval iterations. 
+	@return true if the time limit or the deadline has passed */
+    bool TimeExpired()
+    { return number_of_iterations >= next_time_check && CheckTime(); }
+    bool CheckTime();
+    /** Delivers the events of an iteration batch to the observer, if
+	one is attached and the batch is over.
+	@return true if the observer has stopped the run, or a stop has
+	been requested from outside the process */
+    bool ObserverInterrupt()
+    { 
+      return StopRequest::Pending() 
+	|| (number_of_iterations >= next_observation && NotifyObserver()); 
+    }
+    bool NotifyObserver();
+    void NotifyRunStopped();
     /** Encodes the criterion used to stop the search. */
     virtual bool StopCriterion() = 0;
     /** Encodes the criterion used to select the move at each step. */
@@ -640,10 +1123,48 @@ namespace easylocal {
 					   performed. */
     unsigned long max_iteration;  /**< The overall maximum number 
 				     of iterations allowed. */
+
+    double time_limit; /**< The maximum wall time of a run in seconds
+			  (0 for no limit). */
+    double deadline; /**< The time at which a run has to stop anyway 
+			(0 for no deadline). */
+    double end_time; /**< The time at which the current run stops 
+			(0 if it is not bounded). */
+    double last_time_check; /**< The time of the last reading of the 
+			       clock. */
+    unsigned long next_time_check; /**< The iteration of the next 
+				      reading of the clock. */
+    unsigned long time_check_interval; /**< The number of iterations 
+					  between two readings of the 
+					  clock. */
+
+    SearchObserver* p_observer; /**< A pointer to the attached observer 
+				   (NULL if none). */
+    unsigned long observer_batch; /**< The number of iterations between
+				     two deliveries to the observer. */
+    unsigned long next_observation; /**< The iteration of the next 
+				       delivery to the observer. */
+    fvalue delivered_best_cost; /**< The best cost delivered to the 
+				   observer in the current run. */
 		
     std::ostream* pos; /**< The output stream used for plotting. */
   };
 
+  /** The Static Runner Loop performs the iterations of MoveRunner::Go
+      for a static runner (e.g., StaticHillClimbing). It is parametrized
+      by the concrete runner @c Runner, and it calls each step qualified
+      by it: the steps are bound at compile time to the functions that
+      @c Runner defines or inherits, so that they can be inlined. 
+      @c Runner must declare it as a friend.
+      @ingroup Runners
+  */
+  template <class Runner>
+  class StaticRunnerLoop
+  {
+  public:
+    static void Go(Runner& r);
+  };
+
    /** The Steepest Descent runner performs a simple local search.
       At each step of the search, the best move in the neighborhood of current
       solution is selected and performed.
@@ -688,6 +1209,29 @@ namespace easylocal {
     void StoreMove();
     void SelectMove();
   };
+
+  /** The Static Hill Climbing runner is a hill climbing whose whole 
+      iteration is statically bound to the functions of the concrete
+      neighborhood explorer @c Explorer, so that it can be inlined.
+      Its @c Go performs the same steps of the one of the move runner,
+      but it does not go through the virtual functions of the runner:
+      a subclass that needs to redefine them should derive from 
+      HillClimbing instead.
+      @ingroup Runners 
+  */
+  template <class Input, class State, class Move, class Explorer>
+  class StaticHillClimbing : public HillClimbing<Input,State,Move>
+  {
+    friend class StaticRunnerLoop<StaticHillClimbing>;
+  public:
+    void Go();
+  protected: 
+    StaticHillClimbing(StateManager<Input,State>* s, Explorer* ne, 
+		       Input* in = NULL);
+    void SelectMove();
+    void MakeMove();
+    Explorer* p_static_nhe; /**< The attached neighborhood explorer. */
+  };
   
   /** The Tabu Search runner explores a subset of the current
       neighborhood. Among the elements in it, the one that gives the
@@ -710,6 +1254,7 @@ namespace easylocal {
     void Print(std::ostream& os = std::cout) const;
     void SetInput(Input* in);
     void SetParameters(const ParameterBox& pb);
+    void SetFrequencyManager(FrequencyManager<Move>* fm);
   protected:
     TabuSearch(StateManager<Input,State>* s, 
 	       NeighborhoodExplorer<Input,State,Move>* ne,
@@ -721,7 +1266,95 @@ namespace easylocal {
     void SelectMove();
     bool AcceptableMove();
     void StoreMove();
+    void UpdateFrequencies();
     TabuListManager<Move>* p_pm; /**< A pointer to a tabu list manger. */
+    FrequencyManager<Move>* p_fm; /**< A pointer to the frequency manager
+				     (NULL for none). */
+    unsigned long diversification_idle; /**< The number of idle iterations
+					   after which a diversification
+					   phase starts (0 for none). */
+  };
+
+  /** The Static Tabu Search runner is a tabu search whose whole
+      iteration is statically bound to the functions of the concrete
+      neighborhood explorer @c Explorer and tabu list manager 
+      @c Manager, so that it can be inlined.
+      Its @c Go performs the same steps of the one of the move runner,
+      but it does not go through the virtual functions of the runner:
+      a subclass that needs to redefine them should derive from 
+      TabuSearch instead.
+      @ingroup Runners
+  */
+  template <class Input, class State, class Move, class Explorer, class Manager>
+  class StaticTabuSearch : public TabuSearch<Input,State,Move>
+  {
+    friend class StaticRunnerLoop<StaticTabuSearch>;
+  public:
+    void Go();
+  protected:
+    StaticTabuSearch(StateManager<Input,State>* s, Explorer* ne,
+		     Manager* tlm, Input* in = NULL);
+    void SelectMove();
+    void MakeMove();
+    void StoreMove();
+    Explorer* p_static_nhe; /**< The attached neighborhood explorer. */
+    Manager* p_static_tlm; /**< The attached tabu list manager. */
+  };
+
+  /** The Reactive Tabu Search runner is a tabu search that adapts the
+      tabu tenure to the search history. 
+      The visited states are recorded by their hash value (see 
+      StateManager::StateHash, which must be redefined by the state
+      manager of the application: the default one asserts): each time a state is visited again, the
+      tenure is increased; when no state has been repeated for more
+      iterations than the average length of the cycles detected so far,
+      the tenure is decreased.
+      The tenure range of the tabu list manager, as given by the
+      parameters, is scaled by a common factor; it is the starting range 
+      of each run and it is restored at its end.
+      @ingroup Runners
+  */
+  template <class Input, class State, class Move>
+  class ReactiveTabuSearch : public TabuSearch<Input,State,Move>
+  {public:
+    void Print(std::ostream& os = std::cout) const;
+    /** Sets the output stream on which the trajectory of the tenure is
+	written (a line with iteration, minimum and maximum tenure at
+	each change). For default it is not written.
+	@param os the output stream to use (cerr for default) */
+    void SetTenureLogStream(std::ostream* os = &std::cerr) 
+    { tenure_log = os; }
+    /** Sets the maximum number of visited states recorded: when it is
+	reached, the states not visited in the last half of that number
+	of iterations are forgotten (longer cycles go undetected).
+	@param n the maximum number of states (65536 for default) */
+    void SetMaxVisited(unsigned long n) 
+    { max_visited = n; }
+  protected:
+    ReactiveTabuSearch(StateManager<Input,State>* s, 
+		       NeighborhoodExplorer<Input,State,Move>* ne,
+		       TabuListManager<Move>* tlm, Input* in = NULL);
+    void InitializeRun();
+    void TerminateRun();
+    void StoreMove();
+    void SetTenureFactor(double f);
+    void ForgetVisited(unsigned long iteration);
+
+    std::map<unsigned long, unsigned long> visited; /**< The iteration of
+						       the last visit of each
+						       state (by hash value). */
+    unsigned long max_visited; /**< The maximum number of states in 
+				  visited. */
+    unsigned int base_min_tenure, /**< The minimum tenure given by the 
+				     parameters. */
+      base_max_tenure; /**< The maximum tenure given by the parameters. */
+    double tenure_factor; /**< The current scaling of the tenure range. */
+    double cycle_length; /**< The average length of the cycles detected. */
+    unsigned long last_change; /**< The iteration of the last change of
+				  the tenure. */
+    unsigned long repetitions; /**< The number of repeated states. */
+    std::ostream* tenure_log; /**< The output stream for the trajectory
+				 of the tenure (NULL for none). */
   };
 
   /** The Simulated annealing runner relies on a probabilistic local
@@ -762,7 +1395,293 @@ namespace easylocal {
     unsigned int neighbor_sample; /**< The Number of moves tested 
 				     at each temperature. */
   };
+
+  /** The Static Simulated Annealing runner is a simulated annealing
+      whose whole iteration is statically bound to the functions of the
+      concrete neighborhood explorer @c Explorer, so that it can be 
+      inlined. The random moves are drawn from a generator owned by the
+      runner: @c Explorer must provide a function 
+      <tt>RandomMove(const State&, Move&, FastRandom&)</tt>.
+      The acceptance test does not compute the exponential for moves
+      whose cost is an integer: the probabilities of acceptance at the
+      current temperature are tabulated as the costs are met.
+      Differently from SimulatedAnnealing, the best state visited is
+      kept; it is copied only when the search leaves it.
+      @ingroup Runners
+  */
+  template <class Input, class State, class Move, class Explorer>
+  class StaticSimulatedAnnealing : public SimulatedAnnealing<Input,State,Move>
+  {
+    friend class StaticRunnerLoop<StaticSimulatedAnnealing>;
+  public:
+    void Go();
+  protected:
+    StaticSimulatedAnnealing(StateManager<Input,State>* s, Explorer* ne,
+			     Input* in = NULL);
+    void InitializeRun();
+    void TerminateRun();
+    void UpdateIterationCounter();
+    void SelectMove();
+    bool AcceptableMove();
+    void MakeMove();
+    void StoreMove();
+    void SetTemperature(double t);
+    Explorer* p_static_nhe; /**< The attached neighborhood explorer. */
+    FastRandom rng; /**< The generator of the moves and of the 
+		       acceptance tests. */
+    std::vector<double> accept_threshold; /**< The probability of 
+					     accepting a move of cost d,
+					     times 2^32, for the costs
+					     met at the current 
+					     temperature. */
+    double accept_ratio; /**< The ratio between consecutive thresholds
+			    (exp(-1/temperature)). */
+    bool current_is_best; /**< Whether the best state is the current 
+			     one (and best_state is not up to date). */
+  };
+
+  /** The Late Acceptance Hill Climbing runner draws a random move at
+      each iteration, and it accepts it if it does not worsen the
+      current state or if the new cost is not worse than the cost of the
+      current state @c history_length iterations before. The costs of
+      the past states are kept in a circular buffer. The search stops
+      after a given number of iterations without improving the best 
+      state. The best state is copied only when the search leaves it.
+      @ingroup Runners
+  */
+  template <class Input, class State, class Move>
+  class LateAcceptanceHillClimbing : public MoveRunner<Input,State,Move>
+  {
+  public:
+    void ReadParameters();
+    void SetParameters(const ParameterBox& pb);
+    void Print(std::ostream& os = std::cout) const;
+  protected:
+    LateAcceptanceHillClimbing(StateManager<Input,State>* s, 
+			       NeighborhoodExplorer<Input,State,Move>* ne, 
+			       Input* in = NULL);
+    void InitializeRun();
+    void TerminateRun();
+    bool StopCriterion();
+    void UpdateIterationCounter();
+    void SelectMove();
+    bool AcceptableMove();
+    void MakeMove();
+    void StoreMove();
+    unsigned int history_length; /**< The number of past costs kept. */
+    std::vector<fvalue> history; /**< The circular buffer of the costs 
+				    of the past states: the cost of the 
+				    state of iteration i is in position 
+				    i mod history_length. */
+    bool current_is_best; /**< Whether the best state is the current 
+			     one (and best_state is not up to date). */
+  };
+
+  /** The Static Late Acceptance Hill Climbing runner is a late 
+      acceptance hill climbing whose whole iteration is statically bound
+      to the functions of the concrete neighborhood explorer @c Explorer,
+      so that it can be inlined. As for StaticSimulatedAnnealing, the 
+      random moves are drawn from a generator owned by the runner.
+      @ingroup Runners
+  */
+  template <class Input, class State, class Move, class Explorer>
+  class StaticLateAcceptanceHillClimbing 
+    : public LateAcceptanceHillClimbing<Input,State,Move>
+  {
+    friend class StaticRunnerLoop<StaticLateAcceptanceHillClimbing>;
+  public:
+    void Go();
+  protected:
+    StaticLateAcceptanceHillClimbing(StateManager<Input,State>* s, 
+				     Explorer* ne, Input* in = NULL);
+    void InitializeRun();
+    void SelectMove();
+    void MakeMove();
+    Explorer* p_static_nhe; /**< The attached neighborhood explorer. */
+    FastRandom rng; /**< The generator of the moves. */
+  };
+
+  /** The Great Deluge runner draws a random move at each iteration,
+      and it accepts it if it does not worsen the current state or if
+      the new cost does not exceed the current level. The level starts
+      from a given fraction of the initial cost, and it decreases 
+      linearly to a final level as the budget of the run is consumed.
+      The budget is a wall time (see WallClock) or, if this is 0, the
+      maximum number of iterations. The level is updated every 
+      @c level_update iterations, so that the clock is rarely read.
+      The best state is copied only when the search leaves it.
+      @ingroup Runners
+  */
+  template <class Input, class State, class Move>
+  class GreatDeluge : public MoveRunner<Input,State,Move>
+  {
+  public:
+    void ReadParameters();
+    void SetParameters(const ParameterBox& pb);
+    void Print(std::ostream& os = std::cout) const;
+  protected:
+    GreatDeluge(StateManager<Input,State>* s, 
+		NeighborhoodExplorer<Input,State,Move>* ne, Input* in = NULL);
+    void InitializeRun();
+    void TerminateRun();
+    bool StopCriterion();
+    void UpdateIterationCounter();
+    void UpdateLevel();
+    void SelectMove();
+    bool AcceptableMove();
+    void MakeMove();
+    void StoreMove();
+    double level_factor; /**< The start level, as a fraction of the 
+			    initial cost. */
+    double final_level; /**< The level at the end of the budget. */
+    double time_budget; /**< The wall time of the run in seconds 
+			   (0 for a budget of max_iteration 
+			   iterations). */
+    unsigned int level_update; /**< The number of iterations between 
+				  two updates of the level. */
+    double start_level; /**< The level at the beginning of the run. */
+    double level; /**< The current level. */
+    bool budget_expired; /**< Whether the time budget has been 
+			    consumed. */
+    WallClock chrono; /**< The stopwatch of the run. */
+    bool current_is_best; /**< Whether the best state is the current 
+			     one (and best_state is not up to date). */
+  };
+
+  /** The Static Great Deluge runner is a great deluge whose whole
+      iteration is statically bound to the functions of the concrete
+      neighborhood explorer @c Explorer, so that it can be inlined. As 
+      for StaticSimulatedAnnealing, the random moves are drawn from a
+      generator owned by the runner.
+      @ingroup Runners
+  */
+  template <class Input, class State, class Move, class Explorer>
+  class StaticGreatDeluge : public GreatDeluge<Input,State,Move>
+  {
+    friend class StaticRunnerLoop<StaticGreatDeluge>;
+  public:
+    void Go();
+  protected:
+    StaticGreatDeluge(StateManager<Input,State>* s, Explorer* ne, 
+		      Input* in = NULL);
+    void InitializeRun();
+    void SelectMove();
+    void MakeMove();
+    Explorer* p_static_nhe; /**< The attached neighborhood explorer. */
+    FastRandom rng; /**< The generator of the moves. */
+  };
+
+  /** The Parallel Tempering runner (or replica exchange) keeps a 
+      number of replicas of the state, each one at a different fixed
+      temperature of a geometric ladder, and it runs each one in its own
+      thread with the moves of the simulated annealing. Every 
+      @c exchange_interval iterations the threads are synchronized, and
+      the replicas at neighbouring temperatures swap their states with
+      the Metropolis criterion; the swap exchanges the pointers to the
+      states, that are never copied. The search stops after a given
+      number of iterations (of each replica) without improving the best
+      state.
+
+      The functions <tt>RandomMove(const State&, Move&, FastRandom&)</tt>,
+      @c DeltaCostFunction and @c MakeMove of @c Explorer are called 
+      concurrently on different states, so they must not modify the
+      explorer.
+      @ingroup Runners
+  */
+  template <class Input, class State, class Move, class Explorer>
+  class ParallelTempering : public MoveRunner<Input,State,Move>
+  {
+  public:
+    void Go();
+    void ReadParameters();
+    void SetParameters(const ParameterBox& pb);
+    void Print(std::ostream& os = std::cout) const;
+  protected:
+    ParallelTempering(StateManager<Input,State>* s, Explorer* ne, 
+		      Input* in = NULL);
+    void InitializeRun();
+    void TerminateRun();
+    bool StopCriterion();
+    void SelectMove();
+    /** The data of a replica, owned by its thread between two 
+	synchronizations. */
+    struct Replica
+    {
+      ParallelTempering* runner; /**< The runner of the replica. */
+      State* state; /**< The current state (one of the pool). */
+      fvalue cost; /**< The cost of the current state. */
+      double temperature; /**< The temperature of the replica. */
+      FastRandom rng; /**< The generator of the moves and of the 
+			 acceptance tests. */
+      Move move; /**< The move being tried. */
+      State best; /**< The best state of the replica. */
+      fvalue best_cost; /**< The cost of the best state. */
+      bool current_is_best; /**< Whether the best state is the current 
+			       one (and best is not up to date). */
+    };
+    static void* ReplicaThread(void* arg);
+    void RunReplica(Replica& r);
+    void ExchangeReplicas();
+    unsigned int replicas; /**< The number of replicas (and threads). */
+    double min_temperature; /**< The temperature of the coldest replica. */
+    double max_temperature; /**< The temperature of the hottest replica. */
+    unsigned int exchange_interval; /**< The number of iterations of each 
+				       replica between two exchanges. */
+    Explorer* p_static_nhe; /**< The attached neighborhood explorer. */
+    std::vector<State> pool; /**< The states of the replicas. */
+    std::vector<Replica> replica; /**< The replicas, from the coldest. */
+    pthread_barrier_t segment_end; /**< The barrier met by the replicas
+				      at the end of a segment of 
+				      iterations. */
+    pthread_barrier_t segment_start; /**< The barrier that releases the
+					replicas for the next segment. */
+    bool stop; /**< Whether the threads have to terminate. */
+    unsigned long exchanges, /**< The number of swaps tried. */
+      accepted_exchanges; /**< The number of swaps performed. */
+  };
 	
+  /** A writer of snapshots, i.e., of the best states found by a solver
+      while it runs, so that an interrupted (or crashed) run still 
+      yields its best output. The solver offers its best states at the
+      end of its rounds, and a thread of the writer converts them by 
+      means of the output manager and writes them to a file, at most
+      once in a given interval (the latest state is written when the 
+      interval is over, or when the writer stops). The file is replaced
+      atomically, by renaming a temporary file.
+      @ingroup Solvers
+  */
+  template <class Input, class Output, class State>
+  class SnapshotWriter
+  {
+  public:
+    SnapshotWriter(OutputManager<Input,Output,State>* om, Input* in,
+		   const std::string& file, double interval = 1.0);
+    ~SnapshotWriter();
+    void Start();
+    void Offer(const State& st, fvalue cost);
+    void Stop();
+    /** Returns the number of snapshots written since the last start.
+	@return the number of snapshots */
+    unsigned int Written() const
+    { return written; }
+  protected:
+    static void* WriterThread(void* arg);
+    void Write(const State& st);
+    OutputManager<Input,Output,State>* p_om; /**< The output manager. */
+    Input* p_in; /**< The input object. */
+    std::string file_name; /**< The file of the snapshots. */
+    double interval; /**< The minimum time between two snapshots, in
+			seconds. */
+    State pending; /**< The latest state offered and not yet written. */
+    bool has_pending; /**< Whether there is a state to write. */
+    fvalue offered_cost; /**< The cost of the best state offered. */
+    bool running; /**< Whether the writer thread runs. */
+    unsigned int written; /**< The number of snapshots written. */
+    pthread_t writer; /**< The writer thread. */
+    pthread_mutex_t lock; /**< Protects the pending state. */
+    pthread_cond_t wakeup; /**< Signals a new state or the stop. */
+  };
+
   /** @defgroup Solvers Solver classes
       Solver classes control the search by generating the initial solutions, 
       and deciding how, and in which sequence,
@@ -826,6 +1745,7 @@ namespace easylocal {
   class LocalSearchSolver : public Solver<Input, Output>
   {public:
     void SetInitTrials(int t);
+    void SetInitialState(InitialStateMethod m);
     void Solve();
     /** Uses the final state of previous (Re)Solve execution as 
 	the initial one
@@ -836,6 +1756,21 @@ namespace easylocal {
     void SetInput(Input* in);
     virtual void Check();
     fvalue InternalStateCost();
+    void SetTimeLimit(double s);
+    /** Attaches an observer to the solver, which receives its rounds.
+	@param o the observer (NULL for detaching it) */
+    void SetObserver(SearchObserver* o)
+    { p_observer = o; }
+    /** Attaches a snapshot writer to the solver, which receives its
+	best states while it runs.
+	@param w the writer (NULL for detaching it) */
+    void SetSnapshotWriter(SnapshotWriter<Input,Output,State>* w)
+    { p_snapshot = w; }
+    void AddWorker(LocalSearchSolver* s);
+    void ClearWorkers();
+    void SetDominanceRatio(double r);
+    void SetDeterministic(unsigned long seed, unsigned int width = 0);
+    void SetFreeRunning();
   protected:
     LocalSearchSolver(StateManager<Input,State>* sm, 
 		      OutputManager<Input,Output,State>* om, Input* in = NULL, Output* out = NULL);
@@ -849,14 +1784,95 @@ namespace easylocal {
     void DeliverOutput();
     virtual void FindInitialState();
     void ComputeCost();
+    void StartTimer();
+    bool DeadlinePassed() const;
+    void GoRunner(Runner<Input,State>* r);
+    bool NotifyRound(unsigned int round);
+    bool NotifyRound(unsigned int round, const State* best);
+    /** The data shared by the threads of a parallel multi-start. */
+    struct MultiStart
+    {
+      LocalSearchSolver* master; /**< The solver that has been called. */
+      unsigned int restarts; /**< The number of restarts to perform. */
+      unsigned int started; /**< The number of restarts started so far
+			       (incremented atomically). */
+      SharedCost incumbent; /**< The best cost found by any worker. */
+      pthread_mutex_t round_lock; /**< Serializes the calls to the
+				     observer of the master. */
+      MultiStart() : incumbent(0) {}
+    };
+    /** The data of a worker of a parallel multi-start. */
+    struct Worker
+    {
+      LocalSearchSolver* solver; /**< The solver of the worker. */
+      MultiStart* shared; /**< The shared data. */
+      State best; /**< The best state found by the worker. */
+      fvalue best_cost; /**< The cost of the best state. */
+      bool found; /**< Whether the worker has completed a restart. */
+      FastRandom rng; /**< The generator the thread draws from. */
+    };
+    static void* WorkerThread(void* arg);
+    void ParallelMultiStartSolve(unsigned int n);
+    /** The restarts of a batch of a deterministic multi-start that are
+	assigned to a thread. */
+    struct Share
+    {
+      LocalSearchSolver* solver; /**< The solver of the thread. */
+      unsigned long base_seed; /**< The seed the seeds of the restarts 
+				  are derived from. */
+      unsigned int begin; /**< The first restart of the batch. */
+      unsigned int first; /**< The first restart of the thread. */
+      unsigned int end; /**< The end of the batch. */
+      unsigned int step; /**< The distance between two restarts of the
+			    thread. */
+      State* best; /**< The best states of the restarts of the batch. */
+      fvalue* best_cost; /**< The costs of the best states. */
+    };
+    static void* ShareThread(void* arg);
+    void DeterministicMultiStartSolve(unsigned int n);
     StateManager<Input,State>* p_sm; /**< A pointer to the attached 
 					state manager. */
     OutputManager<Input,Output,State>* p_om; /**< A pointer to the attached
 						output manager. */
+    double time_limit; /**< The maximum wall time of a solving 
+			  procedure in seconds (0 for no limit). */
+    double deadline; /**< The time at which the current solving 
+			procedure stops (0 if it is not bounded). */
+    SearchObserver* p_observer; /**< A pointer to the attached observer 
+				   (NULL if none). */
+    SnapshotWriter<Input,Output,State>* p_snapshot; /**< A pointer to the
+						       attached snapshot 
+						       writer (NULL if 
+						       none). */
+    bool stop_requested; /**< Whether the observer has stopped the 
+			    current solving procedure. */
     fvalue internal_state_cost;  /**< The cost of the internal state. */
     State internal_state;        /**< The internal state of the solver. */
     unsigned int number_of_init_trials; /**< Number of different initial 
 					   states tested for a run. */
+    InitialStateMethod initial_state_method; /**< The method used for 
+						generating the initial states. */
+    std::vector<LocalSearchSolver*> workers; /**< The solvers that perform
+						the restarts of a parallel
+						multi-start. */
+    double dominance_ratio; /**< The ratio above which a restart is 
+			       dominated by the incumbent and stopped
+			       (0 for never stopping them). */
+    IncumbentObserver incumbent_observer; /**< The observer attached to
+					     the runners while the solver
+					     works for a parallel 
+					     multi-start. */
+    bool observe_incumbent; /**< Whether the solver works for a parallel
+			       multi-start. */
+    bool deterministic; /**< Whether the parallel search is reproducible,
+			   i.e., it only depends on the seed. */
+    unsigned long master_seed; /**< The seed of a deterministic search. */
+    unsigned int batch_width; /**< The number of restarts between two 
+				 synchronizations of a deterministic 
+				 multi-start (0 for the number of 
+				 workers). */
+    template <class I, class O, class S> friend class IslandModelSolver;
+    template <class I, class O, class S> friend class ProcessPoolSolver;
   };
 	
   /** The Simple Local Search solver handles a simple local search algorithm
@@ -890,6 +1906,9 @@ namespace easylocal {
     void ClearRunners();
     void AddRunner(Runner<Input,State> *r);
     void SetRunner(Runner<Input,State> *r, unsigned int i);		
+    /** @return the number of the linked runners */
+    unsigned int NumberOfRunners() const
+    { return runners.size(); }
   protected:
     MultiRunnerSolver(StateManager<Input,State>* sm, 
 		      OutputManager<Input,Output,State>* om, Input* in = NULL, Output* out = NULL);
@@ -927,6 +1946,42 @@ namespace easylocal {
     State start_state; /**< The start state is equal for each runner used
 			  and is kept in this variable. */
   };
+
+  /** A Concurrent Comparative Solver applies its runners to the same
+      initial state at the same time, each one in its own thread (the
+      runners work on their own copies of the state), and keeps the best
+      outcome. Optionally, all the runs are cancelled as soon as one of 
+      them reaches the lower bound of the cost function.
+      The runners must not share any helper that is modified by the 
+      search (such as a neighborhood explorer with cached data).
+      @ingroup Solvers
+  */
+  template <class Input, class Output, class State>
+  class ConcurrentComparativeSolver : public ComparativeSolver<Input,Output,State>
+  {
+  public:
+    void SetCancelAtLowerBound(bool c);
+  protected:
+    ConcurrentComparativeSolver(StateManager<Input,State>* sm, 
+				OutputManager<Input,Output,State>* om, 
+				Input* in = NULL, Output* out = NULL);
+    void Run();
+    /** The data of the thread of a runner. */
+    struct Contestant
+    {
+      ConcurrentComparativeSolver* solver; /**< The solver. */
+      Runner<Input,State>* runner; /**< The runner of the thread. */
+      SearchObserver* observer; /**< The observer attached to the runner
+				   (NULL if none). */
+      FastRandom rng; /**< The generator of the thread. */
+    };
+    static void* RunnerThread(void* arg);
+    bool cancel_at_lower_bound; /**< Whether the runs are cancelled when 
+				   one of them reaches the lower bound. */
+    SharedCost incumbent; /**< The best cost found by any runner. */
+    IncumbentObserver cancel_observer; /**< The observer that cancels 
+					  the runs. */
+  };
 	
   /** The Token-ring Solver alternates n runners for a number of
       rounds.   
@@ -948,7 +2003,380 @@ namespace easylocal {
 			     allowed. */
     //    unsigned int start_runner;
   };
+
+  /** The Iterated Local Search solver repeats the token ring of its
+      runners from a perturbation of the local minimum it has reached,
+      i.e., from the result of a kick of some random moves. The kick
+      becomes stronger by one move at each kick that does not improve 
+      the best state, and returns to its minimum strength otherwise.
+      @ingroup Solvers
+  */
+  template <class Input, class Output, class State, class Move>
+  class IteratedLocalSearch : public TokenRingSolver<Input,Output,State>
+  {public:
+    /** The criteria for accepting the local minimum reached after a 
+	kick as the state to be perturbed by the next one. */
+    enum Acceptance 
+      { ACCEPT_BETTER, /**< only if not worse than the current one */
+	ACCEPT_ALWAYS, /**< always (random walk) */
+	ACCEPT_ANNEALING /**< if worse, with probability exp(-delta/T) */
+      };
+    void SetKicks(unsigned int max_idle);
+    void SetKickStrength(unsigned int min, unsigned int max);
+    void SetAcceptance(Acceptance a, double temperature = 1.0);
+    void Print(std::ostream& os = std::cout) const;
+  protected:
+    IteratedLocalSearch(StateManager<Input,State>* sm, 
+			OutputManager<Input,Output,State>* om, 
+			NeighborhoodExplorer<Input,State,Move>* ne,
+			Input* in = NULL, Output* out = NULL); 
+    void Run();
+    virtual void Kick(State& st, unsigned int strength);
+    /** Selects one of the moves of a kick. By default it is a random
+	move of the neighborhood explorer.
+	@param st the state to be perturbed
+	@param mv the selected move */
+    virtual void SelectKickMove(const State& st, Move& mv)
+    { p_nhe->RandomMove(st,mv); }
+    bool AcceptKick(fvalue cost, fvalue current_cost);
+    NeighborhoodExplorer<Input,State,Move>* p_nhe; /**< A pointer to the 
+						      explorer of the kick
+						      moves. */
+    unsigned int max_idle_kicks; /**< The maximum number of kicks without
+				    improvement of the best state. */
+    unsigned int min_strength, /**< The number of moves of a kick after
+				  an improvement. */
+      max_strength; /**< The maximum number of moves of a kick. */
+    Acceptance acceptance; /**< The acceptance criterion. */
+    double temperature; /**< The temperature of ACCEPT_ANNEALING. */
+    unsigned int kicks; /**< The number of kicks of the last run. */
+  };
 	
+  /** A neighborhood of a Variable Neighborhood Search solver, which 
+      works directly on the state of the solver, regardless of the type 
+      of its moves.
+      @ingroup Solvers
+  */
+  template <class Input, class State>
+  class Neighborhood
+  {
+  public:
+    /** Virtual destructor. */
+    virtual ~Neighborhood() {}
+    /** Performs a steepest descent on a state, till no move improves it
+	or a given number of moves has been performed.
+	@param st the state
+	@param cost the cost of the state, updated by the descent
+	@param max_moves the maximum number of moves
+	@return the number of moves performed */
+    virtual unsigned long Descend(State& st, fvalue& cost, 
+				  unsigned long max_moves = ULONG_MAX) = 0;
+    /** Performs a random move on a state (if it is feasible).
+	@param st the state
+	@param cost the cost of the state, updated by the move */
+    virtual void RandomStep(State& st, fvalue& cost) = 0;
+  };
+
+  /** The neighborhood of the moves of a neighborhood explorer.
+      @ingroup Solvers
+  */
+  template <class Input, class State, class Move>
+  class MoveNeighborhood : public Neighborhood<Input,State>
+  {
+  public:
+    MoveNeighborhood(NeighborhoodExplorer<Input,State,Move>* ne);
+    unsigned long Descend(State& st, fvalue& cost, 
+			  unsigned long max_moves = ULONG_MAX);
+    void RandomStep(State& st, fvalue& cost);
+  protected:
+    NeighborhoodExplorer<Input,State,Move>* p_nhe; /**< A pointer to the 
+						      attached neighborhood 
+						      explorer. */
+    Move mv; /**< The current move. */
+  };
+
+  /** The Variable Neighborhood Search solver performs a descent in
+      each of its neighborhoods in turn (Variable Neighborhood Descent):
+      it restarts from the first one after each improvement, and it 
+      stops when the last one fails. Then it shakes the local minimum by 
+      a compound move of k random moves, each one of a random 
+      neighborhood, and it descends again: k returns to 1 after an 
+      improvement of the best state, and grows by one otherwise.
+
+      All the neighborhoods work on a single working state of the 
+      solver, which is copied only for saving the best state or for
+      restoring it after an unsuccessful shake.
+      @ingroup Solvers
+  */
+  template <class Input, class Output, class State>
+  class VariableNeighborhoodSearch : public LocalSearchSolver<Input,Output,State>
+  {public:
+    void AddNeighborhood(Neighborhood<Input,State>* n);
+    void ClearNeighborhoods();
+    void SetShakes(unsigned int max);
+    void Print(std::ostream& os = std::cout) const;
+  protected:
+    VariableNeighborhoodSearch(StateManager<Input,State>* sm, 
+			       OutputManager<Input,Output,State>* om, 
+			       Input* in = NULL, Output* out = NULL); 
+    void Run();
+    void Descend();
+    void Shake(unsigned int k);
+    unsigned long NumberOfIterations() const;
+    std::vector<Neighborhood<Input,State>*> neighborhoods; /**< The 
+							      neighborhoods, 
+							      in the order
+							      of the 
+							      descent. */
+    unsigned int max_shake; /**< The maximum number of moves of a 
+			       shake. */
+    unsigned long number_of_moves; /**< The number of moves performed in
+				      the last run. */
+    unsigned int shakes; /**< The number of shakes of the last run. */
+  };
+
+  /** The Large Neighborhood Search solver repeatedly destroys a part
+      of its internal state and repairs it, by means of one of several 
+      destroy methods, to be defined in the application. The method is
+      drawn by a roulette wheel: after each use, the weight of the 
+      method moves by the reaction factor towards 1 if the repair has
+      improved the state, and towards 0 otherwise.
+      @ingroup Solvers
+  */
+  template <class Input, class Output, class State>
+  class LargeNeighborhoodSearch : public LocalSearchSolver<Input,Output,State>
+  {public:
+    void SetIdleIterations(unsigned long max);
+    void SetReaction(double r);
+    void Print(std::ostream& os = std::cout) const;
+  protected:
+    LargeNeighborhoodSearch(StateManager<Input,State>* sm, 
+			    OutputManager<Input,Output,State>* om, 
+			    unsigned int methods, Input* in = NULL, Output* out = NULL); 
+    void Run();
+    /** Destroys a part of a state by means of the given method and 
+	repairs it, without making it worse.
+	@param st the state
+	@param method the destroy method
+	@return the variation of the cost of the state (not positive) */
+    virtual fvalue DestroyAndRepair(State& st, unsigned int method) = 0;
+    unsigned int SelectMethod() const;
+    unsigned long NumberOfIterations() const;
+    std::vector<double> weight; /**< The weights of the methods. */
+    std::vector<unsigned long> uses, /**< The number of uses of the 
+					methods in the last run. */
+      improvements; /**< The number of improving uses of the methods
+		       in the last run. */
+    unsigned long max_idle_iteration; /**< The maximum number of 
+					 iterations without improvement. */
+    unsigned long number_of_iterations; /**< The number of iterations
+					   of the last run. */
+    double reaction; /**< The reaction factor of the weights. */
+  };
+
+  /** The Island Model solver runs a population of solvers (the islands,
+      e.g. token rings of runners with different parameters), each one 
+      in its own thread, which cooperate by migration. An epoch of an 
+      island is a run of its solver from its current state; every 
+      @c migration_interval epochs the island sends a copy of its best 
+      state to the next island of a ring, and adopts the best state 
+      received from the previous one, if it is better than its current
+      state. The migrants travel through bounded lock-free queues (a 
+      migrant is dropped if the queue is full), and the cost of the best
+      state of all the islands can be read at any time without locks.
+      An island stops after @c max_idle_epochs epochs that have not
+      improved its best state.
+      In deterministic mode the epochs are synchronous: all the islands
+      perform an epoch (spread over a given number of threads), then
+      the migrations take place in the order of the islands, and each
+      island draws its random numbers from its own generator.
+      The islands must not share any runner or helper that is modified
+      by the search.
+      @ingroup Solvers
+  */
+  template <class Input, class Output, class State>
+  class IslandModelSolver : public LocalSearchSolver<Input,Output,State>
+  {public:
+    void AddIsland(LocalSearchSolver<Input,Output,State>* s);
+    void ClearIslands();
+    void SetMigration(unsigned int interval, unsigned long capacity);
+    void SetIdleEpochs(unsigned int max);
+    void SetThreads(unsigned int t);
+    /** Returns the cost of the best state found so far by any island;
+	it can be called by any thread while the solver runs.
+	@return the cost of the best state */
+    fvalue IncumbentCost() const
+    { return incumbent.Get(); }
+    void Print(std::ostream& os = std::cout) const;
+  protected:
+    IslandModelSolver(StateManager<Input,State>* sm, 
+		      OutputManager<Input,Output,State>* om, 
+		      Input* in = NULL, Output* out = NULL); 
+    void Run();
+    unsigned long NumberOfIterations() const;
+    /** A state that moves from an island to another. */
+    struct Migrant
+    {
+      State state; /**< The state. */
+      fvalue cost; /**< The cost of the state. */
+    };
+    /** The data of an island, owned by its thread while the solver 
+	runs (except the queue of the immigrants). */
+    struct Island
+    {
+      IslandModelSolver* model; /**< The solver. */
+      LocalSearchSolver<Input,Output,State>* solver; /**< The solver 
+							of the island. */
+      BoundedQueue<Migrant>* immigrants; /**< The migrants sent to the 
+					    island. */
+      BoundedQueue<Migrant>* emigrants; /**< The immigrants of the next
+					   island. */
+      State best; /**< The best state of the island. */
+      fvalue best_cost; /**< The cost of the best state. */
+      unsigned int epochs; /**< The number of epochs performed. */
+      unsigned int idle_epochs; /**< The number of epochs since the last
+				   improvement of the best state. */
+      unsigned int adopted; /**< The number of migrants adopted. */
+      bool running; /**< Whether the island takes part in the current
+		       synchronous epoch. */
+      FastRandom rng; /**< The generator of the island. */
+    };
+    /** The islands assigned to a thread in a synchronous epoch. */
+    struct Crew
+    {
+      IslandModelSolver* model; /**< The solver. */
+      unsigned int first; /**< The first island of the thread. */
+      bool start; /**< Whether the islands have to be started. */
+    };
+    static void* IslandThread(void* arg);
+    static void* CrewThread(void* arg);
+    void RunIsland(Island& is);
+    void RunSynchronousEpochs();
+    void StartIsland(Island& is);
+    void RunEpoch(Island& is);
+    void Emigrate(Island& is);
+    void Immigrate(Island& is);
+    bool EndEpoch(const Island& is);
+    std::vector<LocalSearchSolver<Input,Output,State>*> solvers; /**< The
+								     solvers
+								     of the 
+								     islands. */
+    std::vector<Island> island; /**< The islands of the last run. */
+    unsigned int migration_interval; /**< The number of epochs between
+					two migrations. */
+    unsigned long queue_capacity; /**< The capacity of the queues of 
+				     the migrants. */
+    unsigned int max_idle_epochs; /**< The maximum number of epochs of an
+				     island without improvement. */
+    unsigned int threads; /**< The number of threads of the synchronous
+			     epochs (0 for a thread per island). */
+    SharedCost incumbent; /**< The cost of the best state of all the 
+			     islands. */
+    volatile bool halt; /**< Whether the islands have to stop. */
+    unsigned int round; /**< The number of epochs of all the islands. */
+    pthread_mutex_t round_lock; /**< Serializes the end of the epochs. */
+  };
+
+  /** The Process Pool solver runs a worker solver (e.g., a token ring)
+      in several processes, each one with its own seed, for fault 
+      isolation: the processes are forked from the solver, so that they
+      share the input (copy-on-write), and a worker that crashes is
+      replaced by a new one. The workers perform restarts of the worker
+      solver, and publish their best states (at the end of the rounds 
+      of the worker solver) to an incumbent in a shared memory region:
+      its cost is updated by atomic operations, and the state, written 
+      by means of the output manager, is protected by a sequence lock,
+      so that it can be read without blocking the writers. The workers
+      share the deadline of the solver. The solver watches the 
+      incumbent, and stops the workers (by SIGTERM) at the deadline, at
+      the lower bound, or when it is stopped.
+      @ingroup Solvers
+  */
+  template <class Input, class Output, class State>
+  class ProcessPoolSolver : public LocalSearchSolver<Input,Output,State>
+  {public:
+    void SetWorker(LocalSearchSolver<Input,Output,State>* s);
+    void SetProcesses(unsigned int n);
+    void SetRestarts(unsigned int r);
+    void SetStateCapacity(unsigned long c);
+    void SetMaxRespawns(unsigned int r);
+    void Print(std::ostream& os = std::cout) const;
+  protected:
+    ProcessPoolSolver(StateManager<Input,State>* sm, 
+		      OutputManager<Input,Output,State>* om, 
+		      Input* in = NULL, Output* out = NULL); 
+    void Run();
+    unsigned long NumberOfIterations() const;
+    /** The shared memory region of the incumbent. */
+    struct Region
+    {
+      SharedCost incumbent; /**< The cost of the incumbent, for the
+			       checks without the lock. */
+      volatile unsigned long sequence; /**< The sequence lock of the 
+					  state (odd while it is 
+					  written). */
+      pthread_mutex_t writer_lock; /**< The lock of the writers, shared
+				      by the processes and robust, so 
+				      that the death of its holder is 
+				      detected. */
+      fvalue state_cost; /**< The cost of the state. */
+      unsigned long length; /**< The length of the written state. */
+      volatile unsigned long iterations; /**< The iterations of the 
+					    workers that have completed
+					    a restart. */
+      volatile unsigned long publications; /**< The number of states 
+					      published. */
+      Region() : incumbent(0) {}
+      /** Returns the buffer of the written state, which follows the
+	  region.
+	  @return the buffer */
+      char* Data()
+      { return reinterpret_cast<char*>(this + 1); }
+    };
+    /** The observer that publishes the best states of a worker at the
+	end of its rounds. */
+    class Publisher : public SearchObserver
+    {
+    public:
+      Publisher(ProcessPoolSolver* p = NULL) : pool(p) {}
+      bool SolverRound(unsigned int round, fvalue best_cost)
+      { 
+	pool->PublishWorkerState(best_cost);
+	return true; 
+      }
+    protected:
+      ProcessPoolSolver* pool; /**< The solver. */
+    };
+    void Spawn(unsigned int slot);
+    void WorkerProcess(unsigned int slot);
+    bool Publish(const State& st, fvalue cost);
+    void PublishWorkerState(fvalue cost);
+    bool ReadIncumbent(State& st, fvalue& cost) const;
+    void StopWorkers(int sig);
+    LocalSearchSolver<Input,Output,State>* p_worker; /**< The solver run 
+							by the workers. */
+    unsigned int processes; /**< The number of worker processes. */
+    unsigned int restarts; /**< The number of restarts of a worker (0 for
+			      restarting till the solver stops). */
+    unsigned long capacity; /**< The maximum length of a written state. */
+    unsigned int max_respawns; /**< The maximum number of workers that 
+				  replace crashed ones. */
+    Region* region; /**< The shared memory region (NULL when the solver
+		       does not run). */
+    unsigned long base_seed; /**< The seed the seeds of the workers are
+				derived from. */
+    std::vector<pid_t> worker_pid; /**< The processes of the workers (0 
+				      for a finished one). */
+    std::vector<unsigned int> generation; /**< The number of times the 
+					     workers have been replaced. */
+    unsigned int respawns; /**< The number of workers replaced in the
+			      last run. */
+    unsigned long total_iterations; /**< The iterations of the last 
+				       run. */
+    unsigned long publications; /**< The states published in the last
+				   run. */
+  };
+
   /** @defgroup Testers Tester classes
       Tester classes represent a simple predefined interface of the user
       program. They help the user in debugging the code, adjusting the
@@ -1053,10 +2481,24 @@ namespace easylocal {
 	@param type the type of the runner to add
     */
     virtual int AddRunnerToSolver(std::string name, std::string type) = 0;
+    /** Selects the solver of the next experiments among the ones 
+	attached to the tester.
+	@param name the name of the solver (empty for the token-ring one)
+	@return 0, or SOLVER_NOT_FOUND if there is no such solver */
+    virtual int SelectSolver(std::string name) = 0;
     void SetSolverTrials(unsigned int t);
     void SetLogFile(std::string s);
     void SetOutputPrefix(std::string s);
     void SetPlotPrefix(std::string s);
+    void SetSolverTimeLimit(double s);
+    void SetSolverWorkers(unsigned int n);
+    void SetSolverProcesses(unsigned int n);
+    void SetSolverDeterministic(bool d, unsigned long seed = 0, unsigned int width = 0);
+    void SetInitialState(InitialStateMethod m);
+    /** Sets the time limit of the runner with the given name.
+	@param name the name of the runner
+	@param s the time limit in seconds (0 for no limit) */
+    virtual void SetRunnerTimeLimit(std::string name, double s) = 0;
     /** Starts the solving procedure and collects the results. */
     virtual void StartSolver() = 0;
     /** Sets the parameter of the runner specified by the pair (name, type).
@@ -1067,6 +2509,20 @@ namespace easylocal {
     virtual void SetRunningParameters(std::string name, std::string type, const ParameterBox& pb) = 0; 
   protected:
     unsigned int trials; /**< Number of trials the solver will be run */
+    double solver_time_limit; /**< The maximum wall time of each trial 
+				 in seconds (0 for no limit). */
+    unsigned int solver_workers; /**< The number of workers each trial
+				    is run on (0 for none). */
+    unsigned int solver_processes; /**< The number of processes each
+				      trial is run on (0 for none). */
+    bool solver_deterministic; /**< Whether the trials are reproducible. */
+    unsigned long solver_seed; /**< The master seed of the first 
+				  reproducible trial. */
+    unsigned int solver_batch_width; /**< The number of restarts between
+					two synchronizations of a 
+					reproducible multi-start. */
+    InitialStateMethod initial_state_method; /**< The method the solver
+						uses for its initial states. */
     std::ostream* logstream; /**< An output stream where to write running information. */
     std::string output_file_prefix; /**< The file prefix to be used for 
 				         writing the outcome of each trial. */
@@ -1096,10 +2552,19 @@ namespace easylocal {
     void SetRunner(Runner<Input,State>* p_ru, unsigned int i);
     void AddRunner(Runner<Input,State>* p_ru);
     void SetSolver(TokenRingSolver<Input,Output,State>* p_so);
+    void AddWorker(TokenRingSolver<Input,Output,State>* p_so,
+		   const std::vector<Runner<Input,State>*>& r);
+    void AddSolver(LocalSearchSolver<Input,Output,State>* p_so, std::string name);
+    void AddRunnerSet(MultiRunnerSolver<Input,Output,State>* p_so,
+		      const std::vector<Runner<Input,State>*>& r);
+    void AddRunnerSet(MultiRunnerSolver<Input,Output,State>* p_so);
+    void SetProcessPool(ProcessPoolSolver<Input,Output,State>* p_so);
+    int SelectSolver(std::string name);
     void SetSolverParameters(unsigned int rounds, unsigned int start_runner = 0); 
     void LoadInstance(std::string id);
     int AddRunnerToSolver(std::string name, std::string type);
     void SetRunningParameters(std::string name, std::string type, const ParameterBox& pb);
+    void SetRunnerTimeLimit(std::string name, double s);
     void StartSolver();
     void ProcessBatch(std::string filename);
     void CleanSolver();
@@ -1121,6 +2586,31 @@ namespace easylocal {
     TokenRingSolver<Input,Output,State>* solver; /**< A token ring solver
 						    to be used for batch
 						    file processing. */
+    std::vector<TokenRingSolver<Input,Output,State>*> workers; /**< The
+								 workers of
+								 the solver. */
+    std::vector<LocalSearchSolver<Input,Output,State>*> solvers; /**< The 
+								   other
+								   solvers
+								   that can
+								   be 
+								   selected. */
+    std::vector<std::string> solver_names; /**< The names of the other 
+					      solvers. */
+    LocalSearchSolver<Input,Output,State>* selected_solver; /**< The solver
+							       of the
+							       current 
+							       experiment. */
+    std::vector<MultiRunnerSolver<Input,Output,State>*> runner_set_solvers;
+    /**< The solvers that receive their own copies of the runners of the
+       experiments (the workers, among them). */
+    std::vector<std::vector<Runner<Input,State>*> > runner_sets; 
+    /**< The runners of each of them (named as the ones of the tester). */
+    ProcessPoolSolver<Input,Output,State>* pool; /**< The process pool 
+						    that runs the token 
+						    ring in several 
+						    processes (NULL for
+						    none). */
     StateTester<Input,Output,State>* state_tester;  /**< A state tester. */
     StateManager<Input,State>* p_sm;  /**< A pointer to a state manager. */
     OutputManager<Input,Output,State>* p_om; /**< A pointer to an output producer. */
@@ -15,6 +15,15 @@
 
 #include <cstdlib>
 #include <climits>
+#include <cstring>
+#include <cerrno>
+#include <limits>
+#include <new>
+#include <sstream>
+#include <unistd.h>
+#include <sched.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
 namespace easylocal {
 
   /** 
@@ -30,6 +39,95 @@ namespace easylocal {
     return x > y ? x-y : y-x;
   }
 
+  // Bounded Queue functions
+
+  /**
+     Constructs an empty queue.
+
+     @param capacity the minimum number of elements the queue can hold
+     (it is rounded up to a power of 2)
+  */
+  template <class T>
+  BoundedQueue<T>::BoundedQueue(unsigned long capacity)
+    : push_position(0), pop_position(0)
+  {
+    unsigned long size = 2;
+    while (size < capacity)
+      size *= 2;
+    mask = size - 1;
+    cell.resize(size);
+    for (unsigned long i = 0; i < size; i++)
+      cell[i].sequence = i;
+  }
+
+  /**
+     Appends a copy of an element to the queue, unless it is full.
+
+     @param x the element
+     @return true if the element has been appended
+  */
+  template <class T>
+  bool BoundedQueue<T>::Push(const T& x)
+  {
+    Cell* c;
+    unsigned long position = push_position;
+    while (true)
+      {
+	c = &cell[position & mask];
+	long difference = (long)c->sequence - (long)position;
+	if (difference == 0)
+	  { // the cell is free: claim the position
+	    unsigned long seen = __sync_val_compare_and_swap(&push_position, position, position + 1);
+	    if (seen == position)
+	      break;
+	    position = seen;
+	  }
+	else if (difference < 0) // the cell still holds an element
+	  return false;
+	else // another thread has claimed the position
+	  position = push_position;
+      }
+    __sync_synchronize();
+    c->data = x;
+    __sync_synchronize();
+    c->sequence = position + 1;
+    return true;
+  }
+
+  /**
+     Removes the first element of the queue, unless it is empty.
+
+     @param x the element removed
+     @return true if an element has been removed
+  */
+  template <class T>
+  bool BoundedQueue<T>::Pop(T& x)
+  {
+    Cell* c;
+    unsigned long position = pop_position;
+    while (true)
+      {
+	c = &cell[position & mask];
+	long difference = (long)c->sequence - (long)(position + 1);
+	if (difference == 0)
+	  { // the cell is full: claim the position
+	    unsigned long seen = __sync_val_compare_and_swap(&pop_position, position, position + 1);
+	    if (seen == position)
+	      break;
+	    position = seen;
+	  }
+	else if (difference < 0) // the cell is still waiting for a push
+	  return false;
+	else // another thread has claimed the position
+	  position = pop_position;
+      }
+    __sync_synchronize();
+    x = c->data;
+    __sync_synchronize();
+    c->sequence = position + mask + 1;
+    return true;
+  }
+
   // State Manager functions
 
   /**
@@ -38,18 +136,29 @@ namespace easylocal {
      
      @param st the best state found
      @param samples the number of sampled states
+     @param method whether the states are generated by RandomState
+     or by GreedyState
    */
   template <class Input, class State>
-  fvalue StateManager<Input,State>::SampleState(State &st, int samples)
+  fvalue StateManager<Input,State>::SampleState(State &st, int samples, InitialStateMethod method)
   { 
+    if (sample_threads > 1 && samples > 1)
+      return ParallelSampleState(st,samples,method,
+				 std::vector<Runner<Input,State>*>(sample_threads,(Runner<Input,State>*)NULL));
     int s = 1;
-    RandomState(st);
+    if (method == GREEDY_INITIAL_STATE)
+      GreedyState(st);
+    else
+      RandomState(st);
     fvalue cost = CostFunction(st);
     State best_state = st;
     fvalue best_cost = cost;
     while (s < samples)
       { 
-	RandomState(st);
+	if (method == GREEDY_INITIAL_STATE)
+	  GreedyState(st);
+	else
+	  RandomState(st);
 	cost = CostFunction(st);
 	if (cost < best_cost)
 	  { 
@@ -102,6 +211,122 @@ namespace easylocal {
     return best_cost;
   }
 
+  /** 
+      Looks for the best state out of a given number of random states,
+      each one improved by a runner, using a thread for each runner 
+      (the outcome does not depend on the number of runners).
+      The runners must not share any helper that is modified by the
+      search (such as a prohibition manager).
+      
+      @param st the best state found
+      @param samples the number of sampled states
+      @param r the runners (one for each thread)
+  */
+  template <class Input, class State>
+  fvalue StateManager<Input,State>::ImprovedSampleState(State &st, int samples, 
+							 const std::vector<Runner<Input,State>*>& r)
+  { 
+    assert(!r.empty());
+    return ParallelSampleState(st,samples,RANDOM_INITIAL_STATE,r);
+  }
+
+  /**
+     Sets the number of threads used by SampleState.
+
+     @param t the number of threads (1 for sampling in the calling thread)
+  */
+  template <class Input, class State>
+  void StateManager<Input,State>::SetSampleThreads(unsigned int t)
+  { 
+    assert(t > 0);
+    sample_threads = t; 
+  }
+
+  /**
+     Spreads the samples over a thread for each runner, each one with
+     its own states, and collects the best sample. Each sample is drawn
+     from its own generator (also installed as the generator of Random
+     in the thread), whose seed is derived from a base seed drawn from 
+     Random, and the ties are broken in favour of the first sample: 
+     the outcome does not depend on the number of threads.
+
+     @param st the best state found
+     @param samples the number of sampled states
+     @param method whether the states are generated by RandomState
+     or by GreedyState
+     @param r the runners that improve the samples (NULL for plain
+     sampling), one for each thread
+     @return the cost of the best state
+  */
+  template <class Input, class State>
+  fvalue StateManager<Input,State>::ParallelSampleState(State &st, int samples, InitialStateMethod method,
+							 const std::vector<Runner<Input,State>*>& r)
+  { 
+    int k, threads = (int)r.size() < samples ? (int)r.size() : samples;
+    std::vector<Sampler> sampler(threads);
+    std::vector<pthread_t> thread(threads);
+    unsigned long base_seed = Random(0,RAND_MAX - 1);
+    for (k = 0; k < threads; k++)
+      {
+	sampler[k].sm = this;
+	sampler[k].base_seed = base_seed;
+	sampler[k].runner = r[k];
+	sampler[k].method = method;
+	sampler[k].first = k;
+	sampler[k].step = threads;
+	sampler[k].samples = samples;
+	sampler[k].state.SetInput(p_in);
+	sampler[k].best.SetInput(p_in);
+      }
+    for (k = 0; k < threads; k++)
+      pthread_create(&thread[k], NULL, SamplerThread, &sampler[k]);
+    for (k = 0; k < threads; k++)
+      pthread_join(thread[k], NULL);
+    int best = 0;
+    for (k = 1; k < threads; k++)
+      if (sampler[k].best_cost < sampler[best].best_cost
+	  || (sampler[k].best_cost == sampler[best].best_cost 
+	      && sampler[k].best_sample < sampler[best].best_sample))
+	best = k;
+    st = sampler[best].best;
+    return sampler[best].best_cost;
+  }
+
+  /**
+     The body of a sampling thread: it generates (and possibly improves)
+     the samples first, first + step, ... and keeps the best one.
+  */
+  template <class Input, class State>
+  void* StateManager<Input,State>::SamplerThread(void* arg)
+  {
+    Sampler& t = *static_cast<Sampler*>(arg);
+    SetConcurrentThread(true);
+    SetThreadRandom(&t.rng);
+    for (int s = t.first; s < t.samples; s += t.step)
+      {
+	t.rng.Seed(DerivedSeed(t.base_seed,s));
+	if (t.method == GREEDY_INITIAL_STATE)
+	  t.sm->GreedyState(t.state,t.rng);
+	else
+	  t.sm->RandomState(t.state,t.rng);
+	if (t.runner != NULL)
+	  {
+	    t.runner->SetCurrentState(t.state);
+	    t.runner->Go();
+	    t.state = t.runner->GetCurrentState();
+	  }
+	fvalue cost = t.sm->CostFunction(t.state);
+	if (s == t.first || cost < t.best_cost)
+	  { 
+	    t.best = t.state;
+	    t.best_cost = cost;
+	    t.best_sample = s;
+	  }
+      }
+    SetThreadRandom(NULL);
+    return NULL;
+  }
+
   /** 
       Evaluates the cost function value in a given state.  
       The tentative definition computes a weighted sum of the violation 
@@ -111,7 +336,7 @@ namespace easylocal {
      @return the value of the cost function in the given state */
   template <class Input, class State>
   fvalue StateManager<Input,State>::CostFunction(const State& st) const 
-  { return HARD_WEIGHT * Violations(st) + Objective(st); } 
+  { return WeightedCost(Violations(st),Objective(st)); } 
 
   /** 
       Outputs some informations about the state passed as parameter.
@@ -173,6 +398,23 @@ namespace easylocal {
   Input* StateManager<Input,State>::GetInput() 
   { return p_in; }
 
+  /**
+     Computes a hash value of a state, used by the runners that record the
+     visited states (i.e., ReactiveTabuSearch). There is no meaningful
+     default: it must be redefined by the state managers attached to such
+     runners, and the default one fails an assertion (returning 0 with
+     NDEBUG, which makes every state look visited).
+
+     @param st the state to be hashed
+     @return the hash value of the state
+  */
+  template <class Input, class State>  
+  unsigned long StateManager<Input,State>::StateHash(const State& st) const
+  { 
+    assert(false);
+    return 0; 
+  }
+
   /**
      Checks wether the object state is consistent with all the related
      objects.
@@ -188,7 +430,7 @@ namespace easylocal {
   */
   template <class Input, class State>  
   StateManager<Input,State>::StateManager(Input* in) 
-    : p_in(in)  
+    : p_in(in), sample_threads(1)
   {}
 
   // Output Manager functions
@@ -250,6 +492,155 @@ namespace easylocal {
     assert(p_in != NULL && p_sm->GetInput() == p_in); 
   }
 
+  // Snapshot Writer functions
+
+  /**
+     Constructs a snapshot writer.
+
+     @param om a pointer to a compatible output manager
+     @param in a pointer to the input object
+     @param file the name of the file of the snapshots
+     @param t the minimum time between two snapshots, in seconds
+  */
+  template <class Input, class Output, class State>
+  SnapshotWriter<Input,Output,State>::SnapshotWriter(OutputManager<Input,Output,State>* om, Input* in,
+						     const std::string& file, double t)
+    : p_om(om), p_in(in), file_name(file), interval(t), 
+    has_pending(false), offered_cost(std::numeric_limits<fvalue>::max()),
+    running(false), written(0)
+  {
+    pthread_condattr_t attr;
+    pending.SetInput(in);
+    pthread_mutex_init(&lock, NULL);
+    pthread_condattr_init(&attr);
+    pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+    pthread_cond_init(&wakeup, &attr);
+    pthread_condattr_destroy(&attr);
+  }
+
+  /**
+     Destroys the writer, after writing the pending state.
+  */
+  template <class Input, class Output, class State>
+  SnapshotWriter<Input,Output,State>::~SnapshotWriter()
+  {
+    Stop();
+    pthread_cond_destroy(&wakeup);
+    pthread_mutex_destroy(&lock);
+  }
+
+  /**
+     Starts the writer thread for a new solving procedure (the costs
+     of the states offered before are forgotten).
+  */
+  template <class Input, class Output, class State>
+  void SnapshotWriter<Input,Output,State>::Start()
+  {
+    Stop();
+    offered_cost = std::numeric_limits<fvalue>::max();
+    written = 0;
+    running = true;
+    pthread_create(&writer, NULL, WriterThread, this);
+  }
+
+  /**
+     Offers a state to the writer: it becomes the pending state, if 
+     it is better than all the states offered before. Only the state
+     is copied in the calling thread.
+
+     @param st the state
+     @param cost the cost of the state
+  */
+  template <class Input, class Output, class State>
+  void SnapshotWriter<Input,Output,State>::Offer(const State& st, fvalue cost)
+  {
+    pthread_mutex_lock(&lock);
+    if (running && cost < offered_cost)
+      {
+	pending = st;
+	offered_cost = cost;
+	has_pending = true;
+	pthread_cond_signal(&wakeup);
+      }
+    pthread_mutex_unlock(&lock);
+  }
+
+  /**
+     Stops the writer thread, after writing the pending state.
+  */
+  template <class Input, class Output, class State>
+  void SnapshotWriter<Input,Output,State>::Stop()
+  {
+    pthread_mutex_lock(&lock);
+    bool was_running = running;
+    running = false;
+    pthread_cond_signal(&wakeup);
+    pthread_mutex_unlock(&lock);
+    if (was_running)
+      pthread_join(writer, NULL);
+  }
+
+  /**
+     The body of the writer thread: it waits for a pending state and
+     for the end of the interval since the last snapshot (or for the
+     stop), and then writes the state.
+  */
+  template <class Input, class Output, class State>
+  void* SnapshotWriter<Input,Output,State>::WriterThread(void* arg)
+  {
+    SnapshotWriter& w = *static_cast<SnapshotWriter*>(arg);
+    State st;
+    double last_write = WallClock::Now() - w.interval;
+    st.SetInput(w.p_in);
+    pthread_mutex_lock(&w.lock);
+    while (true)
+      {
+	while (w.running && !w.has_pending)
+	  pthread_cond_wait(&w.wakeup, &w.lock);
+	if (!w.has_pending)
+	  break;
+	double next_write = last_write + w.interval;
+	while (w.running && WallClock::Now() < next_write)
+	  {
+	    struct timespec t;
+	    t.tv_sec = (time_t)next_write;
+	    t.tv_nsec = (long)((next_write - t.tv_sec) * 1e9);
+	    pthread_cond_timedwait(&w.wakeup, &w.lock, &t);
+	  }
+	st = w.pending;
+	w.has_pending = false;
+	pthread_mutex_unlock(&w.lock);
+	w.Write(st);
+	last_write = WallClock::Now();
+	pthread_mutex_lock(&w.lock);
+      }
+    pthread_mutex_unlock(&w.lock);
+    return NULL;
+  }
+
+  /**
+     Writes a state to the file of the snapshots, by means of the output
+     manager.
+
+     @param st the state
+  */
+  template <class Input, class Output, class State>
+  void SnapshotWriter<Input,Output,State>::Write(const State& st)
+  {
+    Output out;
+    std::string temporary = file_name + ".tmp";
+    out.SetInput(p_in);
+    p_om->OutputState(st,out);
+    {
+      std::ofstream os(temporary.c_str());
+      os << out;
+      if (!os)
+	return;
+    }
+    if (rename(temporary.c_str(), file_name.c_str()) == 0)
+      written++;
+  }
+
   // Prohibition Manager functions
   // up to now, the only actual prohibition manager is the tabu list manager
 
@@ -302,6 +693,9 @@ namespace easylocal {
 
   /** 
       Checks whether the inverse of a given move belongs to the tabu list.
+      It can be redefined, together with InsertIntoList and Clean, in
+      order to replace the list of moves with a different representation
+      of the prohibitions (e.g., tables indexed by move attributes).
       
       @param mv the move to check
       @return true if the inverse of the move belongs to the tabu list, 
@@ -356,7 +750,10 @@ namespace easylocal {
 
   /**
      Inserts the move into the tabu list, and update the list removing
-     the moves for which the tenure has elapsed.
+     the moves for which the tenure has elapsed. 
+     A move inserted when the iteration counter is k, with tenure t, is 
+     prohibited until the counter (incremented at each insertion) 
+     exceeds k + t.
 
      @param mv the move to add
   */
@@ -376,6 +773,61 @@ namespace easylocal {
     iter++;
   }
 
+  // Static Tabu List Manager functions
+
+  /** 
+      Constructs a static tabu list manager object (see TabuListManager).
+      
+      @param min the minimum tabu tenure
+      @param max the maximum tabu tenure
+  */
+  template <class Move, class Manager>
+  StaticTabuListManager<Move,Manager>::StaticTabuListManager(int min, int max)
+    : TabuListManager<Move>(min,max)
+  { }
+
+  /**
+     Checks whether the given move is prohibited, invoking the 
+     @c ListMember and @c Aspiration functions of the concrete manager
+     without virtual dispatch.
+
+     @param mv the move to check
+     @param mv_cost the move cost
+     @param curr the current state cost
+     @param best the best state cost found so far
+     @return true if the move mv is prohibited, false otherwise
+  */
+  template <class Move, class Manager>
+  bool StaticTabuListManager<Move,Manager>::ProhibitedMove(const Move& mv, fvalue mv_cost, fvalue curr, fvalue best) const
+  { 
+    const Manager* m = static_cast<const Manager*>(this);
+    return m->Manager::ListMember(mv) && !m->Manager::Aspiration(mv,mv_cost,curr,best); 
+  }
+
+  /** 
+      Checks whether the inverse of a given move belongs to the tabu list,
+      invoking the @c Inverse function of the concrete manager without
+      virtual dispatch.
+      
+      @param mv the move to check
+      @return true if the inverse of the move belongs to the tabu list, 
+      false otherwise
+  */
+  template <class Move, class Manager>
+  bool StaticTabuListManager<Move,Manager>::ListMember(const Move& mv) const
+  {
+    const Manager* m = static_cast<const Manager*>(this);
+    typename std::list<ListItem<Move> >::const_iterator p = this->tlist.begin();
+    while (p != this->tlist.end())
+      {
+	if (m->Manager::Inverse(mv,p->elem))
+	  return true;
+	else
+	  p++;
+      }
+    return false;
+  }
+
   // Neighborhood explorer functions
 
   /**
@@ -387,7 +839,7 @@ namespace easylocal {
   */
   template <class Input, class State, class Move>  
   NeighborhoodExplorer<Input,State,Move>::NeighborhoodExplorer(StateManager<Input,State>* sm, Input* in) 
-    :  p_sm(sm), p_in(in), p_pm(NULL)
+    :  p_sm(sm), p_in(in), p_pm(NULL), p_fm(NULL)
   {}
 
   /**
@@ -401,7 +853,7 @@ namespace easylocal {
   */
   template <class Input, class State, class Move>  
   NeighborhoodExplorer<Input,State,Move>::NeighborhoodExplorer(StateManager<Input,State>* sm, ProhibitionManager<Move>* pm, Input* in) 
-    :  p_sm(sm), p_in(in), p_pm(pm)
+    :  p_sm(sm), p_in(in), p_pm(pm), p_fm(NULL)
   {}
 
   /**
@@ -416,7 +868,47 @@ namespace easylocal {
   */
   template <class Input, class State, class Move>  
   fvalue NeighborhoodExplorer<Input,State,Move>::DeltaCostFunction(const State& st, const Move & mv)
-  { return HARD_WEIGHT * DeltaViolations(st,mv) + DeltaObjective(st,mv); }
+  { return WeightedCost(DeltaViolations(st,mv),DeltaObjective(st,mv)); }
+
+  /**
+     Evaluates the variation of the cost function for a batch of moves
+     applied to the same state.
+     The tentative definition invokes DeltaCostFunction on each move; it
+     can be redefined in order to evaluate the whole batch in a single
+     non-virtual loop.
+
+     @param st the start state
+     @param mv the array of moves
+     @param n the number of moves
+     @param delta the array that receives the variation of the cost 
+     function of each move
+  */
+  template <class Input, class State, class Move>  
+  void NeighborhoodExplorer<Input,State,Move>::BatchDeltaCostFunction(const State& st, const Move mv[], unsigned n, fvalue delta[])
+  { 
+    for (unsigned i = 0; i < n; i++)
+      delta[i] = DeltaCostFunction(st,mv[i]); 
+  }
+
+  /**
+     Draws a number of random moves from a given state and evaluates them
+     as a batch; the moves and their costs are stored in sample_moves
+     and sample_deltas.
+
+     @param st the state
+     @param samples the number of moves to draw (at least one is drawn)
+  */
+  template <class Input, class State, class Move>  
+  void NeighborhoodExplorer<Input,State,Move>::SampleMoves(const State& st, int samples)
+  {
+    if (samples < 1)
+      samples = 1;
+    sample_moves.resize(samples);
+    sample_deltas.resize(samples);
+    for (int s = 0; s < samples; s++)
+      RandomMove(st,sample_moves[s]);
+    BatchDeltaCostFunction(st,&sample_moves[0],samples,&sample_deltas[0]);
+  }
 
   /**
      Sets the prohibition manager to the value passed as input.
@@ -427,6 +919,16 @@ namespace easylocal {
   void NeighborhoodExplorer<Input,State,Move>::SetProhibitionManager(ProhibitionManager<Move>* pm) 
   { p_pm = pm; }
 
+  /**
+     Sets the frequency manager whose penalties are used in the 
+     selection of the non prohibited moves.
+     
+     @param fm a pointer to a frequency manager (NULL for none)
+  */
+  template <class Input, class State, class Move>  
+  void NeighborhoodExplorer<Input,State,Move>::SetFrequencyManager(FrequencyManager<Move>* fm) 
+  { p_fm = fm; }
+
 
   /**
      Looks for the best move in the exploration of the neighborhood of a given 
@@ -527,29 +1029,25 @@ namespace easylocal {
   template <class Input, class State, class Move>  
   fvalue NeighborhoodExplorer<Input,State,Move>::SampleMove(const State &st, Move& mv, int samples)
   {  
-    int s = 1;
-    RandomMove(st,mv);
-    fvalue mv_cost = DeltaCostFunction(st,mv);
-    best_move = mv;
-    fvalue best_delta = mv_cost;
-    do // look for the best sampled move
-      { 
-	mv_cost = DeltaCostFunction(st,mv);
-	if (mv_cost < best_delta)
+    SampleMoves(st,samples);
+    best_move = sample_moves[0];
+    fvalue best_delta = sample_deltas[0];
+    for (unsigned s = 1; s < sample_moves.size(); s++)
+      { // look for the best sampled move
+	if (sample_deltas[s] < best_delta)
 	  { 
-	    best_move = mv;
-	    best_delta = mv_cost;
+	    best_move = sample_moves[s];
+	    best_delta = sample_deltas[s];
 	  }
-	RandomMove(st,mv);
-	s++;
       }
-    while (s < samples);
     mv = best_move;
     return best_delta;
   }
 
   /** 
       Looks for the best move in a given state that is non prohibited.
+      During a diversification phase of the attached frequency manager,
+      the moves are compared on their cost plus their penalty.
       
       @param st the state
       @param mv the best non prohibited move in st
@@ -560,23 +1058,27 @@ namespace easylocal {
   template <class Input, class State, class Move>  
   fvalue NeighborhoodExplorer<Input,State,Move>::BestNonProhibitedMove(const State &st, Move& mv, fvalue curr, fvalue best) 
   {
-    register fvalue mv_cost;
+    register fvalue mv_cost, mv_value;
     bool tabu_move;
     bool all_moves_tabu = true;
+    bool diversify = Diversifying();
 	
     FirstMove(st,mv); 
     mv_cost = DeltaCostFunction(st,mv);
     best_move = mv;
     fvalue best_delta = mv_cost;
+    fvalue best_value = diversify ? mv_cost + p_fm->Penalty(mv) : mv_cost;
     do  // look for the best non prohibited move 
       { // (if all moves are prohibited, then get the best)
 	tabu_move = p_pm->ProhibitedMove(mv,mv_cost,curr,best);      
-	if (   (mv_cost < best_delta && !tabu_move)
-	       || (mv_cost < best_delta && all_moves_tabu)
+	mv_value = diversify ? mv_cost + p_fm->Penalty(mv) : mv_cost;
+	if (   (mv_value < best_value && !tabu_move)
+	       || (mv_value < best_value && all_moves_tabu)
 	       || (all_moves_tabu && !tabu_move))
 	  { 
 	    best_move = mv;
 	    best_delta = mv_cost;
+	    best_value = mv_value;
 	  }
 	if (!tabu_move) 
 	  all_moves_tabu = false;
@@ -603,32 +1105,27 @@ namespace easylocal {
   template <class Input, class State, class Move>  
   fvalue NeighborhoodExplorer<Input,State,Move>::SampleNonProhibitedMove(const State &st, Move& mv, int samples, fvalue curr, fvalue best)
   {  
-    int s = 1;
     fvalue mv_cost;
     bool tabu_move;
     bool all_moves_tabu = true;
 	
-    RandomMove(st,mv);
-    mv_cost = DeltaCostFunction(st,mv);
-    best_move = mv;
-    fvalue best_delta = mv_cost;
-    do 
+    SampleMoves(st,samples);
+    best_move = sample_moves[0];
+    fvalue best_delta = sample_deltas[0];
+    for (unsigned s = 0; s < sample_moves.size(); s++)
       { 
-	tabu_move = p_pm->ProhibitedMove(mv,mv_cost,curr,best);      
+	mv_cost = sample_deltas[s];
+	tabu_move = p_pm->ProhibitedMove(sample_moves[s],mv_cost,curr,best);      
 	if (   (mv_cost < best_delta && !tabu_move)
 	       || (mv_cost < best_delta && all_moves_tabu)
 	       || (all_moves_tabu && !tabu_move))
 	  { 
-	    best_move = mv;
+	    best_move = sample_moves[s];
 	    best_delta = mv_cost;
 	  }
 	if (!tabu_move) 
 	  all_moves_tabu = false;
-	RandomMove(st,mv);
-	mv_cost = DeltaCostFunction(st,mv);
-	s++;
       }
-    while (s < samples);
     mv = best_move;
     return best_delta;
   }
@@ -738,57 +1235,197 @@ namespace easylocal {
   bool NeighborhoodExplorer<Input,State,Move>::LastMoveDone(const Move &mv) 
   { return mv == start_move; } 
 
-  // Runner functions
+  // Static Neighborhood explorer functions
 
   /**
-     Constructs a runner and associates a name and a type to it.
-
-     @param s the name of the runner
-     @param t the type of the runner (used for parameter setting)
+     Constructs a static neighborhood explorer passing a pointer to a 
+     state manager and a pointer to the input.
+     
+     @param sm a pointer to a compatible state manager
+     @param in a pointer to an input object
   */
-  template <class Input, class State>
-  Runner<Input,State>::Runner(std::string s, std::string t)
-    : name(s), type(t) 
+  template <class Input, class State, class Move, class Explorer, class Manager>
+  StaticNeighborhoodExplorer<Input,State,Move,Explorer,Manager>::StaticNeighborhoodExplorer(StateManager<Input,State>* sm, Input* in) 
+    : NeighborhoodExplorer<Input,State,Move>(sm,in), p_static_pm(NULL)
   {}
 
-  /** 
-      Inspects the name of the runner.
-      
-      @return the name of the runner
-  */
-  template <class Input, class State>
-  std::string Runner<Input,State>::Name() 
-  { return name; }
-
-  /** 
-      Inspects the type of the runner.
-      
-      @return the type of the runner
-  */
-  template <class Input, class State>
-  std::string Runner<Input,State>::Type()
-  { return type; }
-
   /**
-     Sets the name of the runner to the given parameter.
+     Sets the prohibition manager to the value passed as input; if it is
+     a @c Manager, its prohibition test is invoked without virtual 
+     dispatch.
      
-     @param s the name to give to the runner
+     @param pm a pointer to a prohibition manager
   */
-  template <class Input, class State>
-  void Runner<Input,State>::SetName(std::string s) 
-  { name = s; } 
+  template <class Input, class State, class Move, class Explorer, class Manager>
+  void StaticNeighborhoodExplorer<Input,State,Move,Explorer,Manager>::SetProhibitionManager(ProhibitionManager<Move> *pm) 
+  { 
+    NeighborhoodExplorer<Input,State,Move>::SetProhibitionManager(pm);
+    p_static_pm = dynamic_cast<Manager*>(pm); 
+  }
 
   /**
-     Creates a move runner and links it to a given state manager, neighborhood
-     explorer and input objects. In addition, it sets its name and type to
-     the given values.
+     Checks whether the given move is prohibited by the attached 
+     prohibition manager.
 
-     @param sm a pointer to a compatible state manager
-     @param ne a pointer to a compatible neighborhood explorer
-     @param in a pointer to the input object
-     @param name the name of the runner
-     @param type the type of the runner
-  */
+     @param mv the move to check
+     @param mv_cost the move cost
+     @param curr the current state cost
+     @param best the best state cost found so far
+     @return true if the move mv is prohibited, false otherwise
+  */
+  template <class Input, class State, class Move, class Explorer, class Manager>
+  bool StaticNeighborhoodExplorer<Input,State,Move,Explorer,Manager>::Prohibited(const Move& mv, fvalue mv_cost, fvalue curr, fvalue best) const
+  { 
+    if (p_static_pm != NULL)
+      return p_static_pm->Manager::ProhibitedMove(mv,mv_cost,curr,best);
+    else
+      return this->p_pm->ProhibitedMove(mv,mv_cost,curr,best);
+  }
+
+  /**
+     Evaluates the variation of the cost function obtainted by applying the
+     move to the given state (see NeighborhoodExplorer), invoking the 
+     components of the concrete explorer without virtual dispatch.
+
+     @param st the start state
+     @param mv the move
+     @return the variation in the cost function
+  */
+  template <class Input, class State, class Move, class Explorer, class Manager>
+  fvalue StaticNeighborhoodExplorer<Input,State,Move,Explorer,Manager>::DeltaCostFunction(const State& st, const Move & mv)
+  { 
+    return WeightedCost(Self().Explorer::DeltaViolations(st,mv),
+			Self().Explorer::DeltaObjective(st,mv)); 
+  }
+
+  /**
+     Looks for the best move in the exploration of the neighborhood of a 
+     given state (see NeighborhoodExplorer).
+
+     @param st the state 
+     @param mv the best move in the state st
+     @return the cost of the move mv
+  */
+  template <class Input, class State, class Move, class Explorer, class Manager>
+  fvalue StaticNeighborhoodExplorer<Input,State,Move,Explorer,Manager>::BestMove(const State &st, Move& mv) 
+  {
+    Explorer& e = Self();
+    e.Explorer::FirstMove(st,mv); 
+    fvalue mv_cost = e.Explorer::DeltaCostFunction(st,mv);
+    this->best_move = mv; 
+    fvalue best_delta = mv_cost;
+    do // look for the best move
+      { 
+	mv_cost = e.Explorer::DeltaCostFunction(st,mv);
+	if (mv_cost < best_delta) 
+	  { 
+	    this->best_move = mv;
+	    best_delta = mv_cost;
+	  }
+	e.Explorer::NextMove(st,mv);
+      }
+    while (!e.Explorer::LastMoveDone(mv));
+    mv = this->best_move;
+    return best_delta;
+  }
+
+  /** 
+      Looks for the best move in a given state that is non prohibited
+      (see NeighborhoodExplorer).
+      
+      @param st the state
+      @param mv the best non prohibited move in st
+      @param curr the cost of the state st
+      @param best the cost of the best state found so far
+      @return the cost of the move mv
+  */
+  template <class Input, class State, class Move, class Explorer, class Manager>
+  fvalue StaticNeighborhoodExplorer<Input,State,Move,Explorer,Manager>::BestNonProhibitedMove(const State &st, Move& mv, fvalue curr, fvalue best) 
+  {
+    Explorer& e = Self();
+    fvalue mv_cost, mv_value;
+    bool tabu_move;
+    bool all_moves_tabu = true;
+    bool diversify = this->Diversifying();
+	
+    e.Explorer::FirstMove(st,mv); 
+    mv_cost = e.Explorer::DeltaCostFunction(st,mv);
+    this->best_move = mv;
+    fvalue best_delta = mv_cost;
+    fvalue best_value = diversify ? mv_cost + this->p_fm->Penalty(mv) : mv_cost;
+    do  // look for the best non prohibited move 
+      { // (if all moves are prohibited, then get the best)
+	tabu_move = Prohibited(mv,mv_cost,curr,best);      
+	mv_value = diversify ? mv_cost + this->p_fm->Penalty(mv) : mv_cost;
+	if (   (mv_value < best_value && !tabu_move)
+	       || (mv_value < best_value && all_moves_tabu)
+	       || (all_moves_tabu && !tabu_move))
+	  { 
+	    this->best_move = mv;
+	    best_delta = mv_cost;
+	    best_value = mv_value;
+	  }
+	if (!tabu_move) 
+	  all_moves_tabu = false;
+	e.Explorer::NextMove(st,mv);
+	mv_cost = e.Explorer::DeltaCostFunction(st,mv);
+      }
+    while (!e.Explorer::LastMoveDone(mv));
+    mv = this->best_move;
+    return best_delta;
+  } 
+
+  // Runner functions
+
+  /**
+     Constructs a runner and associates a name and a type to it.
+
+     @param s the name of the runner
+     @param t the type of the runner (used for parameter setting)
+  */
+  template <class Input, class State>
+  Runner<Input,State>::Runner(std::string s, std::string t)
+    : name(s), type(t) 
+  {}
+
+  /** 
+      Inspects the name of the runner.
+      
+      @return the name of the runner
+  */
+  template <class Input, class State>
+  std::string Runner<Input,State>::Name() 
+  { return name; }
+
+  /** 
+      Inspects the type of the runner.
+      
+      @return the type of the runner
+  */
+  template <class Input, class State>
+  std::string Runner<Input,State>::Type()
+  { return type; }
+
+  /**
+     Sets the name of the runner to the given parameter.
+     
+     @param s the name to give to the runner
+  */
+  template <class Input, class State>
+  void Runner<Input,State>::SetName(std::string s) 
+  { name = s; } 
+
+  /**
+     Creates a move runner and links it to a given state manager, neighborhood
+     explorer and input objects. In addition, it sets its name and type to
+     the given values.
+
+     @param sm a pointer to a compatible state manager
+     @param ne a pointer to a compatible neighborhood explorer
+     @param in a pointer to the input object
+     @param name the name of the runner
+     @param type the type of the runner
+  */
   template <class Input, class State, class Move>
   MoveRunner<Input,State,Move>::MoveRunner(StateManager<Input,State>* sm, NeighborhoodExplorer<Input,State,Move>* ne, Input* in, std::string name, std::string type)
     : Runner<Input,State>(name,type), p_in(in), p_sm(sm), p_nhe(ne)
@@ -797,6 +1434,10 @@ namespace easylocal {
       current_state.SetInput(in);
     number_of_iterations = 0;
     max_iteration = ULONG_MAX;
+    time_limit = 0;
+    deadline = 0;
+    p_observer = NULL;
+    observer_batch = 1000;
     current_state_set = false; 
   }
 
@@ -937,6 +1578,40 @@ namespace easylocal {
   void MoveRunner<Input,State,Move>::SetMaxIteration(unsigned long max)  
   { max_iteration = max; }
 
+  /**
+     Sets the maximum wall time of a run.
+
+     @param s the time limit in seconds (0 for no limit)
+  */
+  template <class Input, class State, class Move>
+  void MoveRunner<Input,State,Move>::SetTimeLimit(double s)  
+  { time_limit = s; }
+
+  /**
+     Sets the time at which a run has to stop anyway.
+
+     @param t the deadline, as given by WallClock::Now() (0 for no deadline)
+  */
+  template <class Input, class State, class Move>
+  void MoveRunner<Input,State,Move>::SetDeadline(double t)  
+  { deadline = t; }
+
+  /**
+     Attaches an observer to the runner. The new best and iteration
+     batch events are delivered once every @c batch iterations, 
+     therefore a batch of 1 delivers every new best state.
+
+     @param o the observer (NULL for detaching it)
+     @param batch the number of iterations between two deliveries
+  */
+  template <class Input, class State, class Move>
+  void MoveRunner<Input,State,Move>::SetObserver(SearchObserver* o, unsigned long batch)  
+  { 
+    assert(batch > 0);
+    p_observer = o; 
+    observer_batch = batch;
+  }
+
   /**
      Sets the runner parameters, passed through a parameter box.
 
@@ -957,7 +1632,8 @@ namespace easylocal {
   { 
     assert(current_state_set);
     InitializeRun();
-    while (!MaxIterationExpired() && !StopCriterion() && !LowerBoundReached())
+    while (!MaxIterationExpired() && !StopCriterion() && !LowerBoundReached()
+	   && !TimeExpired() && !ObserverInterrupt())
       { 
 	UpdateIterationCounter();
 	SelectMove();
@@ -972,6 +1648,7 @@ namespace easylocal {
 	  }
       }
     TerminateRun();
+    NotifyRunStopped();
   }
 
   /**
@@ -1060,6 +1737,63 @@ namespace easylocal {
   bool MoveRunner<Input,State,Move>::MaxIterationExpired() 
   { return number_of_iterations > max_iteration; }
 
+  /**
+     Reads the clock, and sets the number of iterations before the next
+     reading so that the clock is read about every TIME_CHECK_PERIOD
+     seconds (the interval is at most doubled at each reading).
+
+     @return true if the time of the run is over
+  */
+  template <class Input, class State, class Move>
+  bool MoveRunner<Input,State,Move>::CheckTime() 
+  { 
+    double now = WallClock::Now();
+    if (now >= end_time)
+      return true;
+    double speed = (number_of_iterations - (next_time_check - time_check_interval))
+      / (now - last_time_check + 1e-9);
+    unsigned long interval = (unsigned long)(speed * TIME_CHECK_PERIOD);
+    if (interval > 2 * time_check_interval)
+      interval = 2 * time_check_interval;
+    time_check_interval = interval > 0 ? interval : 1;
+    next_time_check = number_of_iterations + time_check_interval;
+    last_time_check = now;
+    return false;
+  }
+
+  /**
+     Delivers the new best (if any) and the iteration batch events to 
+     the observer, and schedules the next delivery. The best cost is
+     taken as the minimum with the current one, because some runners
+     update the best state only at the end of the run.
+
+     @return true if the observer has stopped the run
+  */
+  template <class Input, class State, class Move>
+  bool MoveRunner<Input,State,Move>::NotifyObserver() 
+  { 
+    next_observation = number_of_iterations + observer_batch;
+    fvalue best_cost = std::min(best_state_cost, current_state_cost);
+    if (best_cost < delivered_best_cost)
+      {
+	delivered_best_cost = best_cost;
+	p_observer->NewBest(this->name, number_of_iterations, best_cost);
+      }
+    return !p_observer->IterationBatch(this->name, number_of_iterations, 
+				       current_state_cost, best_cost);
+  }
+
+  /**
+     Delivers the end of the run to the observer, if one is attached.
+  */
+  template <class Input, class State, class Move>
+  void MoveRunner<Input,State,Move>::NotifyRunStopped() 
+  { 
+    if (p_observer != NULL)
+      p_observer->RunStopped(this->name, number_of_iterations, 
+			     std::min(best_state_cost, current_state_cost));
+  }
+
   /** 
       Checks whether the selected move can be performed.
       Its tentative definition simply returns true
@@ -1086,6 +1820,49 @@ namespace easylocal {
     ComputeCost();
     best_state = current_state;
     best_state_cost = current_state_cost;
+    last_time_check = WallClock::Now();
+    end_time = time_limit > 0 ? last_time_check + time_limit : 0;
+    if (deadline > 0 && (end_time == 0 || deadline < end_time))
+      end_time = deadline;
+    time_check_interval = 1;
+    next_time_check = end_time > 0 ? 1 : ULONG_MAX;
+    next_observation = p_observer != NULL ? observer_batch : ULONG_MAX;
+    delivered_best_cost = current_state_cost;
+    if (p_observer != NULL)
+      p_observer->RunStarted(this->name, current_state_cost);
+  }
+
+  // Static Runner Loop
+
+  /**
+     Performs a full run of the runner @c Runner, with the same steps of
+     MoveRunner::Go but without virtual dispatch.
+
+     @param r the runner
+  */
+  template <class Runner>
+  void StaticRunnerLoop<Runner>::Go(Runner& r)
+  { 
+    assert(r.current_state_set);
+    r.Runner::InitializeRun();
+    while (!r.MaxIterationExpired() && !r.Runner::StopCriterion() 
+	   && !r.Runner::LowerBoundReached() && !r.TimeExpired()
+	   && !r.ObserverInterrupt())
+      { 
+	r.Runner::UpdateIterationCounter();
+	r.Runner::SelectMove();
+#ifdef TRACE_MOVES
+	r.Print(); std::cerr << "press any key ... "; std::cin.get();
+#endif
+	if (r.Runner::AcceptableMove())
+	  { 
+	    r.Runner::MakeMove();
+	    r.Runner::UpdateStateCost();
+	    r.Runner::StoreMove();
+	  }
+      }
+    r.Runner::TerminateRun();
+    r.NotifyRunStopped();
   }
 
   // Actual Runners
@@ -1203,6 +1980,52 @@ namespace easylocal {
     os << std::endl;
   }
 
+  // Static Hill Climbing
+
+  /**
+     Constructs a static hill climbing runner by linking it to a state
+     manager, a concrete neighborhood explorer, and an input object.
+
+     @param s a pointer to a compatible state manager
+     @param ne a pointer to a compatible neighborhood explorer
+     @param in a poiter to an input object
+  */
+  template <class Input, class State, class Move, class Explorer>
+  StaticHillClimbing<Input,State,Move,Explorer>::StaticHillClimbing(StateManager<Input,State>* s, Explorer* ne, Input* in)
+    : HillClimbing<Input,State,Move>(s, ne, in), p_static_nhe(ne)
+  {}
+
+  /**
+     Performs a full run of the hill climbing, with all the steps of the
+     iteration statically bound.
+  */
+  template <class Input, class State, class Move, class Explorer>
+  void StaticHillClimbing<Input,State,Move,Explorer>::Go()
+  { StaticRunnerLoop<StaticHillClimbing>::Go(*this); }
+
+  /**
+     Selects a random move, without virtual dispatch.
+  */
+  template <class Input, class State, class Move, class Explorer>
+  void StaticHillClimbing<Input,State,Move,Explorer>::SelectMove() 
+  { 
+    p_static_nhe->Explorer::RandomMove(this->current_state,this->current_move); 
+    this->current_move_cost = p_static_nhe->Explorer::DeltaCostFunction(this->current_state,this->current_move);
+  }
+
+  /**
+     Performs the selected move, without virtual dispatch.
+  */
+  template <class Input, class State, class Move, class Explorer>
+  void StaticHillClimbing<Input,State,Move,Explorer>::MakeMove() 
+  { 
+#if defined(TRACE_MOVES) || defined(COST_DEBUG) || defined(PLOT_DATA)
+    HillClimbing<Input,State,Move>::MakeMove();
+#else
+    p_static_nhe->Explorer::MakeMove(this->current_state,this->current_move); 
+#endif
+  }
+
   // Steepest Descent
 
   /**
@@ -1294,7 +2117,8 @@ namespace easylocal {
   */
   template <class Input, class State, class Move>
   TabuSearch<Input,State,Move>::TabuSearch(StateManager<Input,State>* s, NeighborhoodExplorer<Input,State,Move>* ne, TabuListManager<Move>* tlm, Input* in)
-    : MoveRunner<Input,State,Move>(s, ne, in, "Runner name", "Tabu Search")
+    : MoveRunner<Input,State,Move>(s, ne, in, "Runner name", "Tabu Search"), p_fm(NULL),
+      diversification_idle(0)
   { 
     if (in != NULL)
       this->best_state.SetInput(in);
@@ -1329,6 +2153,11 @@ namespace easylocal {
     p_pm->SetLength(min_tabu,max_tabu);
     std::cout << "Number of idle iterations: ";
     std::cin >> this->max_idle_iteration;
+    if (p_fm != NULL)
+      {
+	std::cout << "Idle iterations before diversification (0 for none): ";
+	std::cin >> diversification_idle;
+      }
   }
 
   /**
@@ -1347,10 +2176,21 @@ namespace easylocal {
     this->p_nhe->SetProhibitionManager(p_pm);
   }
 
+  /**
+     Sets the frequency manager used as long-term memory. It is used 
+     only if the diversification parameter is set: when the search has 
+     been idle for that number of iterations, it enters a 
+     diversification phase that lasts until a new best state is found.
+     
+     @param fm a pointer to a compatible frequency manager (NULL for none)
+  */
+  template <class Input, class State, class Move>
+  void TabuSearch<Input,State,Move>::SetFrequencyManager(FrequencyManager<Move>* fm)
+  { p_fm = fm; }
 
   /**
      Initializes the run by invoking the companion superclass method, and
-     cleans the tabu list.
+     cleans the tabu list and the frequencies.
   */
   template <class Input, class State, class Move>
   void TabuSearch<Input,State,Move>::InitializeRun()
@@ -1358,6 +2198,13 @@ namespace easylocal {
     MoveRunner<Input,State,Move>::InitializeRun(); 
     assert(this->max_idle_iteration > 0);
     p_pm->Clean();
+    // the explorer may be shared with runners without long-term memory
+    this->p_nhe->SetFrequencyManager(p_fm);
+    if (p_fm != NULL)
+      {
+	p_fm->Clean();
+	p_fm->SetDiversification(false);
+      }
   }
 
   /** 
@@ -1398,6 +2245,7 @@ namespace easylocal {
     pb.Get("min tenure", min_tabu);
     pb.Get("max tenure", max_tabu);
     p_pm->SetLength(min_tabu,max_tabu);
+    pb.Get("diversification", diversification_idle);
   }
 
   /**
@@ -1414,6 +2262,22 @@ namespace easylocal {
 	this->best_state = this->current_state;
 	this->best_state_cost = this->current_state_cost;
       }
+    UpdateFrequencies();
+  }
+
+  /**
+     Records the move in the frequency manager (if any), and starts or 
+     ends the diversification phase according to the number of idle
+     iterations.
+  */
+  template <class Input, class State, class Move>  
+  void TabuSearch<Input,State,Move>::UpdateFrequencies()
+  {
+    if (p_fm == NULL || diversification_idle == 0)
+      return;
+    p_fm->InsertMove(this->current_move);
+    p_fm->SetDiversification(this->number_of_iterations - this->iteration_of_best 
+			     >= diversification_idle);
   }
 
   /**
@@ -1429,6 +2293,7 @@ namespace easylocal {
     os << "  Max idle iteration : " << this->max_idle_iteration << std::endl;
     os << "  Max iteration : " << this->max_iteration << std::endl;
     os << "  Tenure : " << p_pm->MinTenure() << '-' << p_pm->MaxTenure() << std::endl;
+    os << "  Diversification : " << diversification_idle << std::endl;
     os << "RESULTS : " << std::endl;
     os << "  Number of iterations : " << this->number_of_iterations << std::endl;
     os << "  Iteration of best : " << this->iteration_of_best << std::endl;
@@ -1443,55 +2308,261 @@ namespace easylocal {
     os << std::endl << std::endl;
   }
 
-  // Simulated Annealing
+  // Static Tabu Search
 
   /**
-     Constructs a simulated annealing runner by linking it to a state manager, 
-     a neighborhood explorer, and an input object.cd ../
+     Constructs a static tabu search runner by linking it to a state
+     manager, a concrete neighborhood explorer, a concrete tabu list 
+     manager, and an input object.
 
      @param s a pointer to a compatible state manager
      @param ne a pointer to a compatible neighborhood explorer
+     @param tlm a pointer to a compatible tabu list manager
      @param in a poiter to an input object
   */
-  template <class Input, class State, class Move>
-  SimulatedAnnealing<Input,State,Move>::SimulatedAnnealing(StateManager<Input,State>* s, NeighborhoodExplorer<Input,State,Move>* ne, Input* in)
-    : MoveRunner<Input,State,Move>(s, ne, in, "Runner name", "Simulated Annealing")
+  template <class Input, class State, class Move, class Explorer, class Manager>
+  StaticTabuSearch<Input,State,Move,Explorer,Manager>::StaticTabuSearch(StateManager<Input,State>* s, Explorer* ne, Manager* tlm, Input* in)
+    : TabuSearch<Input,State,Move>(s, ne, tlm, in), p_static_nhe(ne), p_static_tlm(tlm)
+  {}
+
+  /**
+     Performs a full run of the tabu search, with all the steps of the
+     iteration statically bound.
+  */
+  template <class Input, class State, class Move, class Explorer, class Manager>
+  void StaticTabuSearch<Input,State,Move,Explorer,Manager>::Go()
+  { StaticRunnerLoop<StaticTabuSearch>::Go(*this); }
+
+  /** 
+      Selects the best move that is non prohibited by the tabu list, 
+      without virtual dispatch.
+  */
+  template <class Input, class State, class Move, class Explorer, class Manager>
+  void StaticTabuSearch<Input,State,Move,Explorer,Manager>::SelectMove() 
+  { this->current_move_cost = p_static_nhe->Explorer::BestNonProhibitedMove(this->current_state, this->current_move, this->current_state_cost, this->best_state_cost); }
+
+  /**
+     Performs the selected move, without virtual dispatch.
+  */
+  template <class Input, class State, class Move, class Explorer, class Manager>
+  void StaticTabuSearch<Input,State,Move,Explorer,Manager>::MakeMove() 
   { 
-    min_temperature = 0.0001;
+#if defined(TRACE_MOVES) || defined(COST_DEBUG) || defined(PLOT_DATA)
+    TabuSearch<Input,State,Move>::MakeMove();
+#else
+    p_static_nhe->Explorer::MakeMove(this->current_state,this->current_move); 
+#endif
   }
 
   /**
-     Reads the simulated annealing parameters from the standard input.
-  */  
-  template <class Input, class State, class Move>
-  void SimulatedAnnealing<Input,State,Move>::ReadParameters()
+     Inserts the move in the tabu list and updates the best state (see
+     TabuSearch), without virtual dispatch.
+  */
+  template <class Input, class State, class Move, class Explorer, class Manager>
+  void StaticTabuSearch<Input,State,Move,Explorer,Manager>::StoreMove()
   {
-    std::cout << "SIMULATED ANNEALING -- INPUT PARAMETERS" << std::endl;
-    std::cout << "Start temperature: ";
-    std::cin >> start_temperature;
-    std::cout << "Cooling rate: ";
-    std::cin >> cooling_rate;
-    std::cout << "Neighbors sampled at each temperature : ";
-    std::cin >> neighbor_sample;
+    p_static_tlm->Manager::InsertMove(this->current_move, this->current_move_cost, this->current_state_cost, this->best_state_cost);
+    if (this->current_state_cost + EPS < this->best_state_cost)
+      { 
+	this->iteration_of_best = this->number_of_iterations;
+	this->best_state = this->current_state;
+	this->best_state_cost = this->current_state_cost;
+      }
+    this->UpdateFrequencies();
   }
 
+  // Reactive Tabu Search
+
   /**
-     Initializes the run by invoking the companion superclass method, and
-     setting the temperature to the start value.
+     Constructs a reactive tabu search runner by linking it to a state 
+     manager, a neighborhood explorer, a tabu list manager, and an input
+     object.
+
+     @param s a pointer to a compatible state manager
+     @param ne a pointer to a compatible neighborhood explorer
+     @param tlm a pointer to a compatible tabu list manager
+     @param in a poiter to an input object
   */
   template <class Input, class State, class Move>
-  void SimulatedAnnealing<Input,State,Move>::InitializeRun()
-  {
-    MoveRunner<Input,State,Move>::InitializeRun(); 
-    assert(start_temperature > 0 && cooling_rate > 0 && neighbor_sample > 0);
-    temperature = start_temperature;
-  }
+  ReactiveTabuSearch<Input,State,Move>::ReactiveTabuSearch(StateManager<Input,State>* s, NeighborhoodExplorer<Input,State,Move>* ne, TabuListManager<Move>* tlm, Input* in)
+    : TabuSearch<Input,State,Move>(s, ne, tlm, in), max_visited(65536),
+      base_min_tenure(0), base_max_tenure(0), tenure_factor(1.0), 
+      cycle_length(0.0), last_change(0), repetitions(0), tenure_log(NULL)
+  {}
 
   /**
-     Stores the current state as best state (it is obviously a local minimum).
+     Initializes the run as the tabu search does, takes the current tenure
+     range as the base one and forgets the states visited in the previous
+     runs.
   */
   template <class Input, class State, class Move>
-  void SimulatedAnnealing<Input,State,Move>::TerminateRun()
+  void ReactiveTabuSearch<Input,State,Move>::InitializeRun()
+  {
+    TabuSearch<Input,State,Move>::InitializeRun(); 
+    base_min_tenure = this->p_pm->MinTenure();
+    base_max_tenure = this->p_pm->MaxTenure();
+    tenure_factor = 1.0;
+    cycle_length = base_max_tenure;
+    last_change = 0;
+    repetitions = 0;
+    visited.clear();
+    visited[this->p_sm->StateHash(this->current_state)] = 0;
+  }
+
+  /**
+     Restores the base tenure range at the end of the run.
+  */
+  template <class Input, class State, class Move>
+  void ReactiveTabuSearch<Input,State,Move>::TerminateRun()
+  {
+    TabuSearch<Input,State,Move>::TerminateRun(); 
+    this->p_pm->SetLength(base_min_tenure,base_max_tenure);
+  }
+
+  /**
+     Stores the move as the tabu search does, then looks up the new 
+     state among the visited ones and reacts by changing the tenure.
+  */
+  template <class Input, class State, class Move>
+  void ReactiveTabuSearch<Input,State,Move>::StoreMove()
+  {
+    const double increase = 1.1, decrease = 0.9;
+    unsigned long iteration = this->number_of_iterations;
+    TabuSearch<Input,State,Move>::StoreMove();
+
+    unsigned long hash = this->p_sm->StateHash(this->current_state);
+    typename std::map<unsigned long, unsigned long>::iterator p = visited.find(hash);
+    if (p != visited.end())
+      { // the state has been visited again: escape from the cycle
+	repetitions++;
+	cycle_length = 0.1 * (iteration - p->second) + 0.9 * cycle_length;
+	p->second = iteration;
+	SetTenureFactor(tenure_factor * increase);
+	last_change = iteration;
+      }
+    else 
+      {
+	if (visited.size() >= max_visited)
+	  ForgetVisited(iteration);
+	visited.insert(std::make_pair(hash,iteration));
+	if (iteration - last_change > cycle_length)
+	  { // no cycles for long: intensify the search
+	    SetTenureFactor(tenure_factor * decrease);
+	    last_change = iteration;
+	  }
+      }
+  }
+
+  /**
+     Forgets the states not visited in the last max_visited/2 
+     iterations, so that at most that many states are left (at most
+     one state is recorded at each iteration).
+
+     @param iteration the current iteration
+  */
+  template <class Input, class State, class Move>
+  void ReactiveTabuSearch<Input,State,Move>::ForgetVisited(unsigned long iteration)
+  {
+    typename std::map<unsigned long, unsigned long>::iterator p = visited.begin();
+    while (p != visited.end())
+      if (p->second + max_visited / 2 < iteration)
+	visited.erase(p++);
+      else
+	++p;
+  }
+
+  /**
+     Sets the scaling factor of the tenure range, which is kept in 
+     [0.1, 10], and updates the tenure of the tabu list manager.
+
+     @param f the new factor
+  */
+  template <class Input, class State, class Move>
+  void ReactiveTabuSearch<Input,State,Move>::SetTenureFactor(double f)
+  {
+    const double min_factor = 0.1, max_factor = 10.0;
+    unsigned int min_tenure, max_tenure;
+    if (f < min_factor)
+      f = min_factor;
+    else if (f > max_factor)
+      f = max_factor;
+    tenure_factor = f;
+    min_tenure = (unsigned int) (base_min_tenure * f + 0.5);
+    max_tenure = (unsigned int) (base_max_tenure * f + 0.5);
+    if (min_tenure != this->p_pm->MinTenure() || max_tenure != this->p_pm->MaxTenure())
+      {
+	this->p_pm->SetLength(min_tenure,max_tenure);
+	if (tenure_log != NULL)
+	  *tenure_log << this->number_of_iterations << '\t' << min_tenure 
+		      << '\t' << max_tenure << std::endl;
+      }
+  }
+
+  /**
+     Outputs some reactive tabu search statistics on a given output stream.
+
+     @param os the output stream
+  */
+  template <class Input, class State, class Move>
+  void ReactiveTabuSearch<Input,State,Move>::Print(std::ostream & os) const
+  {  
+    TabuSearch<Input,State,Move>::Print(os);
+    os << "REACTION : " << std::endl;
+    os << "  Base tenure : " << base_min_tenure << '-' << base_max_tenure << std::endl;
+    os << "  Tenure factor : " << tenure_factor << std::endl;
+    os << "  Repeated states : " << repetitions << std::endl;
+    os << "  Average cycle length : " << cycle_length << std::endl;
+    os << std::endl;
+  }
+
+
+  /**
+     Constructs a simulated annealing runner by linking it to a state manager, 
+     a neighborhood explorer, and an input object.cd ../
+
+     @param s a pointer to a compatible state manager
+     @param ne a pointer to a compatible neighborhood explorer
+     @param in a poiter to an input object
+  */
+  template <class Input, class State, class Move>
+  SimulatedAnnealing<Input,State,Move>::SimulatedAnnealing(StateManager<Input,State>* s, NeighborhoodExplorer<Input,State,Move>* ne, Input* in)
+    : MoveRunner<Input,State,Move>(s, ne, in, "Runner name", "Simulated Annealing")
+  { 
+    min_temperature = 0.0001;
+  }
+
+  /**
+     Reads the simulated annealing parameters from the standard input.
+  */  
+  template <class Input, class State, class Move>
+  void SimulatedAnnealing<Input,State,Move>::ReadParameters()
+  {
+    std::cout << "SIMULATED ANNEALING -- INPUT PARAMETERS" << std::endl;
+    std::cout << "Start temperature: ";
+    std::cin >> start_temperature;
+    std::cout << "Cooling rate: ";
+    std::cin >> cooling_rate;
+    std::cout << "Neighbors sampled at each temperature : ";
+    std::cin >> neighbor_sample;
+  }
+
+  /**
+     Initializes the run by invoking the companion superclass method, and
+     setting the temperature to the start value.
+  */
+  template <class Input, class State, class Move>
+  void SimulatedAnnealing<Input,State,Move>::InitializeRun()
+  {
+    MoveRunner<Input,State,Move>::InitializeRun(); 
+    assert(start_temperature > 0 && cooling_rate > 0 && neighbor_sample > 0);
+    temperature = start_temperature;
+  }
+
+  /**
+     Stores the current state as best state (it is obviously a local minimum).
+  */
+  template <class Input, class State, class Move>
+  void SimulatedAnnealing<Input,State,Move>::TerminateRun()
   { 
     this->best_state = this->current_state;
     this->best_state_cost = this->current_state_cost;
@@ -1567,264 +2638,2723 @@ namespace easylocal {
   template <class Input, class State, class Move>
   bool SimulatedAnnealing<Input,State,Move>::AcceptableMove()
   { return (this->current_move_cost <= 0)
-      || (((float)rand())/RAND_MAX < exp(-(this->current_move_cost)/temperature)); }
+      || (((float)Random(0,RAND_MAX - 1))/RAND_MAX < exp(-(this->current_move_cost)/temperature)); }
 
-  /**
-     Sets the internal input pointer to the new value passed as parameter.
-     
-     @param in a pointer to the new input object
-  */
-  template <class Input, class Output>
-  void Solver<Input,Output>::SetInput(Input* in) 
-  { p_in = in; }
+  // Static Simulated Annealing
 
   /**
-     Sets the internal output pointer to the new value passed as parameter.
-     
-     @param out a pointer to the new output object
-  */
-  template <class Input, class Output>
-  void Solver<Input,Output>::SetOutput(Output* out) 
-  { p_out = out; }
+     Constructs a static simulated annealing runner by linking it to a 
+     state manager, a concrete neighborhood explorer, and an input object.
 
-  /** 
-      Constructs a solver by providing it an input and an output objects.
-
-      @param in a pointer to an input object
-      @param out a pointer to an output object
+     @param s a pointer to a compatible state manager
+     @param ne a pointer to a compatible neighborhood explorer
+     @param in a poiter to an input object
   */
-  template <class Input, class Output>
-  Solver<Input,Output>::Solver(Input* in, Output* out)
-    : p_in(in), p_out(out) 
+  template <class Input, class State, class Move, class Explorer>
+  StaticSimulatedAnnealing<Input,State,Move,Explorer>::StaticSimulatedAnnealing(StateManager<Input,State>* s, Explorer* ne, Input* in)
+    : SimulatedAnnealing<Input,State,Move>(s, ne, in), p_static_nhe(ne)
   {}
 
   /**
-     Returns the input pointer which the object is attached to.
-     
-     @return the pointer to the input
-  */
-  template <class Input, class Output>
-  Input* Solver<Input,Output>::GetInput()
-  { return p_in; }
-
-  /**
-     Returns the output pointer which the object is attached to.
-     
-     @return the pointer to the output
+     Performs a full run of the simulated annealing, with all the steps
+     of the iteration statically bound.
   */
-  template <class Input, class Output>
-  Output* Solver<Input,Output>::GetOutput()
-  { return p_out; }
+  template <class Input, class State, class Move, class Explorer>
+  void StaticSimulatedAnnealing<Input,State,Move,Explorer>::Go()
+  { StaticRunnerLoop<StaticSimulatedAnnealing>::Go(*this); }
 
   /**
-     Set the number of states which should be tried in 
-     the initialization phase.
+     Initializes the run (see SimulatedAnnealing), and seeds the
+     generator of the runner by means of Random.
   */
-  template <class Input, class Output, class State>
-  void LocalSearchSolver<Input,Output,State>::SetInitTrials(int t) 
-  { number_of_init_trials = t; }
+  template <class Input, class State, class Move, class Explorer>
+  void StaticSimulatedAnnealing<Input,State,Move,Explorer>::InitializeRun()
+  {
+    SimulatedAnnealing<Input,State,Move>::InitializeRun();
+    rng.Seed(Random(0,RAND_MAX - 1));
+    SetTemperature(this->start_temperature);
+    current_is_best = true;
+  }
 
   /**
-     Sets the internal input pointer to the new value passed as parameter.
-     
-     @param in the new input.
+     Brings the best state up to date.
   */
-  template <class Input, class Output, class State>
-  void LocalSearchSolver<Input,Output,State>::SetInput(Input* in) 
-  { 
-    this->p_in = in;
-    internal_state.SetInput(in); 
+  template <class Input, class State, class Move, class Explorer>
+  void StaticSimulatedAnnealing<Input,State,Move,Explorer>::TerminateRun()
+  {
+    if (current_is_best)
+      this->best_state = this->current_state;
   }
 
-  /** 
-      Returns the cost of the internal state.
-      
-      @return the cost of the internal state
-  */
-  template <class Input, class Output, class State>
-  fvalue LocalSearchSolver<Input,Output,State>::InternalStateCost() 
-  { return internal_state_cost; }
-
   /**
-     Constructs a local search solver by providing it a state manager,
-     an output manager, an input object, and an output object.
+     Sets the temperature and empties the table of the acceptance 
+     thresholds, that will be filled for the new temperature.
 
-     @param sm a pointer to a compatible state manager
-     @param om a pointer to a compatible output manager
-     @param in a pointer to an input object
-     @param out a pointer to an output object
+     @param t the new temperature
   */
-  template <class Input, class Output, class State>
-  LocalSearchSolver<Input,Output,State>::LocalSearchSolver(StateManager<Input,State>* sm, OutputManager<Input,Output,State>* om, Input* in, Output* out) 
-    : Solver<Input, Output>(in,out), p_sm(sm),  p_om(om), 
-    number_of_init_trials(1)
+  template <class Input, class State, class Move, class Explorer>
+  void StaticSimulatedAnnealing<Input,State,Move,Explorer>::SetTemperature(double t)
   {
-    if (in != NULL)
-      internal_state.SetInput(in); 
+    this->temperature = t;
+    accept_ratio = exp(-1.0/t);
+    accept_threshold.assign(1,4294967296.0);
   }
 
   /**
-     The output is delivered by converting the final internal state
-     to an output object by means of the output manager.
+     At regular steps, the temperature is decreased multiplying it by 
+     a cooling rate (see SimulatedAnnealing).
   */
-  template <class Input, class Output, class State>
-  void LocalSearchSolver<Input,Output,State>::DeliverOutput() 
-  { p_om->OutputState(internal_state,*this->p_out); }
+  template <class Input, class State, class Move, class Explorer>
+  void StaticSimulatedAnnealing<Input,State,Move,Explorer>::UpdateIterationCounter() 
+  { 
+    this->number_of_iterations++; 
+    if (this->number_of_iterations % this->neighbor_sample == 0)
+      SetTemperature(this->temperature * this->cooling_rate);
+  }
 
   /**
-     The initial state is generated by delegating this task to 
-     the state manager. The function invokes the SampleState function.
+     Draws a random move from the generator of the runner, without 
+     virtual dispatch.
   */
-  template <class Input, class Output, class State>
-  void LocalSearchSolver<Input,Output,State>::FindInitialState() 
-  { internal_state_cost = p_sm->SampleState(internal_state,number_of_init_trials); }
+  template <class Input, class State, class Move, class Explorer>
+  void StaticSimulatedAnnealing<Input,State,Move,Explorer>::SelectMove() 
+  { 
+    p_static_nhe->Explorer::RandomMove(this->current_state,this->current_move,rng); 
+    this->current_move_cost = p_static_nhe->Explorer::DeltaCostFunction(this->current_state,this->current_move);
+  }
+
+  /** 
+      A move is surely accepted if it improves the cost function or with
+      exponentially decreasing probability if it is a worsening one (see
+      SimulatedAnnealing). For an integer cost d the probability is 
+      taken from the table, which is extended up to d if needed: the 
+      threshold of d is the one of d-1 times exp(-1/temperature), and 
+      once it is below 1 no larger cost can pass the test.
+  */
+  template <class Input, class State, class Move, class Explorer>
+  bool StaticSimulatedAnnealing<Input,State,Move,Explorer>::AcceptableMove()
+  { 
+    const unsigned long max_threshold = 1UL << 16; 
+    fvalue cost = this->current_move_cost;
+    if (cost <= 0)
+      return true;
+    unsigned long d = (unsigned long)cost;
+    if (d != cost || d >= max_threshold)
+      return rng.Next() < exp(-cost/this->temperature) * 4294967296.0;
+    while (d >= accept_threshold.size())
+      {
+	if (accept_threshold.back() < 1.0)
+	  return false;
+	accept_threshold.push_back(accept_threshold.back() * accept_ratio);
+      }
+    return rng.Next() < accept_threshold[d];
+  }
 
   /**
-     The cost of the internal state is computed by the state manager.
+     Performs the selected move, without virtual dispatch. If the
+     current state is the best one and the move worsens it, the best
+     state is saved first.
   */
-  template <class Input, class Output, class State>
-  void LocalSearchSolver<Input,Output,State>::ComputeCost() 
-  { internal_state_cost = p_sm->CostFunction(internal_state); }
-
+  template <class Input, class State, class Move, class Explorer>
+  void StaticSimulatedAnnealing<Input,State,Move,Explorer>::MakeMove() 
+  { 
+    if (current_is_best && this->current_move_cost > 0)
+      {
+	this->best_state = this->current_state;
+	current_is_best = false;
+      }
+#if defined(TRACE_MOVES) || defined(COST_DEBUG) || defined(PLOT_DATA)
+    SimulatedAnnealing<Input,State,Move>::MakeMove();
+#else
+    p_static_nhe->Explorer::MakeMove(this->current_state,this->current_move); 
+#endif
+  }
 
   /**
-     Checks wether the object state is consistent with all the related
-     objects.
+     Records that the current state is the best one, if it improves the
+     best cost.
   */
-  template <class Input, class Output, class State>
-  void LocalSearchSolver<Input,Output,State>::Check()
+  template <class Input, class State, class Move, class Explorer>
+  void StaticSimulatedAnnealing<Input,State,Move,Explorer>::StoreMove()
   {
-    assert(this->p_in != NULL);
-    assert(this->p_in == p_sm->GetInput());
-    assert(this->p_in == p_om->GetInput());
+    if (this->current_state_cost + EPS < this->best_state_cost)
+      { 
+	this->iteration_of_best = this->number_of_iterations;
+	this->best_state_cost = this->current_state_cost;
+	current_is_best = true;
+      }
   }
 
+  // Late Acceptance Hill Climbing
+
   /**
-     Sets the runner employed for solving the problem to the one passed as
-     parameter.
+     Constructs a late acceptance hill climbing runner by linking it to
+     a state manager, a neighborhood explorer, and an input object.
 
-     @param r the new runner to be used
+     @param s a pointer to a compatible state manager
+     @param ne a pointer to a compatible neighborhood explorer
+     @param in a poiter to an input object
   */
-  template <class Input, class Output, class State>
-  void SimpleLocalSearch<Input,Output,State>::SetRunner(Runner<Input,State> *r) 
-  { p_runner = r; }
+  template <class Input, class State, class Move>
+  LateAcceptanceHillClimbing<Input,State,Move>::LateAcceptanceHillClimbing(StateManager<Input,State>* s, NeighborhoodExplorer<Input,State,Move>* ne, Input* in)
+    : MoveRunner<Input,State,Move>(s, ne, in, "Runner name", "Late Acceptance Hill Climbing")
+  {}
 
+  /**
+     Reads the late acceptance hill climbing parameters from the 
+     standard input.
+  */  
+  template <class Input, class State, class Move>
+  void LateAcceptanceHillClimbing<Input,State,Move>::ReadParameters()
+  {
+    std::cout << "LATE ACCEPTANCE HILL CLIMBING -- INPUT PARAMETERS" << std::endl;
+    std::cout << "History length: ";
+    std::cin >> history_length;
+    std::cout << "Number of idle iterations: ";
+    std::cin >> this->max_idle_iteration;
+  }
 
   /**
-     Constructs a simple local search solver by providing it links to
-     a state manager, an output manager, a runner, an input,
-     and an output object.
+     Sets the late acceptance hill climbing parameters, passed through 
+     a parameter box.
 
-     @param sm a pointer to a compatible state manager
-     @param om a pointer to a compatible output manager
-     @param r a pointer to a compatible runner
-     @param in a pointer to an input object
-     @param out a pointer to an output object
+     @param pb the object containing the parameter setting for the algorithm
   */
-  template <class Input, class Output, class State>
-  SimpleLocalSearch<Input,Output,State>::SimpleLocalSearch(StateManager<Input,State>* sm, OutputManager<Input,Output,State>* om, Runner<Input,State>* r, Input* in, Output* out)
-    : LocalSearchSolver<Input,Output,State>(sm,om,in,out) 
-  { p_runner = r; }
-
+  template <class Input, class State, class Move>
+  void LateAcceptanceHillClimbing<Input,State,Move>::SetParameters(const ParameterBox& pb)
+  {
+    pb.Get("history length", history_length);
+    pb.Get("max idle iteration", this->max_idle_iteration);
+    pb.Get("max iteration", this->max_iteration);
+  }
 
   /**
-     Constructs a simple local search solver by providing it links to
-     a state manager, an output manager, an input, and an output object.
+     Outputs some late acceptance hill climbing statistics on a given 
+     output stream.
 
-     @param sm a pointer to a compatible state manager
-     @param om a pointer to a compatible output manager
-     @param in a pointer to an input object
-     @param out a pointer to an output object
+     @param os the output stream
   */
-  template <class Input, class Output, class State>
-  SimpleLocalSearch<Input,Output,State>::SimpleLocalSearch(StateManager<Input,State>* sm, OutputManager<Input,Output,State>* om, Input* in, Output* out)
+  template <class Input, class State, class Move>
+  void LateAcceptanceHillClimbing<Input,State,Move>::Print(std::ostream & os) const
+  {
+    MoveRunner<Input,State,Move>::Print(os);
+    os << "PATAMETERS: " << std::endl;
+    os << "  History length : " << history_length << std::endl;
+    os << "  Max idle iteration : " << this->max_idle_iteration << std::endl;
+    os << "  Max iteration : " << this->max_iteration << std::endl;
+    os << "RESULTS : " << std::endl;
+    os << "  Number of iterations : " << this->number_of_iterations << std::endl;
+    os << "  Iteration of best : " << this->iteration_of_best << std::endl;
+    os << "  Current state [cost: " 
+       << this->current_state_cost << "] " << std::endl
+       << this->current_state << std::endl;
+  }
+
+  /**
+     Initializes the run by invoking the companion superclass method, and
+     filling the history with the cost of the initial state.
+  */
+  template <class Input, class State, class Move>
+  void LateAcceptanceHillClimbing<Input,State,Move>::InitializeRun()
+  {
+    MoveRunner<Input,State,Move>::InitializeRun(); 
+    assert(history_length > 0 && this->max_idle_iteration > 0);
+    history.assign(history_length, this->current_state_cost);
+    current_is_best = true;
+  }
+
+  /**
+     Brings the best state up to date.
+  */
+  template <class Input, class State, class Move>
+  void LateAcceptanceHillClimbing<Input,State,Move>::TerminateRun()
+  { 
+    if (current_is_best)
+      this->best_state = this->current_state;
+  }
+
+  /**
+     The search stops after a given number of iterations without 
+     improving the best state.
+  */
+  template <class Input, class State, class Move>
+  bool LateAcceptanceHillClimbing<Input,State,Move>::StopCriterion()
+  { return this->number_of_iterations - this->iteration_of_best >= this->max_idle_iteration; }
+
+  /**
+     Records the cost of the state reached at the previous iteration 
+     (whether or not its move has been accepted) in the history, 
+     and then increases the iteration counter.
+  */
+  template <class Input, class State, class Move>
+  void LateAcceptanceHillClimbing<Input,State,Move>::UpdateIterationCounter() 
+  { 
+    history[this->number_of_iterations % history_length] = this->current_state_cost;
+    this->number_of_iterations++; 
+  }
+
+  /**
+     A move is randomly picked.
+  */
+  template <class Input, class State, class Move>
+  void LateAcceptanceHillClimbing<Input,State,Move>::SelectMove() 
+  { 
+    this->p_nhe->RandomMove(this->current_state, this->current_move); 
+    this->ComputeMoveCost(); 
+  }
+
+  /** 
+      A move is accepted if it does not worsen the current state, or if
+      the state it leads to is not worse than the one visited 
+      @c history_length iterations before.
+  */
+  template <class Input, class State, class Move>
+  bool LateAcceptanceHillClimbing<Input,State,Move>::AcceptableMove()
+  { 
+    return this->current_move_cost <= 0
+      || this->current_state_cost + this->current_move_cost 
+      <= history[this->number_of_iterations % history_length];
+  }
+
+  /**
+     Performs the selected move. If the current state is the best one 
+     and the move worsens it, the best state is saved first.
+  */
+  template <class Input, class State, class Move>
+  void LateAcceptanceHillClimbing<Input,State,Move>::MakeMove() 
+  { 
+    if (current_is_best && this->current_move_cost > 0)
+      {
+	this->best_state = this->current_state;
+	current_is_best = false;
+      }
+    MoveRunner<Input,State,Move>::MakeMove();
+  }
+
+  /**
+     Records that the current state is the best one, if it improves the
+     best cost.
+  */
+  template <class Input, class State, class Move>
+  void LateAcceptanceHillClimbing<Input,State,Move>::StoreMove()
+  {
+    if (this->current_state_cost + EPS < this->best_state_cost)
+      { 
+	this->iteration_of_best = this->number_of_iterations;
+	this->best_state_cost = this->current_state_cost;
+	current_is_best = true;
+      }
+  }
+
+  // Static Late Acceptance Hill Climbing
+
+  /**
+     Constructs a static late acceptance hill climbing runner by linking 
+     it to a state manager, a concrete neighborhood explorer, and an 
+     input object.
+
+     @param s a pointer to a compatible state manager
+     @param ne a pointer to a compatible neighborhood explorer
+     @param in a poiter to an input object
+  */
+  template <class Input, class State, class Move, class Explorer>
+  StaticLateAcceptanceHillClimbing<Input,State,Move,Explorer>::StaticLateAcceptanceHillClimbing(StateManager<Input,State>* s, Explorer* ne, Input* in)
+    : LateAcceptanceHillClimbing<Input,State,Move>(s, ne, in), p_static_nhe(ne)
+  {}
+
+  /**
+     Performs a full run of the late acceptance hill climbing, with all
+     the steps of the iteration statically bound.
+  */
+  template <class Input, class State, class Move, class Explorer>
+  void StaticLateAcceptanceHillClimbing<Input,State,Move,Explorer>::Go()
+  { StaticRunnerLoop<StaticLateAcceptanceHillClimbing>::Go(*this); }
+
+  /**
+     Initializes the run (see LateAcceptanceHillClimbing), and seeds the
+     generator of the runner by means of Random.
+  */
+  template <class Input, class State, class Move, class Explorer>
+  void StaticLateAcceptanceHillClimbing<Input,State,Move,Explorer>::InitializeRun()
+  {
+    LateAcceptanceHillClimbing<Input,State,Move>::InitializeRun();
+    rng.Seed(Random(0,RAND_MAX - 1));
+  }
+
+  /**
+     Draws a random move from the generator of the runner, without 
+     virtual dispatch.
+  */
+  template <class Input, class State, class Move, class Explorer>
+  void StaticLateAcceptanceHillClimbing<Input,State,Move,Explorer>::SelectMove() 
+  { 
+    p_static_nhe->Explorer::RandomMove(this->current_state,this->current_move,rng); 
+    this->current_move_cost = p_static_nhe->Explorer::DeltaCostFunction(this->current_state,this->current_move);
+  }
+
+  /**
+     Performs the selected move, without virtual dispatch, saving the 
+     best state first if the move leaves it.
+  */
+  template <class Input, class State, class Move, class Explorer>
+  void StaticLateAcceptanceHillClimbing<Input,State,Move,Explorer>::MakeMove() 
+  { 
+    if (this->current_is_best && this->current_move_cost > 0)
+      {
+	this->best_state = this->current_state;
+	this->current_is_best = false;
+      }
+#if defined(TRACE_MOVES) || defined(COST_DEBUG) || defined(PLOT_DATA)
+    MoveRunner<Input,State,Move>::MakeMove();
+#else
+    p_static_nhe->Explorer::MakeMove(this->current_state,this->current_move); 
+#endif
+  }
+
+  // Great Deluge
+
+  /**
+     Constructs a great deluge runner by linking it to a state manager,
+     a neighborhood explorer, and an input object.
+
+     @param s a pointer to a compatible state manager
+     @param ne a pointer to a compatible neighborhood explorer
+     @param in a poiter to an input object
+  */
+  template <class Input, class State, class Move>
+  GreatDeluge<Input,State,Move>::GreatDeluge(StateManager<Input,State>* s, NeighborhoodExplorer<Input,State,Move>* ne, Input* in)
+    : MoveRunner<Input,State,Move>(s, ne, in, "Runner name", "Great Deluge")
+  { 
+    level_update = 100;
+  }
+
+  /**
+     Reads the great deluge parameters from the standard input.
+  */  
+  template <class Input, class State, class Move>
+  void GreatDeluge<Input,State,Move>::ReadParameters()
+  {
+    std::cout << "GREAT DELUGE -- INPUT PARAMETERS" << std::endl;
+    std::cout << "Start level (fraction of the initial cost): ";
+    std::cin >> level_factor;
+    std::cout << "Final level: ";
+    std::cin >> final_level;
+    std::cout << "Time budget in seconds (0 for an iteration budget): ";
+    std::cin >> time_budget;
+    if (time_budget == 0)
+      {
+	std::cout << "Number of iterations: ";
+	std::cin >> this->max_iteration;
+      }
+  }
+
+  /**
+     Sets the great deluge parameters, passed through a parameter box.
+
+     @param pb the object containing the parameter setting for the algorithm
+  */
+  template <class Input, class State, class Move>
+  void GreatDeluge<Input,State,Move>::SetParameters(const ParameterBox& pb)
+  {
+    pb.Get("level factor", level_factor);
+    pb.Get("final level", final_level);
+    pb.Get("time budget", time_budget);
+    pb.Get("max iteration", this->max_iteration);
+  }
+
+  /**
+     Outputs some great deluge statistics on a given output stream.
+
+     @param os the output stream
+  */
+  template <class Input, class State, class Move>
+  void GreatDeluge<Input,State,Move>::Print(std::ostream & os) const
+  {
+    MoveRunner<Input,State,Move>::Print(os);
+    os << "PATAMETERS: " << std::endl;
+    os << "  Level factor : " << level_factor << std::endl;
+    os << "  Final level : " << final_level << std::endl;
+    os << "  Time budget : " << time_budget << std::endl;
+    os << "  Max iteration : " << this->max_iteration << std::endl;
+    os << "RESULTS : " << std::endl;
+    os << "  Number of iterations : " << this->number_of_iterations << std::endl;
+    os << "  Level : " << level << std::endl;
+    os << "  Current state [cost: " 
+       << this->current_state_cost << "] " << std::endl
+       << this->current_state << std::endl;
+  }
+
+  /**
+     Initializes the run by invoking the companion superclass method, 
+     setting the level to its start value and starting the clock.
+  */
+  template <class Input, class State, class Move>
+  void GreatDeluge<Input,State,Move>::InitializeRun()
+  {
+    MoveRunner<Input,State,Move>::InitializeRun(); 
+    assert(level_factor > 0 && (time_budget > 0 || this->max_iteration < ULONG_MAX));
+    start_level = level_factor * this->current_state_cost;
+    level = start_level;
+    budget_expired = false;
+    current_is_best = true;
+    chrono.Start();
+  }
+
+  /**
+     Brings the best state up to date.
+  */
+  template <class Input, class State, class Move>
+  void GreatDeluge<Input,State,Move>::TerminateRun()
+  { 
+    if (current_is_best)
+      this->best_state = this->current_state;
+  }
+
+  /**
+     The search stops when the time budget has been consumed (the 
+     iteration budget is checked by MaxIterationExpired).
+  */
+  template <class Input, class State, class Move>
+  bool GreatDeluge<Input,State,Move>::StopCriterion()
+  { return budget_expired; }
+
+  /**
+     At regular steps, the level is updated.
+  */
+  template <class Input, class State, class Move>
+  void GreatDeluge<Input,State,Move>::UpdateIterationCounter() 
+  { 
+    this->number_of_iterations++; 
+    if (this->number_of_iterations % level_update == 0)
+      UpdateLevel();
+  }
+
+  /**
+     Sets the level according to the fraction of the budget consumed.
+  */
+  template <class Input, class State, class Move>
+  void GreatDeluge<Input,State,Move>::UpdateLevel() 
+  { 
+    double consumed;
+    if (time_budget > 0)
+      consumed = chrono.Elapsed() / time_budget;
+    else
+      consumed = (double)this->number_of_iterations / this->max_iteration;
+    if (consumed >= 1.0)
+      {
+	consumed = 1.0;
+	budget_expired = time_budget > 0;
+      }
+    level = start_level - (start_level - final_level) * consumed;
+  }
+
+  /**
+     A move is randomly picked.
+  */
+  template <class Input, class State, class Move>
+  void GreatDeluge<Input,State,Move>::SelectMove() 
+  { 
+    this->p_nhe->RandomMove(this->current_state, this->current_move); 
+    this->ComputeMoveCost(); 
+  }
+
+  /** 
+      A move is accepted if it does not worsen the current state, or if
+      the state it leads to is below the level.
+  */
+  template <class Input, class State, class Move>
+  bool GreatDeluge<Input,State,Move>::AcceptableMove()
+  { 
+    return this->current_move_cost <= 0
+      || this->current_state_cost + this->current_move_cost <= level;
+  }
+
+  /**
+     Performs the selected move. If the current state is the best one 
+     and the move worsens it, the best state is saved first.
+  */
+  template <class Input, class State, class Move>
+  void GreatDeluge<Input,State,Move>::MakeMove() 
+  { 
+    if (current_is_best && this->current_move_cost > 0)
+      {
+	this->best_state = this->current_state;
+	current_is_best = false;
+      }
+    MoveRunner<Input,State,Move>::MakeMove();
+  }
+
+  /**
+     Records that the current state is the best one, if it improves the
+     best cost.
+  */
+  template <class Input, class State, class Move>
+  void GreatDeluge<Input,State,Move>::StoreMove()
+  {
+    if (this->current_state_cost + EPS < this->best_state_cost)
+      { 
+	this->iteration_of_best = this->number_of_iterations;
+	this->best_state_cost = this->current_state_cost;
+	current_is_best = true;
+      }
+  }
+
+  // Static Great Deluge
+
+  /**
+     Constructs a static great deluge runner by linking it to a state
+     manager, a concrete neighborhood explorer, and an input object.
+
+     @param s a pointer to a compatible state manager
+     @param ne a pointer to a compatible neighborhood explorer
+     @param in a poiter to an input object
+  */
+  template <class Input, class State, class Move, class Explorer>
+  StaticGreatDeluge<Input,State,Move,Explorer>::StaticGreatDeluge(StateManager<Input,State>* s, Explorer* ne, Input* in)
+    : GreatDeluge<Input,State,Move>(s, ne, in), p_static_nhe(ne)
+  {}
+
+  /**
+     Performs a full run of the great deluge, with all the steps of the
+     iteration statically bound.
+  */
+  template <class Input, class State, class Move, class Explorer>
+  void StaticGreatDeluge<Input,State,Move,Explorer>::Go()
+  { StaticRunnerLoop<StaticGreatDeluge>::Go(*this); }
+
+  /**
+     Initializes the run (see GreatDeluge), and seeds the generator of
+     the runner by means of Random.
+  */
+  template <class Input, class State, class Move, class Explorer>
+  void StaticGreatDeluge<Input,State,Move,Explorer>::InitializeRun()
+  {
+    GreatDeluge<Input,State,Move>::InitializeRun();
+    rng.Seed(Random(0,RAND_MAX - 1));
+  }
+
+  /**
+     Draws a random move from the generator of the runner, without 
+     virtual dispatch.
+  */
+  template <class Input, class State, class Move, class Explorer>
+  void StaticGreatDeluge<Input,State,Move,Explorer>::SelectMove() 
+  { 
+    p_static_nhe->Explorer::RandomMove(this->current_state,this->current_move,rng); 
+    this->current_move_cost = p_static_nhe->Explorer::DeltaCostFunction(this->current_state,this->current_move);
+  }
+
+  /**
+     Performs the selected move, without virtual dispatch, saving the 
+     best state first if the move leaves it.
+  */
+  template <class Input, class State, class Move, class Explorer>
+  void StaticGreatDeluge<Input,State,Move,Explorer>::MakeMove() 
+  { 
+    if (this->current_is_best && this->current_move_cost > 0)
+      {
+	this->best_state = this->current_state;
+	this->current_is_best = false;
+      }
+#if defined(TRACE_MOVES) || defined(COST_DEBUG) || defined(PLOT_DATA)
+    MoveRunner<Input,State,Move>::MakeMove();
+#else
+    p_static_nhe->Explorer::MakeMove(this->current_state,this->current_move); 
+#endif
+  }
+
+  // Parallel Tempering
+
+  /**
+     Constructs a parallel tempering runner by linking it to a state 
+     manager, a concrete neighborhood explorer, and an input object.
+
+     @param s a pointer to a compatible state manager
+     @param ne a pointer to a compatible neighborhood explorer
+     @param in a poiter to an input object
+  */
+  template <class Input, class State, class Move, class Explorer>
+  ParallelTempering<Input,State,Move,Explorer>::ParallelTempering(StateManager<Input,State>* s, Explorer* ne, Input* in)
+    : MoveRunner<Input,State,Move>(s, ne, in, "Runner name", "Parallel Tempering"), p_static_nhe(ne)
+  {}
+
+  /**
+     Reads the parallel tempering parameters from the standard input.
+  */  
+  template <class Input, class State, class Move, class Explorer>
+  void ParallelTempering<Input,State,Move,Explorer>::ReadParameters()
+  {
+    std::cout << "PARALLEL TEMPERING -- INPUT PARAMETERS" << std::endl;
+    std::cout << "Number of replicas: ";
+    std::cin >> replicas;
+    std::cout << "Min temperature: ";
+    std::cin >> min_temperature;
+    std::cout << "Max temperature: ";
+    std::cin >> max_temperature;
+    std::cout << "Iterations between exchanges: ";
+    std::cin >> exchange_interval;
+    std::cout << "Number of idle iterations: ";
+    std::cin >> this->max_idle_iteration;
+  }
+
+  /**
+     Sets the parallel tempering parameters, passed through a parameter 
+     box.
+
+     @param pb the object containing the parameter setting for the algorithm
+  */
+  template <class Input, class State, class Move, class Explorer>
+  void ParallelTempering<Input,State,Move,Explorer>::SetParameters(const ParameterBox& pb)
+  {
+    pb.Get("replicas", replicas);
+    pb.Get("min temperature", min_temperature);
+    pb.Get("max temperature", max_temperature);
+    pb.Get("exchange interval", exchange_interval);
+    pb.Get("max idle iteration", this->max_idle_iteration);
+    pb.Get("max iteration", this->max_iteration);
+  }
+
+  /**
+     Outputs some parallel tempering statistics on a given output stream.
+
+     @param os the output stream
+  */
+  template <class Input, class State, class Move, class Explorer>
+  void ParallelTempering<Input,State,Move,Explorer>::Print(std::ostream & os) const
+  {
+    MoveRunner<Input,State,Move>::Print(os);
+    os << "PATAMETERS: " << std::endl;
+    os << "  Replicas : " << replicas << std::endl;
+    os << "  Temperatures : " << min_temperature << '-' << max_temperature << std::endl;
+    os << "  Exchange interval : " << exchange_interval << std::endl;
+    os << "  Max idle iteration : " << this->max_idle_iteration << std::endl;
+    os << "  Max iteration : " << this->max_iteration << std::endl;
+    os << "RESULTS : " << std::endl;
+    os << "  Number of iterations : " << this->number_of_iterations << std::endl;
+    os << "  Iteration of best : " << this->iteration_of_best << std::endl;
+    os << "  Exchanges : " << accepted_exchanges << '/' << exchanges << std::endl;
+    os << "  Best state [cost: " 
+       << this->best_state_cost << "] " << std::endl
+       << this->best_state << std::endl;
+  }
+
+  /**
+     Performs a full run of the parallel tempering. The replicas run in
+     their own threads, while the calling thread performs the exchanges
+     and decides when to stop.
+  */
+  template <class Input, class State, class Move, class Explorer>
+  void ParallelTempering<Input,State,Move,Explorer>::Go()
+  { 
+    assert(this->current_state_set);
+    InitializeRun();
+    std::vector<pthread_t> thread(replicas);
+    pthread_barrier_init(&segment_end, NULL, replicas + 1);
+    pthread_barrier_init(&segment_start, NULL, replicas + 1);
+    for (unsigned int k = 0; k < replicas; k++)
+      pthread_create(&thread[k], NULL, ReplicaThread, &replica[k]);
+    while (!stop)
+      { 
+	pthread_barrier_wait(&segment_end);
+	this->number_of_iterations += exchange_interval;
+	for (unsigned int k = 0; k < replicas; k++)
+	  if (replica[k].best_cost + EPS < this->best_state_cost)
+	    {
+	      this->best_state_cost = replica[k].best_cost;
+	      this->iteration_of_best = this->number_of_iterations;
+	    }
+	stop = this->MaxIterationExpired() || StopCriterion() 
+	  || this->best_state_cost == 0 || this->TimeExpired()
+	  || this->ObserverInterrupt();
+	if (!stop)
+	  ExchangeReplicas();
+	pthread_barrier_wait(&segment_start);
+      }
+    for (unsigned int k = 0; k < replicas; k++)
+      pthread_join(thread[k], NULL);
+    pthread_barrier_destroy(&segment_end);
+    pthread_barrier_destroy(&segment_start);
+    TerminateRun();
+    this->NotifyRunStopped();
+  }
+
+  /**
+     Initializes the run by invoking the companion superclass method, 
+     setting the temperatures of the ladder, and starting all the 
+     replicas from the current state. The generators of the replicas
+     are seeded by means of Random.
+  */
+  template <class Input, class State, class Move, class Explorer>
+  void ParallelTempering<Input,State,Move,Explorer>::InitializeRun()
+  {
+    MoveRunner<Input,State,Move>::InitializeRun(); 
+    assert(replicas > 0 && exchange_interval > 0 && this->max_idle_iteration > 0);
+    assert(min_temperature > 0 && max_temperature >= min_temperature);
+    pool.assign(replicas, this->current_state);
+    replica.resize(replicas);
+    for (unsigned int k = 0; k < replicas; k++)
+      {
+	Replica& r = replica[k];
+	r.runner = this;
+	r.state = &pool[k];
+	r.cost = this->current_state_cost;
+	r.temperature = replicas == 1 ? min_temperature 
+	  : min_temperature * pow(max_temperature / min_temperature, (double)k / (replicas - 1));
+	r.rng.Seed(Random(0,RAND_MAX - 1));
+	r.best_cost = r.cost;
+	r.current_is_best = true;
+      }
+    stop = false;
+    exchanges = 0;
+    accepted_exchanges = 0;
+  }
+
+  /**
+     Sets the best state to the best one of the replicas, and the 
+     current state to the one of the coldest replica.
+  */
+  template <class Input, class State, class Move, class Explorer>
+  void ParallelTempering<Input,State,Move,Explorer>::TerminateRun()
+  { 
+    unsigned int b = 0;
+    for (unsigned int k = 1; k < replicas; k++)
+      if (replica[k].best_cost < replica[b].best_cost)
+	b = k;
+    if (replica[b].current_is_best)
+      this->best_state = *replica[b].state;
+    else
+      this->best_state = replica[b].best;
+    this->best_state_cost = replica[b].best_cost;
+    this->current_state = *replica[0].state;
+    this->current_state_cost = replica[0].cost;
+  }
+
+  /**
+     The search stops after a given number of iterations without 
+     improving the best state.
+  */
+  template <class Input, class State, class Move, class Explorer>
+  bool ParallelTempering<Input,State,Move,Explorer>::StopCriterion()
+  { return this->number_of_iterations - this->iteration_of_best >= this->max_idle_iteration; }
+
+  /**
+     A move is randomly picked on the current state (the replicas do 
+     not use this function).
+  */
+  template <class Input, class State, class Move, class Explorer>
+  void ParallelTempering<Input,State,Move,Explorer>::SelectMove() 
+  { 
+    this->p_nhe->RandomMove(this->current_state, this->current_move); 
+    this->ComputeMoveCost(); 
+  }
+
+  /**
+     The body of the thread of a replica: it alternates the segments of
+     iterations with the synchronizations with the calling thread.
+
+     @param arg a pointer to the replica
+  */
+  template <class Input, class State, class Move, class Explorer>
+  void* ParallelTempering<Input,State,Move,Explorer>::ReplicaThread(void* arg)
+  {
+    Replica& r = *static_cast<Replica*>(arg);
+    ParallelTempering& pt = *r.runner;
+    while (true)
+      {
+	pt.RunReplica(r);
+	pthread_barrier_wait(&pt.segment_end);
+	pthread_barrier_wait(&pt.segment_start);
+	if (pt.stop)
+	  break;
+      }
+    return NULL;
+  }
+
+  /**
+     Performs a segment of iterations of a replica at its temperature:
+     a random move is accepted if it improves the cost function, or 
+     with exponentially decreasing probability if it is a worsening 
+     one. As in StaticSimulatedAnnealing, the best state of the replica
+     is copied only when the replica leaves it.
+
+     @param r the replica
+  */
+  template <class Input, class State, class Move, class Explorer>
+  void ParallelTempering<Input,State,Move,Explorer>::RunReplica(Replica& r)
+  {
+    for (unsigned int i = 0; i < exchange_interval; i++)
+      {
+	p_static_nhe->Explorer::RandomMove(*r.state,r.move,r.rng); 
+	fvalue delta = p_static_nhe->Explorer::DeltaCostFunction(*r.state,r.move);
+	if (delta > 0 && r.rng.Next() >= exp(-delta/r.temperature) * 4294967296.0)
+	  continue;
+	if (r.current_is_best && delta > 0)
+	  {
+	    r.best = *r.state;
+	    r.current_is_best = false;
+	  }
+	p_static_nhe->Explorer::MakeMove(*r.state,r.move); 
+	r.cost += delta;
+	if (r.cost + EPS < r.best_cost)
+	  {
+	    r.best_cost = r.cost;
+	    r.current_is_best = true;
+	  }
+      }
+  }
+
+  /**
+     Tries to swap the states of the pairs of replicas at neighbouring
+     temperatures (the even pairs and the odd pairs alternately). The
+     swap of the replicas k and k+1 is accepted with probability
+     min(1, exp((1/T_k - 1/T_{k+1}) (cost_k - cost_{k+1}))). The best 
+     state of a replica that gives away its current best state is 
+     saved first.
+  */
+  template <class Input, class State, class Move, class Explorer>
+  void ParallelTempering<Input,State,Move,Explorer>::ExchangeReplicas()
+  {
+    unsigned int first = (this->number_of_iterations / exchange_interval) % 2;
+    for (unsigned int k = first; k + 1 < replicas; k += 2)
+      {
+	Replica& cold = replica[k];
+	Replica& hot = replica[k + 1];
+	double x = (1.0/cold.temperature - 1.0/hot.temperature) * (cold.cost - hot.cost);
+	exchanges++;
+	if (x < 0 && cold.rng.Next() >= exp(x) * 4294967296.0)
+	  continue;
+	accepted_exchanges++;
+	if (cold.current_is_best)
+	  {
+	    cold.best = *cold.state;
+	    cold.current_is_best = false;
+	  }
+	if (hot.current_is_best)
+	  {
+	    hot.best = *hot.state;
+	    hot.current_is_best = false;
+	  }
+	std::swap(cold.state, hot.state);
+	std::swap(cold.cost, hot.cost);
+	if (cold.cost + EPS < cold.best_cost)
+	  {
+	    cold.best_cost = cold.cost;
+	    cold.current_is_best = true;
+	  }
+	if (hot.cost + EPS < hot.best_cost)
+	  {
+	    hot.best_cost = hot.cost;
+	    hot.current_is_best = true;
+	  }
+      }
+  }
+
+  /**
+     Sets the internal input pointer to the new value passed as parameter.
+     
+     @param in a pointer to the new input object
+  */
+  template <class Input, class Output>
+  void Solver<Input,Output>::SetInput(Input* in) 
+  { p_in = in; }
+
+  /**
+     Sets the internal output pointer to the new value passed as parameter.
+     
+     @param out a pointer to the new output object
+  */
+  template <class Input, class Output>
+  void Solver<Input,Output>::SetOutput(Output* out) 
+  { p_out = out; }
+
+  /** 
+      Constructs a solver by providing it an input and an output objects.
+
+      @param in a pointer to an input object
+      @param out a pointer to an output object
+  */
+  template <class Input, class Output>
+  Solver<Input,Output>::Solver(Input* in, Output* out)
+    : p_in(in), p_out(out) 
+  {}
+
+  /**
+     Returns the input pointer which the object is attached to.
+     
+     @return the pointer to the input
+  */
+  template <class Input, class Output>
+  Input* Solver<Input,Output>::GetInput()
+  { return p_in; }
+
+  /**
+     Returns the output pointer which the object is attached to.
+     
+     @return the pointer to the output
+  */
+  template <class Input, class Output>
+  Output* Solver<Input,Output>::GetOutput()
+  { return p_out; }
+
+  /**
+     Set the number of states which should be tried in 
+     the initialization phase.
+  */
+  template <class Input, class Output, class State>
+  void LocalSearchSolver<Input,Output,State>::SetInitTrials(int t) 
+  { number_of_init_trials = t; }
+
+  /**
+     Sets the method used for generating the initial states.
+
+     @param m the method (random or greedy)
+  */
+  template <class Input, class Output, class State>
+  void LocalSearchSolver<Input,Output,State>::SetInitialState(InitialStateMethod m) 
+  { initial_state_method = m; }
+
+  /**
+     Sets the internal input pointer to the new value passed as parameter.
+     
+     @param in the new input.
+  */
+  template <class Input, class Output, class State>
+  void LocalSearchSolver<Input,Output,State>::SetInput(Input* in) 
+  { 
+    this->p_in = in;
+    internal_state.SetInput(in); 
+  }
+
+  /** 
+      Returns the cost of the internal state.
+      
+      @return the cost of the internal state
+  */
+  template <class Input, class Output, class State>
+  fvalue LocalSearchSolver<Input,Output,State>::InternalStateCost() 
+  { return internal_state_cost; }
+
+  /**
+     Constructs a local search solver by providing it a state manager,
+     an output manager, an input object, and an output object.
+
+     @param sm a pointer to a compatible state manager
+     @param om a pointer to a compatible output manager
+     @param in a pointer to an input object
+     @param out a pointer to an output object
+  */
+  template <class Input, class Output, class State>
+  LocalSearchSolver<Input,Output,State>::LocalSearchSolver(StateManager<Input,State>* sm, OutputManager<Input,Output,State>* om, Input* in, Output* out) 
+    : Solver<Input, Output>(in,out), p_sm(sm),  p_om(om), 
+    time_limit(0), deadline(0), p_observer(NULL), p_snapshot(NULL), 
+    stop_requested(false),
+    number_of_init_trials(1), initial_state_method(RANDOM_INITIAL_STATE),
+    dominance_ratio(0), observe_incumbent(false), deterministic(false),
+    master_seed(1), batch_width(0)
+  {
+    if (in != NULL)
+      internal_state.SetInput(in); 
+  }
+
+  /**
+     The output is delivered by converting the final internal state
+     to an output object by means of the output manager.
+  */
+  template <class Input, class Output, class State>
+  void LocalSearchSolver<Input,Output,State>::DeliverOutput() 
+  { 
+    p_om->OutputState(internal_state,*this->p_out); 
+    if (p_snapshot != NULL)
+      {
+	p_snapshot->Offer(internal_state,internal_state_cost);
+	p_snapshot->Stop();
+      }
+  }
+
+  /**
+     The initial state is generated by delegating this task to 
+     the state manager. The function invokes the SampleState function
+     with the selected initial state method.
+  */
+  template <class Input, class Output, class State>
+  void LocalSearchSolver<Input,Output,State>::FindInitialState() 
+  { internal_state_cost = p_sm->SampleState(internal_state,number_of_init_trials,initial_state_method); }
+
+  /**
+     The cost of the internal state is computed by the state manager.
+  */
+  template <class Input, class Output, class State>
+  void LocalSearchSolver<Input,Output,State>::ComputeCost() 
+  { internal_state_cost = p_sm->CostFunction(internal_state); }
+
+  /**
+     Sets the maximum wall time of a solving procedure (Solve, ReSolve 
+     or MultiStartSolve): the runners are stopped when it is over.
+
+     @param s the time limit in seconds (0 for no limit)
+  */
+  template <class Input, class Output, class State>
+  void LocalSearchSolver<Input,Output,State>::SetTimeLimit(double s) 
+  { time_limit = s; }
+
+  /**
+     Sets the deadline of the solving procedure that starts now, and
+     clears the stop request of the previous one.
+  */
+  template <class Input, class Output, class State>
+  void LocalSearchSolver<Input,Output,State>::StartTimer() 
+  { 
+    deadline = time_limit > 0 ? WallClock::Now() + time_limit : 0; 
+    stop_requested = false;
+    if (p_snapshot != NULL)
+      p_snapshot->Start();
+  }
+
+  /**
+     Checks whether the deadline of the solving procedure has passed.
+
+     @return true if the procedure has a deadline and it has passed
+  */
+  template <class Input, class Output, class State>
+  bool LocalSearchSolver<Input,Output,State>::DeadlinePassed() const
+  { return deadline > 0 && WallClock::Now() >= deadline; }
+
+  /**
+     Lets a runner Go within the deadline of the solving procedure (in
+     deterministic mode the runner is not bounded by the deadline,
+     which is only checked between the runs).
+
+     @param r a pointer to the runner
+  */
+  template <class Input, class Output, class State>
+  void LocalSearchSolver<Input,Output,State>::GoRunner(Runner<Input,State>* r) 
+  { 
+    r->SetDeadline(deterministic ? 0 : deadline);
+    if (observe_incumbent)
+      r->SetObserver(&incumbent_observer);
+    r->Go();
+    if (observe_incumbent)
+      r->SetObserver(NULL);
+    r->SetDeadline(0);
+  }
+
+  /**
+     Delivers the end of a round to the observer, if one is attached,
+     and offers the internal state to the snapshot writer.
+
+     @param round the number of the round
+     @return true if the observer or a request from outside the process
+     has stopped the solving procedure
+  */
+  template <class Input, class Output, class State>
+  bool LocalSearchSolver<Input,Output,State>::NotifyRound(unsigned int round) 
+  { return NotifyRound(round,&internal_state); }
+
+  /**
+     Delivers the end of a round to the observer, if one is attached,
+     and offers the given state to the snapshot writer.
+
+     @param round the number of the round
+     @param best the state whose cost is the internal state cost (NULL
+     if it is not available, e.g. in another thread)
+     @return true if the observer or a request from outside the process
+     has stopped the solving procedure
+  */
+  template <class Input, class Output, class State>
+  bool LocalSearchSolver<Input,Output,State>::NotifyRound(unsigned int round, const State* best) 
+  { 
+    if (p_snapshot != NULL && best != NULL)
+      p_snapshot->Offer(*best,internal_state_cost);
+    if ((p_observer != NULL && !p_observer->SolverRound(round,internal_state_cost))
+	|| StopRequest::Pending())
+      stop_requested = true;
+    return stop_requested;
+  }
+
+
+  /**
+     Checks wether the object state is consistent with all the related
+     objects.
+  */
+  template <class Input, class Output, class State>
+  void LocalSearchSolver<Input,Output,State>::Check()
+  {
+    assert(this->p_in != NULL);
+    assert(this->p_in == p_sm->GetInput());
+    assert(this->p_in == p_om->GetInput());
+  }
+
+  /**
+     Sets the runner employed for solving the problem to the one passed as
+     parameter.
+
+     @param r the new runner to be used
+  */
+  template <class Input, class Output, class State>
+  void SimpleLocalSearch<Input,Output,State>::SetRunner(Runner<Input,State> *r) 
+  { p_runner = r; }
+
+
+  /**
+     Constructs a simple local search solver by providing it links to
+     a state manager, an output manager, a runner, an input,
+     and an output object.
+
+     @param sm a pointer to a compatible state manager
+     @param om a pointer to a compatible output manager
+     @param r a pointer to a compatible runner
+     @param in a pointer to an input object
+     @param out a pointer to an output object
+  */
+  template <class Input, class Output, class State>
+  SimpleLocalSearch<Input,Output,State>::SimpleLocalSearch(StateManager<Input,State>* sm, OutputManager<Input,Output,State>* om, Runner<Input,State>* r, Input* in, Output* out)
+    : LocalSearchSolver<Input,Output,State>(sm,om,in,out) 
+  { p_runner = r; }
+
+
+  /**
+     Constructs a simple local search solver by providing it links to
+     a state manager, an output manager, an input, and an output object.
+
+     @param sm a pointer to a compatible state manager
+     @param om a pointer to a compatible output manager
+     @param in a pointer to an input object
+     @param out a pointer to an output object
+  */
+  template <class Input, class Output, class State>
+  SimpleLocalSearch<Input,Output,State>::SimpleLocalSearch(StateManager<Input,State>* sm, OutputManager<Input,Output,State>* om, Input* in, Output* out)
     : LocalSearchSolver<Input,Output,State>(sm,om,in,out) 
   { p_runner = NULL; }
 
 
-  /** 
-      Returns the number of iterations performed by the attached runner.
-      
-      @return the number of iterations elapsed.
+  /** 
+      Returns the number of iterations performed by the attached runner.
+      
+      @return the number of iterations elapsed.
+  */
+  template <class Input, class Output, class State>
+  unsigned long SimpleLocalSearch<Input,Output,State>::NumberOfIterations() const 
+  { return p_runner->NumberOfIterations(); }
+
+  /**
+     Lets the runner Go, and then collects the best state found.
+  */
+  template <class Input, class Output, class State>
+  void SimpleLocalSearch<Input,Output,State>::Run()
+  {
+    p_runner->SetCurrentState(this->internal_state);
+    this->GoRunner(p_runner);
+    this->internal_state = p_runner->GetBestState();
+    this->internal_state_cost = p_runner->BestStateCost();
+  }
+
+  /**
+     Performs a full solving procedure by finding an initial state, 
+     running the attached runner and delivering the output.
+  */
+  template <class Input, class Output, class State>
+  void LocalSearchSolver<Input,Output,State>::Solve()
+  {
+    FastRandom rng(master_seed);
+    FastRandom* previous = deterministic ? SetThreadRandom(&rng) : NULL;
+    StartTimer();
+    FindInitialState();
+    Run();
+    DeliverOutput();
+    if (deterministic)
+      SetThreadRandom(previous);
+  }
+  
+  /**
+     Start again a solving procedure, running the attached runner from
+     the current internal state.
+  */
+  template <class Input, class Output, class State>
+  void LocalSearchSolver<Input,Output,State>::ReSolve()
+  {
+    FastRandom rng(master_seed);
+    FastRandom* previous = deterministic ? SetThreadRandom(&rng) : NULL;
+    StartTimer();
+    Run();
+    DeliverOutput();
+    if (deterministic)
+      SetThreadRandom(previous);
+  }
+
+  /**
+     Adds a worker for the parallel multi-start. A worker is a solver of
+     the same kind, with its own runners and helpers (only a state
+     manager and an output manager that are not modified by the search
+     can be shared), that performs some of the restarts in its own 
+     thread.
+
+     @param s a pointer to the worker
+  */
+  template <class Input, class Output, class State>
+  void LocalSearchSolver<Input,Output,State>::AddWorker(LocalSearchSolver* s) 
+  { 
+    assert(s != this);
+    workers.push_back(s); 
+  }
+
+  /**
+     Removes all the workers, so that MultiStartSolve performs the
+     restarts in the calling thread.
+  */
+  template <class Input, class Output, class State>
+  void LocalSearchSolver<Input,Output,State>::ClearWorkers() 
+  { workers.clear(); }
+
+  /**
+     Sets the ratio above which a restart of a parallel multi-start is 
+     dominated: the runners of a worker stop when their best cost
+     exceeds the best cost of all the workers multiplied by the ratio.
+
+     @param r the ratio (0 for never stopping the restarts)
+  */
+  template <class Input, class Output, class State>
+  void LocalSearchSolver<Input,Output,State>::SetDominanceRatio(double r) 
+  { dominance_ratio = r; }
+
+  /**
+     Makes the solving procedures reproducible: they draw their random
+     numbers from a generator with the given seed, the workers (or the
+     threads of a parallel solver) draw from generators whose seeds are
+     derived from it, and they are synchronized after a given number of
+     runs, rather than by the clock. The outcome does not depend on the
+     number of threads, provided that the runners are bounded by their
+     numbers of iterations (the time limit of the solver is only 
+     checked at the synchronizations).
+
+     @param seed the master seed
+     @param width the number of restarts of a parallel multi-start 
+     between two synchronizations (0 for the number of workers); the
+     outcome also depends on it
+  */
+  template <class Input, class Output, class State>
+  void LocalSearchSolver<Input,Output,State>::SetDeterministic(unsigned long seed, unsigned int width) 
+  { 
+    deterministic = true;
+    master_seed = seed;
+    batch_width = width;
+  }
+
+  /**
+     Lets the parallel solving procedures run freely (the default), 
+     which is faster but not reproducible.
+  */
+  template <class Input, class Output, class State>
+  void LocalSearchSolver<Input,Output,State>::SetFreeRunning() 
+  { deterministic = false; }
+
+  /**
+     Tries multiple runs on different initial states and records the
+     best one. If the solver has workers, the runs are spread over them.
+     
+     @param n the number of trials
+   */
+  template <class Input, class Output, class State>
+  void LocalSearchSolver<Input,Output,State>::MultiStartSolve(unsigned int n)
+  { 
+    FastRandom rng(master_seed);
+    FastRandom* previous = deterministic ? SetThreadRandom(&rng) : NULL;
+    if (!workers.empty())
+      {
+	if (deterministic)
+	  DeterministicMultiStartSolve(n);
+	else
+	  ParallelMultiStartSolve(n);
+	if (deterministic)
+	  SetThreadRandom(previous);
+	return;
+      }
+    State best_state;
+    fvalue best_state_cost = 0; // we assign it a value only to prevent
+                                // warnings from "smart" compilers
+    StartTimer();
+    for (unsigned int i = 0; i < n && (i == 0 || !DeadlinePassed()); i++)
+      { 
+	FindInitialState();
+	Run();
+	if (i == 0 || internal_state_cost < best_state_cost)
+	  { 
+	    best_state = internal_state;
+	    best_state_cost = internal_state_cost;
+	  }
+	if (NotifyRound(i))
+	  break;
+      }
+    internal_state = best_state;
+    internal_state_cost = best_state_cost;
+    DeliverOutput();
+    if (deterministic)
+      SetThreadRandom(previous);
+  }
+
+  /**
+     Performs the restarts of a multi-start on the workers, each one in
+     its own thread. The workers take the restarts from a shared counter,
+     and publish the costs of their best states to a shared incumbent,
+     that is watched by their runners for stopping the dominated 
+     restarts. Each worker draws its random numbers from its own 
+     generator, whose seed is derived from a seed drawn from Random.
+     At the end, the best state of all the workers is delivered (the
+     ties go to the first worker).
+
+     @param n the number of trials
+  */
+  template <class Input, class Output, class State>
+  void LocalSearchSolver<Input,Output,State>::ParallelMultiStartSolve(unsigned int n)
+  { 
+    unsigned int k, best = 0;
+    MultiStart shared;
+    std::vector<Worker> worker(workers.size());
+    std::vector<pthread_t> thread(workers.size());
+    unsigned long base_seed = Random(0,RAND_MAX - 1);
+    StartTimer();
+    shared.master = this;
+    shared.restarts = n > 0 ? n : 1;
+    shared.started = 0;
+    shared.incumbent.Set(std::numeric_limits<fvalue>::max());
+    pthread_mutex_init(&shared.round_lock, NULL);
+    for (k = 0; k < workers.size(); k++)
+      { 
+	LocalSearchSolver* s = workers[k];
+	s->deadline = deadline;
+	s->stop_requested = false;
+	s->number_of_init_trials = number_of_init_trials;
+	s->initial_state_method = initial_state_method;
+	s->incumbent_observer = IncumbentObserver(&shared.incumbent, dominance_ratio);
+	s->observe_incumbent = true;
+	worker[k].solver = s;
+	worker[k].shared = &shared;
+	worker[k].best.SetInput(this->p_in);
+	worker[k].found = false;
+	worker[k].rng.Seed(DerivedSeed(base_seed, k));
+      }
+    for (k = 0; k < workers.size(); k++)
+      pthread_create(&thread[k], NULL, WorkerThread, &worker[k]);
+    for (k = 0; k < workers.size(); k++)
+      pthread_join(thread[k], NULL);
+    pthread_mutex_destroy(&shared.round_lock);
+    for (k = 0; k < workers.size(); k++)
+      { 
+	workers[k]->observe_incumbent = false;
+	if (worker[k].found && (!worker[best].found || worker[k].best_cost < worker[best].best_cost))
+	  best = k;
+      }
+    assert(worker[best].found);
+    internal_state = worker[best].best;
+    internal_state_cost = worker[best].best_cost;
+    DeliverOutput();
+  }
+
+  /**
+     The body of a worker thread of a parallel multi-start: it performs
+     restarts until all of them are taken, the deadline has passed, or
+     the observer of the master has stopped the search.
+  */
+  template <class Input, class Output, class State>
+  void* LocalSearchSolver<Input,Output,State>::WorkerThread(void* arg)
+  { 
+    Worker& w = *static_cast<Worker*>(arg);
+    MultiStart& m = *w.shared;
+    LocalSearchSolver* s = w.solver;
+    SetConcurrentThread(true);
+    SetThreadRandom(&w.rng);
+    while (true)
+      { 
+	unsigned int i = __sync_fetch_and_add(&m.started, 1);
+	if (i >= m.restarts || (i > 0 && m.master->DeadlinePassed()))
+	  break;
+	s->FindInitialState();
+	s->Run();
+	m.incumbent.Improve(s->internal_state_cost);
+	if (!w.found || s->internal_state_cost < w.best_cost)
+	  { 
+	    w.best = s->internal_state;
+	    w.best_cost = s->internal_state_cost;
+	    w.found = true;
+	  }
+	pthread_mutex_lock(&m.round_lock);
+	m.master->internal_state_cost = m.incumbent.Get();
+	bool stop = m.master->NotifyRound(i, w.best_cost == m.master->internal_state_cost ? &w.best : NULL);
+	if (stop) // no further restart is started
+	  __sync_fetch_and_add(&m.started, m.restarts);
+	pthread_mutex_unlock(&m.round_lock);
+	if (stop)
+	  break;
+      }
+    SetThreadRandom(NULL);
+    return NULL;
+  }
+
+  /**
+     Performs the restarts of a multi-start on the workers in batches of
+     a fixed width: the threads share the restarts of a batch in a 
+     fixed way, and restart i draws its random numbers from a generator
+     whose seed is derived from i. After each batch, the rounds are 
+     delivered in the order of the restarts, and the best cost found
+     so far becomes the reference for stopping the dominated restarts 
+     of the next batch, so that the outcome is the same for any number
+     of workers (the ties go to the first restart).
+
+     @param n the number of trials
+  */
+  template <class Input, class Output, class State>
+  void LocalSearchSolver<Input,Output,State>::DeterministicMultiStartSolve(unsigned int n)
+  { 
+    unsigned int k, i, begin, end, threads = workers.size();
+    unsigned int restarts = n > 0 ? n : 1;
+    unsigned int width = batch_width > 0 ? batch_width : threads;
+    unsigned long base_seed = Random(0,RAND_MAX - 1);
+    std::vector<Share> share(threads);
+    std::vector<pthread_t> thread(threads);
+    std::vector<State> best(width);
+    std::vector<fvalue> best_cost(width);
+    SharedCost incumbent(std::numeric_limits<fvalue>::max()), 
+      reference(std::numeric_limits<fvalue>::max());
+    State best_state;
+    fvalue best_state_cost = 0;
+    bool stop = false;
+    StartTimer();
+    best_state.SetInput(this->p_in);
+    for (i = 0; i < width; i++)
+      best[i].SetInput(this->p_in);
+    for (k = 0; k < threads; k++)
+      { 
+	LocalSearchSolver* s = workers[k];
+	s->deadline = 0; // checked between the batches
+	s->stop_requested = false;
+	s->deterministic = true;
+	s->number_of_init_trials = number_of_init_trials;
+	s->initial_state_method = initial_state_method;
+	s->incumbent_observer = IncumbentObserver(&incumbent, dominance_ratio, false, &reference);
+	s->observe_incumbent = true;
+	share[k].solver = s;
+	share[k].base_seed = base_seed;
+	share[k].step = threads;
+	share[k].best = &best[0];
+	share[k].best_cost = &best_cost[0];
+      }
+    for (begin = 0; begin < restarts && !stop && (begin == 0 || !DeadlinePassed()); begin = end)
+      { 
+	end = restarts - begin > width ? begin + width : restarts;
+	for (k = 0; k < threads; k++)
+	  {
+	    share[k].begin = begin;
+	    share[k].first = begin + k;
+	    share[k].end = end;
+	    pthread_create(&thread[k], NULL, ShareThread, &share[k]);
+	  }
+	for (k = 0; k < threads; k++)
+	  pthread_join(thread[k], NULL);
+	for (i = begin; i < end; i++)
+	  { 
+	    if (i == 0 || best_cost[i - begin] < best_state_cost)
+	      { 
+		best_state = best[i - begin];
+		best_state_cost = best_cost[i - begin];
+	      }
+	    internal_state_cost = best_state_cost;
+	    if (NotifyRound(i,&best_state))
+	      { 
+		stop = true;
+		break;
+	      }
+	  }
+	reference.Set(best_state_cost);
+      }
+    for (k = 0; k < threads; k++)
+      { 
+	workers[k]->observe_incumbent = false;
+	workers[k]->deterministic = false;
+      }
+    internal_state = best_state;
+    internal_state_cost = best_state_cost;
+    DeliverOutput();
+  }
+
+  /**
+     The body of a thread of a batch of a deterministic multi-start: it
+     performs its restarts of the batch, each one with its own 
+     generator.
+  */
+  template <class Input, class Output, class State>
+  void* LocalSearchSolver<Input,Output,State>::ShareThread(void* arg)
+  { 
+    Share& b = *static_cast<Share*>(arg);
+    LocalSearchSolver* s = b.solver;
+    FastRandom rng;
+    FastRandom* previous = SetThreadRandom(&rng);
+    for (unsigned int i = b.first; i < b.end; i += b.step)
+      { 
+	rng.Seed(DerivedSeed(b.base_seed, i));
+	s->FindInitialState();
+	s->Run();
+	b.best[i - b.begin] = s->internal_state;
+	b.best_cost[i - b.begin] = s->internal_state_cost;
+      }
+    SetThreadRandom(previous);
+    return NULL;
+  }
+
+  /**
+     In the case of multi-runner solvers, the number of iterations is the
+     overall number of iterations performed by any runner.
+  */
+  template <class Input, class Output, class State>
+  unsigned long MultiRunnerSolver<Input,Output,State>::NumberOfIterations() const 
+  { return total_iterations; }
+
+
+  /**
+     Constructs a multi runner solver by providing it links to
+     a state manager, an output manager, an input, and an output object.
+
+     @param sm a pointer to a compatible state manager
+     @param om a pointer to a compatible output manager
+     @param in a pointer to an input object
+     @param out a pointer to an output object
+  */
+  template <class Input, class Output, class State>
+  MultiRunnerSolver<Input,Output,State>::MultiRunnerSolver(StateManager<Input,State>* sm, OutputManager<Input,Output,State>* om, Input* in, Output* out)
+    : LocalSearchSolver<Input,Output,State>(sm,om,in,out), 
+    total_iterations(0)
+  { runners.clear(); }
+
+  /**
+     Sets the i-th runner managed by the solver to the passed parameter.
+
+     @param r a pointer to a compatible runner
+     @param i the runner position to set with r
+  */
+  template <class Input, class Output, class State>
+  void MultiRunnerSolver<Input,Output,State>::SetRunner(Runner<Input,State> *r, unsigned int i) 
+  { 
+    assert(i < runners.size());
+    runners[i] = r; 
+  }
+
+  /**
+     Adds the given runner to the list of the managed runners.
+
+     @param r a pointer to a compatible runner to add
+   */
+  template <class Input, class Output, class State>
+  void MultiRunnerSolver<Input,Output,State>::AddRunner(Runner<Input,State> *r)
+  { runners.push_back(r); }
+
+  /**
+     Clears the vector of runners managed by the solver.
+  */
+  template <class Input, class Output, class State>
+  void MultiRunnerSolver<Input,Output,State>::ClearRunners()
+  { runners.clear(); }
+
+  /**
+     Lets all the managed runners Go, and then it collects the best state
+     found.
+   */
+  template <class Input, class Output, class State>
+  void ComparativeSolver<Input,Output,State>::Run()
+  { 
+    unsigned int i;
+    start_state = this->internal_state;
+    this->runners[0]->SetCurrentState(start_state);
+    this->GoRunner(this->runners[0]);
+    this->runners[0]->ComputeCost();
+    this->internal_state = this->runners[0]->GetBestState();
+    this->internal_state_cost = this->runners[0]->BestStateCost();
+    if (this->NotifyRound(0))
+      return;
+	
+    for (i = 1; i < this->runners.size(); i++)
+      {
+	this->runners[i]->SetCurrentState(start_state);
+	this->GoRunner(this->runners[i]);
+	this->runners[i]->ComputeCost();
+	this->total_iterations += this->runners[i]->NumberOfIterations();
+	if (this->runners[i]->BestStateCost() < this->internal_state_cost)
+	  {
+	    this->internal_state = this->runners[i]->GetBestState();
+	    this->internal_state_cost = this->runners[i]->BestStateCost();
+	  }
+	if (this->NotifyRound(i))
+	  break;
+      }
+  }
+
+  /**
+     Constructs a concurrent comparative solver by providing it links to
+     a state manager, an output manager, an input, and an output object.
+
+     @param sm a pointer to a compatible state manager
+     @param om a pointer to a compatible output manager
+     @param in a pointer to an input object
+     @param out a pointer to an output object
+  */
+  template <class Input, class Output, class State>
+  ConcurrentComparativeSolver<Input,Output,State>::ConcurrentComparativeSolver(StateManager<Input,State>* sm, OutputManager<Input,Output,State>* om, Input* in, Output* out)
+    : ComparativeSolver<Input,Output,State>(sm,om,in,out), 
+    cancel_at_lower_bound(false), incumbent(0)
+  {}
+
+  /**
+     Sets whether all the runs are cancelled as soon as one of them
+     reaches the lower bound of the cost function.
+
+     @param c true for cancelling the runs
+  */
+  template <class Input, class Output, class State>
+  void ConcurrentComparativeSolver<Input,Output,State>::SetCancelAtLowerBound(bool c)
+  { cancel_at_lower_bound = c; }
+
+  /**
+     Lets all the managed runners Go at the same time from the internal
+     state, and then it collects the best state found (the ties go to
+     the first runner). Each runner draws its random numbers from its
+     own generator, whose seed is derived from a seed drawn from Random;
+     in deterministic mode the runs are not cancelled, and are not
+     bounded by the deadline.
+   */
+  template <class Input, class Output, class State>
+  void ConcurrentComparativeSolver<Input,Output,State>::Run()
+  { 
+    unsigned int i;
+    std::vector<Contestant> contestant(this->runners.size());
+    std::vector<pthread_t> thread(this->runners.size());
+    unsigned long base_seed = Random(0,RAND_MAX - 1);
+    this->start_state = this->internal_state;
+    incumbent.Set(std::numeric_limits<fvalue>::max());
+    cancel_observer = IncumbentObserver(&incumbent, 0.0, true);
+    for (i = 0; i < this->runners.size(); i++)
+      {
+	this->runners[i]->SetCurrentState(this->start_state);
+	contestant[i].solver = this;
+	contestant[i].runner = this->runners[i];
+	contestant[i].rng.Seed(DerivedSeed(base_seed, i));
+	if (this->observe_incumbent)
+	  contestant[i].observer = &this->incumbent_observer;
+	else if (cancel_at_lower_bound && !this->deterministic)
+	  contestant[i].observer = &cancel_observer;
+	else
+	  contestant[i].observer = NULL;
+      }
+    for (i = 0; i < this->runners.size(); i++)
+      pthread_create(&thread[i], NULL, RunnerThread, &contestant[i]);
+    for (i = 0; i < this->runners.size(); i++)
+      pthread_join(thread[i], NULL);
+    for (i = 0; i < this->runners.size(); i++)
+      {
+	this->total_iterations += this->runners[i]->NumberOfIterations();
+	if (i == 0 || this->runners[i]->BestStateCost() < this->internal_state_cost)
+	  {
+	    this->internal_state = this->runners[i]->GetBestState();
+	    this->internal_state_cost = this->runners[i]->BestStateCost();
+	  }
+	if (this->NotifyRound(i))
+	  break;
+      }
+  }
+
+  /**
+     The body of the thread of a runner: it lets the runner Go within 
+     the deadline of the solving procedure.
+  */
+  template <class Input, class Output, class State>
+  void* ConcurrentComparativeSolver<Input,Output,State>::RunnerThread(void* arg)
+  { 
+    Contestant& c = *static_cast<Contestant*>(arg);
+    SetConcurrentThread(true);
+    SetThreadRandom(&c.rng);
+    c.runner->SetDeadline(c.solver->deterministic ? 0 : c.solver->deadline);
+    if (c.observer != NULL)
+      c.runner->SetObserver(c.observer);
+    c.runner->Go();
+    if (c.observer != NULL)
+      c.runner->SetObserver(NULL);
+    c.runner->SetDeadline(0);
+    c.runner->ComputeCost();
+    SetThreadRandom(NULL);
+    return NULL;
+  }
+
+  /**
+     Sets the number of rounds to the given value.
+     
+     @param r the number of rounds.
+  */
+  template <class Input, class Output, class State>
+  void TokenRingSolver<Input,Output,State>::SetRounds(unsigned int r) 
+  { max_idle_rounds = r; }
+
+  /**
+     Starts the token-ring from the i-th runner.
+     
+     @param i the runner which to start form
+  */
+  template <class Input, class Output, class State>
+  void TokenRingSolver<Input,Output,State>::SetStartRunner(unsigned int i)
+  { this->start_runner = i; }
+
+
+  /**
+     Constructs a token-ring runner solver by providing it links to
+     a state manager, an output manager, an input, and an output object.
+
+     @param sm a pointer to a compatible state manager
+     @param om a pointer to a compatible output manager
+     @param in a pointer to an input object
+     @param out a pointer to an output object
+  */
+  template <class Input, class Output, class State>
+  TokenRingSolver<Input,Output,State>::TokenRingSolver(StateManager<Input,State>* sm, OutputManager<Input,Output,State>* om, Input* in, Output* out) 
+    : MultiRunnerSolver<Input,Output,State>(sm,om,in,out), 
+    max_idle_rounds(1) 
+  {}
+
+  /**
+     Checks wether the object state is consistent with all the related
+     objects.
+  */
+  template <class Input, class Output, class State>
+  void TokenRingSolver<Input,Output,State>::Check()
+  {
+    LocalSearchSolver<Input,Output,State>::Check();
+    for (unsigned int i = 0; i < this->runners.size(); i++)
+      {
+	this->runners[i]->Check();
+	assert(this->runners[i]->GetInput() == this->p_in);
+      }
+  }
+
+  /**
+     Outputs the solver state on a given output stream.
+
+     @param os the output stream
+  */
+  template <class Input, class Output, class State>
+  void TokenRingSolver<Input,Output,State>::Print(std::ostream& os) const
+  {
+    os << "Solver State" << std::endl;
+    for (unsigned int i = 0; i < this->runners.size(); i++)
+      {
+	os << "Runner " << i << std::endl;
+	this->runners[i]->Print(os);
+      }
+  }
+
+  /**
+     Runs all the managed runners one after another till no improvement
+     has produced in a given number of rounds
+  */
+  template <class Input, class Output, class State>
+  void TokenRingSolver<Input,Output,State>::Run()
+  {
+    assert(this->start_runner < this->runners.size());
+  	
+    // i is the current runner, j is the previous one;
+    unsigned int i = this->start_runner, j = (this->start_runner >= 1) ?
+      (this->start_runner - 1) : this->runners.size() - 1;
+    int idle_rounds = 0;
+    unsigned int round = 0;
+    bool interrupt_search = false;
+    bool improvement_found = false;
+	
+    this->ComputeCost(); // Set internal_state_cost
+    // internal_state_cost is used to check
+    // whether a full round has produces improvements or not
+    this->runners[i]->SetCurrentState(this->internal_state);
+	
+    while (idle_rounds < max_idle_rounds && !interrupt_search)
+      { 
+        do
+	  {
+	    this->GoRunner(this->runners[i]);
+	    if (this->runners[i]->BestStateCost() < this->internal_state_cost) 
+	      { 
+	        this->internal_state = this->runners[i]->GetBestState(); 
+	        this->internal_state_cost = this->runners[i]->BestStateCost(); 
+	        improvement_found = true;
+	      } 
+	    this->total_iterations += this->runners[i]->NumberOfIterations();
+	    if (this->runners[i]->LowerBoundReached() || this->runners.size() == 1
+		|| this->DeadlinePassed())
+	      {
+	        interrupt_search = true;
+	        break;
+	      }
+	    j = i;
+	    i = (i + 1) % this->runners.size();
+	    this->runners[i]->SetCurrentState(this->runners[j]->GetBestState());
+  	  }
+        while (i != this->start_runner);
+		
+        if (!interrupt_search)
+	  {
+	    if (improvement_found)
+	      idle_rounds = 0;
+	    else
+  	      idle_rounds++;
+  	    improvement_found = false;
+  	  }
+	if (this->NotifyRound(round++))
+	  interrupt_search = true;
+      }
+  }
+
+  /**
+     Constructs an iterated local search solver by providing it links 
+     to a state manager, an output manager, the neighborhood explorer 
+     of the kick moves, an input, and an output object.
+
+     @param sm a pointer to a compatible state manager
+     @param om a pointer to a compatible output manager
+     @param ne a pointer to a compatible neighborhood explorer
+     @param in a pointer to an input object
+     @param out a pointer to an output object
+  */
+  template <class Input, class Output, class State, class Move>
+  IteratedLocalSearch<Input,Output,State,Move>::IteratedLocalSearch(StateManager<Input,State>* sm, OutputManager<Input,Output,State>* om, NeighborhoodExplorer<Input,State,Move>* ne, Input* in, Output* out) 
+    : TokenRingSolver<Input,Output,State>(sm,om,in,out), p_nhe(ne),
+    max_idle_kicks(10), min_strength(2), max_strength(20), 
+    acceptance(ACCEPT_BETTER), temperature(1.0), kicks(0)
+  {}
+
+  /**
+     Sets the number of kicks without improvement after which the 
+     search stops.
+
+     @param max_idle the number of kicks
+  */
+  template <class Input, class Output, class State, class Move>
+  void IteratedLocalSearch<Input,Output,State,Move>::SetKicks(unsigned int max_idle) 
+  { max_idle_kicks = max_idle; }
+
+  /**
+     Sets the range of the number of moves of a kick.
+
+     @param min the number of moves after an improvement
+     @param max the maximum number of moves
+  */
+  template <class Input, class Output, class State, class Move>
+  void IteratedLocalSearch<Input,Output,State,Move>::SetKickStrength(unsigned int min, unsigned int max) 
+  { 
+    assert(min > 0 && min <= max);
+    min_strength = min; 
+    max_strength = max; 
+  }
+
+  /**
+     Sets the acceptance criterion of the local minima.
+
+     @param a the criterion
+     @param t the temperature (used only by ACCEPT_ANNEALING)
+  */
+  template <class Input, class Output, class State, class Move>
+  void IteratedLocalSearch<Input,Output,State,Move>::SetAcceptance(Acceptance a, double t) 
+  { 
+    assert(a != ACCEPT_ANNEALING || t > 0);
+    acceptance = a; 
+    temperature = t; 
+  }
+
+  /**
+     Outputs the solver state on a given output stream.
+
+     @param os the output stream
+  */
+  template <class Input, class Output, class State, class Move>
+  void IteratedLocalSearch<Input,Output,State,Move>::Print(std::ostream& os) const
+  {
+    TokenRingSolver<Input,Output,State>::Print(os);
+    os << "Kicks: " << kicks << " (strength " << min_strength << "-" 
+       << max_strength << ", max idle " << max_idle_kicks << ")" << std::endl;
+  }
+
+  /**
+     Runs the token ring from the internal state, and then from a kick
+     of the current local minimum, till the given number of kicks has 
+     not improved the best state. The best state becomes the internal 
+     state.
+  */
+  template <class Input, class Output, class State, class Move>
+  void IteratedLocalSearch<Input,Output,State,Move>::Run()
+  {
+    typedef TokenRingSolver<Input,Output,State> TR;
+    this->TR::Run();
+    State current_state = this->internal_state, best_state = this->internal_state;
+    fvalue current_state_cost = this->internal_state_cost, 
+      best_state_cost = this->internal_state_cost;
+    unsigned int strength = min_strength, idle_kicks = 0;
+	
+    kicks = 0;
+    while (idle_kicks < max_idle_kicks && best_state_cost != 0 
+	   && !this->DeadlinePassed() && !this->stop_requested)
+      {
+	this->internal_state = current_state;
+	Kick(this->internal_state,strength);
+	this->TR::Run();
+	kicks++;
+	if (this->internal_state_cost < best_state_cost)
+	  {
+	    best_state = this->internal_state;
+	    best_state_cost = this->internal_state_cost;
+	    idle_kicks = 0;
+	    strength = min_strength;
+	  }
+	else
+	  {
+	    idle_kicks++;
+	    if (strength < max_strength)
+	      strength++;
+	  }
+	if (AcceptKick(this->internal_state_cost,current_state_cost))
+	  {
+	    current_state = this->internal_state;
+	    current_state_cost = this->internal_state_cost;
+	  }
+      }
+    this->internal_state = best_state;
+    this->internal_state_cost = best_state_cost;
+  }
+
+  /**
+     Perturbs a state by performing the given number of moves. The 
+     unfeasible moves are skipped.
+
+     @param st the state to perturb
+     @param strength the number of moves
+  */
+  template <class Input, class Output, class State, class Move>
+  void IteratedLocalSearch<Input,Output,State,Move>::Kick(State& st, unsigned int strength)
+  {
+    Move mv;
+    for (unsigned int i = 0; i < strength; i++)
+      {
+	SelectKickMove(st,mv);
+	if (p_nhe->FeasibleMove(st,mv))
+	  p_nhe->MakeMove(st,mv);
+      }
+  }
+
+  /**
+     Checks whether the local minimum reached after a kick becomes the
+     state perturbed by the next one.
+
+     @param cost the cost of the local minimum
+     @param current_cost the cost of the current state
+     @return true if the local minimum is accepted
+  */
+  template <class Input, class Output, class State, class Move>
+  bool IteratedLocalSearch<Input,Output,State,Move>::AcceptKick(fvalue cost, fvalue current_cost)
+  {
+    switch (acceptance)
+      {
+      case ACCEPT_ALWAYS:
+	return true;
+      case ACCEPT_ANNEALING:
+	return cost <= current_cost
+	  || ((float)Random(0,RAND_MAX - 1))/RAND_MAX < exp(-(cost - current_cost)/temperature);
+      default:
+	return cost <= current_cost;
+      }
+  }
+
+  /**
+     Constructs the neighborhood of the moves of a neighborhood explorer.
+
+     @param ne a pointer to a compatible neighborhood explorer
+  */
+  template <class Input, class State, class Move>
+  MoveNeighborhood<Input,State,Move>::MoveNeighborhood(NeighborhoodExplorer<Input,State,Move>* ne) 
+    : p_nhe(ne)
+  {}
+
+  /**
+     Performs the best move of the neighborhood explorer while it 
+     improves the state, at most a given number of times.
+
+     @param st the state
+     @param cost the cost of the state, updated by the descent
+     @param max_moves the maximum number of moves
+     @return the number of moves performed
+  */
+  template <class Input, class State, class Move>
+  unsigned long MoveNeighborhood<Input,State,Move>::Descend(State& st, fvalue& cost,
+							    unsigned long max_moves) 
+  { 
+    unsigned long moves = 0;
+    fvalue delta;
+    while (moves < max_moves && (delta = p_nhe->BestMove(st,mv)) < 0)
+      {
+	p_nhe->MakeMove(st,mv);
+	cost += delta;
+	moves++;
+      }
+    return moves;
+  }
+
+  /**
+     Performs a random move of the neighborhood explorer, if it is 
+     feasible.
+
+     @param st the state
+     @param cost the cost of the state, updated by the move
+  */
+  template <class Input, class State, class Move>
+  void MoveNeighborhood<Input,State,Move>::RandomStep(State& st, fvalue& cost) 
+  { 
+    p_nhe->RandomMove(st,mv);
+    if (p_nhe->FeasibleMove(st,mv))
+      {
+	cost += p_nhe->DeltaCostFunction(st,mv);
+	p_nhe->MakeMove(st,mv);
+      }
+  }
+
+  /**
+     Constructs a variable neighborhood search solver by providing it 
+     links to a state manager, an output manager, an input, and an 
+     output object.
+
+     @param sm a pointer to a compatible state manager
+     @param om a pointer to a compatible output manager
+     @param in a pointer to an input object
+     @param out a pointer to an output object
+  */
+  template <class Input, class Output, class State>
+  VariableNeighborhoodSearch<Input,Output,State>::VariableNeighborhoodSearch(StateManager<Input,State>* sm, OutputManager<Input,Output,State>* om, Input* in, Output* out) 
+    : LocalSearchSolver<Input,Output,State>(sm,om,in,out), max_shake(10),
+    number_of_moves(0), shakes(0)
+  {}
+
+  /**
+     Adds a neighborhood after the ones already present.
+
+     @param n a pointer to the neighborhood
+  */
+  template <class Input, class Output, class State>
+  void VariableNeighborhoodSearch<Input,Output,State>::AddNeighborhood(Neighborhood<Input,State>* n) 
+  { neighborhoods.push_back(n); }
+
+  /**
+     Removes all the neighborhoods.
+  */
+  template <class Input, class Output, class State>
+  void VariableNeighborhoodSearch<Input,Output,State>::ClearNeighborhoods() 
+  { neighborhoods.clear(); }
+
+  /**
+     Sets the maximum number of moves of a shake: the search stops
+     when a shake of this size does not improve the best state.
+
+     @param max the number of moves (0 for a plain descent)
+  */
+  template <class Input, class Output, class State>
+  void VariableNeighborhoodSearch<Input,Output,State>::SetShakes(unsigned int max) 
+  { max_shake = max; }
+
+  /**
+     Returns the number of moves performed in the last run, either by
+     the descents or by the shakes.
+  */
+  template <class Input, class Output, class State>
+  unsigned long VariableNeighborhoodSearch<Input,Output,State>::NumberOfIterations() const 
+  { return number_of_moves; }
+
+  /**
+     Outputs the solver state on a given output stream.
+
+     @param os the output stream
   */
   template <class Input, class Output, class State>
-  unsigned long SimpleLocalSearch<Input,Output,State>::NumberOfIterations() const 
-  { return p_runner->NumberOfIterations(); }
+  void VariableNeighborhoodSearch<Input,Output,State>::Print(std::ostream& os) const
+  {
+    os << "Variable Neighborhood Search: " << neighborhoods.size() 
+       << " neighborhoods, max shake " << max_shake << std::endl;
+    os << "Moves: " << number_of_moves << ", shakes: " << shakes << std::endl;
+  }
 
   /**
-     Lets the runner Go, and then collects the best state found.
+     Descends from the internal state, and then from shakes of 
+     increasing size of the best state found. The internal state is
+     the working state of the search, and it becomes the best one at
+     the end.
   */
   template <class Input, class Output, class State>
-  void SimpleLocalSearch<Input,Output,State>::Run()
+  void VariableNeighborhoodSearch<Input,Output,State>::Run()
   {
-    p_runner->SetCurrentState(this->internal_state);
-    p_runner->Go();
-    this->internal_state = p_runner->GetBestState();
-    this->internal_state_cost = p_runner->BestStateCost();
+    assert(!neighborhoods.empty());
+    number_of_moves = 0;
+    shakes = 0;
+    this->ComputeCost();
+    Descend();
+    State best_state = this->internal_state;
+    fvalue best_state_cost = this->internal_state_cost;
+    unsigned int k = 1;
+
+    while (k <= max_shake && best_state_cost != 0
+	   && !this->DeadlinePassed() && !this->stop_requested)
+      {
+	Shake(k);
+	Descend();
+	if (this->internal_state_cost < best_state_cost)
+	  {
+	    best_state = this->internal_state;
+	    best_state_cost = this->internal_state_cost;
+	    k = 1;
+	  }
+	else
+	  {
+	    this->internal_state = best_state;
+	    this->internal_state_cost = best_state_cost;
+	    k++;
+	  }
+	this->NotifyRound(shakes++);
+      }
   }
 
   /**
-     Performs a full solving procedure by finding an initial state, 
-     running the attached runner and delivering the output.
+     Performs the variable neighborhood descent on the internal state:
+     the next neighborhood is explored when a neighborhood does not 
+     improve it, and the first one otherwise. Since a move costs the
+     exploration of a whole neighborhood, the deadline and the stop
+     requests are checked after each one.
   */
   template <class Input, class Output, class State>
-  void LocalSearchSolver<Input,Output,State>::Solve()
+  void VariableNeighborhoodSearch<Input,Output,State>::Descend()
   {
-    FindInitialState();
-    Run();
-    DeliverOutput();
+    unsigned int i = 0;
+    while (i < neighborhoods.size())
+      {
+	unsigned long moves = 0;
+	while (neighborhoods[i]->Descend(this->internal_state,
+					 this->internal_state_cost, 1) > 0)
+	  {
+	    moves++;
+	    if (this->DeadlinePassed() || this->stop_requested)
+	      {
+		number_of_moves += moves;
+		return;
+	      }
+	  }
+	number_of_moves += moves;
+	i = (moves > 0 && i > 0) ? 0 : i + 1;
+      }
   }
-  
+
   /**
-     Start again a solving procedure, running the attached runner from
-     the current internal state.
+     Perturbs the internal state by a compound move.
+
+     @param k the number of random moves, each one of a random 
+     neighborhood
   */
   template <class Input, class Output, class State>
-  void LocalSearchSolver<Input,Output,State>::ReSolve()
+  void VariableNeighborhoodSearch<Input,Output,State>::Shake(unsigned int k)
   {
-    Run();
-    DeliverOutput();
+    for (unsigned int j = 0; j < k; j++)
+      neighborhoods[Random(0,neighborhoods.size() - 1)]->RandomStep(this->internal_state,
+								    this->internal_state_cost);
+    number_of_moves += k;
   }
 
   /**
-     Tries multiple runs on different initial states and records the
-     best one.
-     
-     @param n the number of trials
-   */
+     Constructs a large neighborhood search solver by providing it 
+     links to a state manager, an output manager, an input, and an 
+     output object.
+
+     @param sm a pointer to a compatible state manager
+     @param om a pointer to a compatible output manager
+     @param methods the number of destroy methods
+     @param in a pointer to an input object
+     @param out a pointer to an output object
+  */
   template <class Input, class Output, class State>
-  void LocalSearchSolver<Input,Output,State>::MultiStartSolve(unsigned int n)
+  LargeNeighborhoodSearch<Input,Output,State>::LargeNeighborhoodSearch(StateManager<Input,State>* sm, OutputManager<Input,Output,State>* om, unsigned int methods, Input* in, Output* out) 
+    : LocalSearchSolver<Input,Output,State>(sm,om,in,out), 
+    weight(methods,1.0), uses(methods,0), improvements(methods,0),
+    max_idle_iteration(1000), number_of_iterations(0), reaction(0.1)
+  { assert(methods > 0); }
+
+  /**
+     Sets the number of iterations without improvement after which 
+     the search stops.
+
+     @param max the number of iterations
+  */
+  template <class Input, class Output, class State>
+  void LargeNeighborhoodSearch<Input,Output,State>::SetIdleIterations(unsigned long max) 
+  { max_idle_iteration = max; }
+
+  /**
+     Sets the reaction factor of the weights of the methods.
+
+     @param r the reaction factor, in (0,1]
+  */
+  template <class Input, class Output, class State>
+  void LargeNeighborhoodSearch<Input,Output,State>::SetReaction(double r) 
   { 
-    State best_state;
-    fvalue best_state_cost = 0; // we assign it a value only to prevent
-                                // warnings from "smart" compilers
-    for (unsigned int i = 0; i < n; i++)
-      { 
-	FindInitialState();
-	Run();
-	if (i == 0 || internal_state_cost < best_state_cost)
-	  { 
-	    best_state = internal_state;
-	    best_state_cost = internal_state_cost;
+    assert(r > 0 && r <= 1);
+    reaction = r; 
+  }
+
+  /**
+     Returns the number of destroy and repair iterations of the last
+     run.
+  */
+  template <class Input, class Output, class State>
+  unsigned long LargeNeighborhoodSearch<Input,Output,State>::NumberOfIterations() const 
+  { return number_of_iterations; }
+
+  /**
+     Outputs the solver state on a given output stream.
+
+     @param os the output stream
+  */
+  template <class Input, class Output, class State>
+  void LargeNeighborhoodSearch<Input,Output,State>::Print(std::ostream& os) const
+  {
+    os << "Large Neighborhood Search: " << number_of_iterations << " iterations" << std::endl;
+    for (unsigned int m = 0; m < weight.size(); m++)
+      os << "  Method " << m << ": weight " << weight[m] << ", uses " << uses[m] 
+	 << ", improvements " << improvements[m] << std::endl;
+  }
+
+  /**
+     Destroys and repairs the internal state till the given number of
+     iterations has not improved it.
+  */
+  template <class Input, class Output, class State>
+  void LargeNeighborhoodSearch<Input,Output,State>::Run()
+  {
+    const double MIN_WEIGHT = 0.05;
+    unsigned long idle_iterations = 0;
+    this->ComputeCost();
+    number_of_iterations = 0;
+    for (unsigned int m = 0; m < weight.size(); m++)
+      {
+	weight[m] = 1.0;
+	uses[m] = 0;
+	improvements[m] = 0;
+      }
+
+    while (idle_iterations < max_idle_iteration && this->internal_state_cost != 0
+	   && !this->DeadlinePassed() && !this->stop_requested)
+      {
+	unsigned int m = SelectMethod();
+	fvalue delta = DestroyAndRepair(this->internal_state,m);
+	assert(delta <= 0);
+	this->internal_state_cost += delta;
+	number_of_iterations++;
+	uses[m]++;
+	if (delta < 0)
+	  {
+	    improvements[m]++;
+	    idle_iterations = 0;
 	  }
+	else
+	  idle_iterations++;
+	weight[m] = (1 - reaction) * weight[m] + reaction * (delta < 0 ? 1.0 : 0.0);
+	if (weight[m] < MIN_WEIGHT)
+	  weight[m] = MIN_WEIGHT;
+	this->NotifyRound(number_of_iterations - 1);
       }
-    internal_state = best_state;
-    internal_state_cost = best_state_cost;
-    DeliverOutput();
   }
 
   /**
-     In the case of multi-runner solvers, the number of iterations is the
-     overall number of iterations performed by any runner.
+     Constructs an island model solver by providing it links to a state
+     manager, an output manager, an input, and an output object.
+
+     @param sm a pointer to a compatible state manager
+     @param om a pointer to a compatible output manager
+     @param in a pointer to an input object
+     @param out a pointer to an output object
   */
   template <class Input, class Output, class State>
-  unsigned long MultiRunnerSolver<Input,Output,State>::NumberOfIterations() const 
-  { return total_iterations; }
+  IslandModelSolver<Input,Output,State>::IslandModelSolver(StateManager<Input,State>* sm, OutputManager<Input,Output,State>* om, Input* in, Output* out)
+    : LocalSearchSolver<Input,Output,State>(sm,om,in,out),
+    migration_interval(1), queue_capacity(4), max_idle_epochs(5), 
+    threads(0), incumbent(0), halt(false), round(0)
+  {}
+
+  /**
+     Adds an island, that is a solver with its own runners and helpers
+     (only a state manager and an output manager that are not modified 
+     by the search can be shared).
+
+     @param s a pointer to the solver of the island
+  */
+  template <class Input, class Output, class State>
+  void IslandModelSolver<Input,Output,State>::AddIsland(LocalSearchSolver<Input,Output,State>* s)
+  { 
+    assert(s != this);
+    solvers.push_back(s); 
+  }
 
+  /**
+     Removes all the islands.
+  */
+  template <class Input, class Output, class State>
+  void IslandModelSolver<Input,Output,State>::ClearIslands()
+  { solvers.clear(); }
+
+  /**
+     Sets the frequency of the migrations and the capacity of the 
+     queues of the migrants.
+
+     @param interval the number of epochs between two migrations
+     @param capacity the number of migrants an island can hold 
+     (rounded up to a power of 2)
+  */
+  template <class Input, class Output, class State>
+  void IslandModelSolver<Input,Output,State>::SetMigration(unsigned int interval, unsigned long capacity)
+  { 
+    assert(interval > 0 && capacity > 0);
+    migration_interval = interval; 
+    queue_capacity = capacity;
+  }
+
+  /**
+     Sets the maximum number of epochs of an island without improving
+     its best state.
+
+     @param max the number of epochs
+  */
+  template <class Input, class Output, class State>
+  void IslandModelSolver<Input,Output,State>::SetIdleEpochs(unsigned int max)
+  { max_idle_epochs = max; }
+
+  /**
+     Sets the number of threads that perform the synchronous epochs of
+     the deterministic mode (in free-running mode each island has its
+     own thread).
+
+     @param t the number of threads (0 for a thread per island)
+  */
+  template <class Input, class Output, class State>
+  void IslandModelSolver<Input,Output,State>::SetThreads(unsigned int t)
+  { threads = t; }
+
+  /**
+     Returns the number of iterations performed by the solvers of all
+     the islands.
+
+     @return the number of iterations
+  */
+  template <class Input, class Output, class State>
+  unsigned long IslandModelSolver<Input,Output,State>::NumberOfIterations() const
+  { 
+    unsigned long iterations = 0;
+    for (unsigned int k = 0; k < solvers.size(); k++)
+      iterations += solvers[k]->NumberOfIterations();
+    return iterations; 
+  }
+
+  /**
+     Prints the outcome of the islands in the last run.
+
+     @param os the output stream
+  */
+  template <class Input, class Output, class State>
+  void IslandModelSolver<Input,Output,State>::Print(std::ostream& os) const
+  {
+    os << "Island Model: " << island.size() << " islands, " << round 
+       << " epochs" << std::endl;
+    for (unsigned int k = 0; k < island.size(); k++)
+      os << "  Island " << k << ": best " << island[k].best_cost 
+	 << ", epochs " << island[k].epochs << ", migrants adopted " 
+	 << island[k].adopted << std::endl;
+  }
+
+  /**
+     Runs the islands in their own threads (or in synchronous epochs, in
+     deterministic mode), the first one from the internal state and the
+     others from their own initial states, and then it collects the 
+     best state found (the ties go to the first island). Each island
+     draws its random numbers from its own generator, whose seed is
+     derived from a seed drawn from Random.
+  */
+  template <class Input, class Output, class State>
+  void IslandModelSolver<Input,Output,State>::Run()
+  {
+    unsigned int k, best = 0, n = solvers.size();
+    assert(n > 0);
+    island.resize(n);
+    incumbent.Set(std::numeric_limits<fvalue>::max());
+    halt = false;
+    round = 0;
+    pthread_mutex_init(&round_lock, NULL);
+    for (k = 0; k < n; k++)
+      {
+	island[k].model = this;
+	island[k].solver = solvers[k];
+	island[k].immigrants = new BoundedQueue<Migrant>(queue_capacity);
+	island[k].best.SetInput(this->p_in);
+	island[k].epochs = 0;
+	island[k].idle_epochs = 0;
+	island[k].adopted = 0;
+      }
+    for (k = 0; k < n; k++)
+      island[k].emigrants = island[(k + 1) % n].immigrants;
+    if (this->deterministic)
+      RunSynchronousEpochs();
+    else
+      {
+	std::vector<pthread_t> thread(n);
+	unsigned long base_seed = Random(0,RAND_MAX - 1);
+	for (k = 0; k < n; k++)
+	  island[k].rng.Seed(DerivedSeed(base_seed, k));
+	for (k = 0; k < n; k++)
+	  pthread_create(&thread[k], NULL, IslandThread, &island[k]);
+	for (k = 0; k < n; k++)
+	  pthread_join(thread[k], NULL);
+      }
+    pthread_mutex_destroy(&round_lock);
+    for (k = 0; k < n; k++)
+      {
+	if (island[k].best_cost < island[best].best_cost)
+	  best = k;
+	delete island[k].immigrants;
+	island[k].immigrants = island[k].emigrants = NULL;
+      }
+    this->internal_state = island[best].best;
+    this->internal_state_cost = island[best].best_cost;
+  }
+
+  /**
+     The body of the thread of an island, which draws from the 
+     generator of the island.
+  */
+  template <class Input, class Output, class State>
+  void* IslandModelSolver<Input,Output,State>::IslandThread(void* arg)
+  {
+    Island& is = *static_cast<Island*>(arg);
+    SetConcurrentThread(true);
+    SetThreadRandom(&is.rng);
+    is.model->RunIsland(is);
+    SetThreadRandom(NULL);
+    return NULL;
+  }
+
+  /**
+     Performs the epochs of an island, with the migrations, till the 
+     island is idle, or the solver has to stop.
+
+     @param is the island
+  */
+  template <class Input, class Output, class State>
+  void IslandModelSolver<Input,Output,State>::RunIsland(Island& is)
+  {
+    is.solver->deadline = this->deadline;
+    StartIsland(is);
+    while (is.idle_epochs < max_idle_epochs && !halt && !this->DeadlinePassed())
+      {
+	RunEpoch(is);
+	if (is.epochs % migration_interval == 0)
+	  {
+	    Emigrate(is);
+	    Immigrate(is);
+	  }
+	if (EndEpoch(is))
+	  break;
+      }
+  }
+
+  /**
+     Performs synchronous epochs of the running islands, spread over 
+     the threads, with a generator for each island whose seed is 
+     derived from a seed drawn from Random. Between two epochs, the 
+     migrations and the ends of the epochs take place in the order of
+     the islands, so that the outcome does not depend on the number of
+     threads.
+  */
+  template <class Input, class Output, class State>
+  void IslandModelSolver<Input,Output,State>::RunSynchronousEpochs()
+  {
+    unsigned int k, t, n = island.size();
+    unsigned int m = threads > 0 && threads < n ? threads : n;
+    unsigned long base_seed = Random(0,RAND_MAX - 1);
+    std::vector<Crew> crew(m);
+    std::vector<pthread_t> thread(m);
+    bool start = true, running = true;
+    for (k = 0; k < n; k++)
+      {
+	island[k].rng.Seed(DerivedSeed(base_seed, k));
+	island[k].running = true;
+	island[k].solver->deadline = 0; // checked between the epochs
+	island[k].solver->deterministic = true;
+      }
+    while (running)
+      {
+	for (t = 0; t < m; t++)
+	  {
+	    crew[t].model = this;
+	    crew[t].first = t;
+	    crew[t].start = start;
+	    pthread_create(&thread[t], NULL, CrewThread, &crew[t]);
+	  }
+	for (t = 0; t < m; t++)
+	  pthread_join(thread[t], NULL);
+	start = false;
+	for (k = 0; k < n; k++)
+	  if (island[k].running && island[k].epochs % migration_interval == 0)
+	    Emigrate(island[k]);
+	for (k = 0; k < n; k++)
+	  if (island[k].running && island[k].epochs % migration_interval == 0)
+	    Immigrate(island[k]);
+	running = false;
+	for (k = 0; k < n && !halt; k++)
+	  if (island[k].running)
+	    {
+	      if (EndEpoch(island[k]))
+		break;
+	      island[k].running = island[k].idle_epochs < max_idle_epochs;
+	      running = running || island[k].running;
+	    }
+	running = running && !halt && !this->DeadlinePassed();
+      }
+    for (k = 0; k < n; k++)
+      island[k].solver->deterministic = false;
+  }
+
+  /**
+     The body of a thread of a synchronous epoch: it performs an epoch
+     of its running islands (after starting them, in the first epoch),
+     each one with its own generator.
+  */
+  template <class Input, class Output, class State>
+  void* IslandModelSolver<Input,Output,State>::CrewThread(void* arg)
+  {
+    Crew& c = *static_cast<Crew*>(arg);
+    SetConcurrentThread(true);
+    IslandModelSolver* model = c.model;
+    unsigned int step = model->threads > 0 && model->threads < model->island.size() 
+      ? model->threads : model->island.size();
+    for (unsigned int k = c.first; k < model->island.size(); k += step)
+      {
+	Island& is = model->island[k];
+	if (!is.running)
+	  continue;
+	FastRandom* previous = SetThreadRandom(&is.rng);
+	if (c.start)
+	  model->StartIsland(is);
+	model->RunEpoch(is);
+	SetThreadRandom(previous);
+      }
+    return NULL;
+  }
+
+  /**
+     Sets the initial state of an island: the internal state of the
+     solver for the first island, a new initial state for the others.
+
+     @param is the island
+  */
+  template <class Input, class Output, class State>
+  void IslandModelSolver<Input,Output,State>::StartIsland(Island& is)
+  {
+    LocalSearchSolver<Input,Output,State>* s = is.solver;
+    s->stop_requested = false;
+    if (&is == &island[0])
+      {
+	s->internal_state = this->internal_state;
+	s->ComputeCost();
+      }
+    else
+      s->FindInitialState();
+    is.best = s->internal_state;
+    is.best_cost = s->internal_state_cost;
+    incumbent.Improve(is.best_cost);
+  }
+
+  /**
+     Performs an epoch of an island, and updates its best state.
+
+     @param is the island
+  */
+  template <class Input, class Output, class State>
+  void IslandModelSolver<Input,Output,State>::RunEpoch(Island& is)
+  {
+    LocalSearchSolver<Input,Output,State>* s = is.solver;
+    s->Run();
+    is.epochs++;
+    if (s->internal_state_cost < is.best_cost)
+      {
+	is.best = s->internal_state;
+	is.best_cost = s->internal_state_cost;
+	incumbent.Improve(is.best_cost);
+	is.idle_epochs = 0;
+      }
+    else
+      is.idle_epochs++;
+  }
+
+  /**
+     Sends a copy of the best state of an island to the next one (the
+     migrant is dropped if the queue is full).
+
+     @param is the island
+  */
+  template <class Input, class Output, class State>
+  void IslandModelSolver<Input,Output,State>::Emigrate(Island& is)
+  {
+    Migrant migrant;
+    migrant.state = is.best;
+    migrant.cost = is.best_cost;
+    is.emigrants->Push(migrant);
+  }
+
+  /**
+     Receives the migrants sent to an island, and adopts the best one 
+     if it is better than the current state of the island.
+
+     @param is the island
+  */
+  template <class Input, class Output, class State>
+  void IslandModelSolver<Input,Output,State>::Immigrate(Island& is)
+  {
+    LocalSearchSolver<Input,Output,State>* s = is.solver;
+    Migrant immigrant;
+    bool adopted = false;
+    immigrant.state.SetInput(this->p_in);
+    while (is.immigrants->Pop(immigrant))
+      if (immigrant.cost < s->internal_state_cost)
+	{
+	  s->internal_state = immigrant.state;
+	  s->internal_state_cost = immigrant.cost;
+	  adopted = true;
+	}
+    if (adopted)
+      is.adopted++;
+  }
+
+  /**
+     Delivers the end of an epoch to the observer, and decides whether
+     all the islands have to stop (because of the observer or because
+     the lower bound has been reached). The best state of the island is
+     offered to the snapshot writer, if it is the best of all.
+
+     @param is the island
+     @return true if the islands have to stop
+  */
+  template <class Input, class Output, class State>
+  bool IslandModelSolver<Input,Output,State>::EndEpoch(const Island& is)
+  {
+    pthread_mutex_lock(&round_lock);
+    this->internal_state_cost = incumbent.Get();
+    if (this->NotifyRound(round++, is.best_cost == this->internal_state_cost ? &is.best : NULL) 
+	|| this->internal_state_cost == 0)
+      halt = true;
+    bool stop = halt;
+    pthread_mutex_unlock(&round_lock);
+    return stop;
+  }
 
   /**
-     Constructs a multi runner solver by providing it links to
-     a state manager, an output manager, an input, and an output object.
+     Constructs a process pool solver by providing it links to a state
+     manager, an output manager, an input, and an output object.
 
      @param sm a pointer to a compatible state manager
      @param om a pointer to a compatible output manager
@@ -1832,187 +5362,391 @@ namespace easylocal {
      @param out a pointer to an output object
   */
   template <class Input, class Output, class State>
-  MultiRunnerSolver<Input,Output,State>::MultiRunnerSolver(StateManager<Input,State>* sm, OutputManager<Input,Output,State>* om, Input* in, Output* out)
-    : LocalSearchSolver<Input,Output,State>(sm,om,in,out), 
-    total_iterations(0)
-  { runners.clear(); }
+  ProcessPoolSolver<Input,Output,State>::ProcessPoolSolver(StateManager<Input,State>* sm, OutputManager<Input,Output,State>* om, Input* in, Output* out)
+    : LocalSearchSolver<Input,Output,State>(sm,om,in,out), p_worker(NULL),
+    processes(2), restarts(0), capacity(1 << 20), max_respawns(10), 
+    region(NULL), base_seed(1), respawns(0), total_iterations(0), 
+    publications(0)
+  {}
 
   /**
-     Sets the i-th runner managed by the solver to the passed parameter.
+     Sets the solver run by the workers (each process has its own copy
+     of it, and of its runners and helpers). It must be a solver whose
+     internal state is its best state at the end of its rounds, such as
+     a token ring.
 
-     @param r a pointer to a compatible runner
-     @param i the runner position to set with r
+     @param s a pointer to the solver
   */
   template <class Input, class Output, class State>
-  void MultiRunnerSolver<Input,Output,State>::SetRunner(Runner<Input,State> *r, unsigned int i) 
+  void ProcessPoolSolver<Input,Output,State>::SetWorker(LocalSearchSolver<Input,Output,State>* s)
   { 
-    assert(i < runners.size());
-    runners[i] = r; 
+    assert(s != this);
+    p_worker = s; 
   }
 
   /**
-     Adds the given runner to the list of the managed runners.
+     Sets the number of worker processes.
 
-     @param r a pointer to a compatible runner to add
-   */
+     @param n the number of processes
+  */
   template <class Input, class Output, class State>
-  void MultiRunnerSolver<Input,Output,State>::AddRunner(Runner<Input,State> *r)
-  { runners.push_back(r); }
+  void ProcessPoolSolver<Input,Output,State>::SetProcesses(unsigned int n)
+  { 
+    assert(n > 0);
+    processes = n; 
+  }
 
   /**
-     Clears the vector of runners managed by the solver.
+     Sets the number of restarts of the worker solver performed by each
+     worker.
+
+     @param r the number of restarts (0 for restarting till the solver 
+     stops)
   */
   template <class Input, class Output, class State>
-  void MultiRunnerSolver<Input,Output,State>::ClearRunners()
-  { runners.clear(); }
+  void ProcessPoolSolver<Input,Output,State>::SetRestarts(unsigned int r)
+  { restarts = r; }
 
   /**
-     Lets all the managed runners Go, and then it collects the best state
-     found.
-   */
+     Sets the size of the buffer of the incumbent state, i.e., the 
+     maximum length of a state written by the output manager (the 
+     longer states are not published).
+
+     @param c the size in bytes
+  */
   template <class Input, class Output, class State>
-  void ComparativeSolver<Input,Output,State>::Run()
-  { 
-    int i;
-    start_state = this->internal_state;
-    this->runners[0]->SetCurrentState(start_state);
-    this->runners[0]->Go();
-    this->runners[0]->ComputeCost();
-    this->internal_state = this->runners[0]->GetBestState();
-    this->internal_state_cost = this->runners[0]->BestStateCost();
-	
-    for (i = 1; i < this->runners.size(); i++)
+  void ProcessPoolSolver<Input,Output,State>::SetStateCapacity(unsigned long c)
+  { capacity = c; }
+
+  /**
+     Sets the maximum number of workers that replace the crashed ones
+     in a run.
+
+     @param r the number of replacements
+  */
+  template <class Input, class Output, class State>
+  void ProcessPoolSolver<Input,Output,State>::SetMaxRespawns(unsigned int r)
+  { max_respawns = r; }
+
+  /**
+     Returns the number of iterations performed by the workers in the
+     restarts they have completed.
+
+     @return the number of iterations
+  */
+  template <class Input, class Output, class State>
+  unsigned long ProcessPoolSolver<Input,Output,State>::NumberOfIterations() const
+  { return total_iterations; }
+
+  /**
+     Prints the outcome of the last run.
+
+     @param os the output stream
+  */
+  template <class Input, class Output, class State>
+  void ProcessPoolSolver<Input,Output,State>::Print(std::ostream& os) const
+  {
+    os << "Process Pool: " << processes << " workers, " << respawns 
+       << " respawned, " << publications << " states published, " 
+       << total_iterations << " iterations" << std::endl;
+  }
+
+  /**
+     Maps the shared region, publishes the internal state, and forks 
+     the workers; then it watches them (replacing the crashed ones) and
+     the incumbent till the run is over, and collects the incumbent.
+     The rounds delivered to the observer are the improvements of the
+     incumbent.
+     If the region cannot be mapped, the worker solver is run in the 
+     calling process.
+  */
+  template <class Input, class Output, class State>
+  void ProcessPoolSolver<Input,Output,State>::Run()
+  {
+    const double POLL_PERIOD = 0.05, KILL_GRACE = 5.0;
+    unsigned int k, live, round = 0;
+    unsigned long size = sizeof(Region) + capacity;
+    double stop_time = 0;
+    bool stopping = false;
+    assert(p_worker != NULL);
+    void* memory = mmap(NULL, size, PROT_READ | PROT_WRITE, 
+			MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    if (memory == MAP_FAILED)
       {
-	this->runners[i]->SetCurrentState(start_state);
-	this->runners[i]->Go();
-	this->runners[i]->ComputeCost();
-	this->total_iterations += this->runners[i]->NumberOfIterations();
-	if (this->runners[i]->BestStateCost() < this->internal_state_cost)
+	std::cerr << "Process Pool: shared memory not available, "
+		  << "the worker solver runs in the calling process" << std::endl;
+	p_worker->internal_state = this->internal_state;
+	p_worker->Run();
+	this->internal_state = p_worker->internal_state;
+	this->internal_state_cost = p_worker->internal_state_cost;
+	return;
+      }
+    region = new (memory) Region;
+    pthread_mutexattr_t attr;
+    pthread_mutexattr_init(&attr);
+    pthread_mutexattr_setpshared(&attr, PTHREAD_PROCESS_SHARED);
+    pthread_mutexattr_setrobust(&attr, PTHREAD_MUTEX_ROBUST);
+    pthread_mutex_init(&region->writer_lock, &attr);
+    pthread_mutexattr_destroy(&attr);
+    region->incumbent.Set(std::numeric_limits<fvalue>::max());
+    region->sequence = 0;
+    region->state_cost = std::numeric_limits<fvalue>::max();
+    region->length = 0;
+    region->iterations = 0;
+    region->publications = 0;
+    this->ComputeCost();
+    Publish(this->internal_state,this->internal_state_cost);
+    base_seed = this->deterministic ? this->master_seed : Random(0,RAND_MAX - 1);
+    worker_pid.assign(processes,0);
+    generation.assign(processes,0);
+    respawns = 0;
+    std::cout.flush(); // the workers would write the buffers again
+    std::cerr.flush();
+    for (k = 0; k < processes; k++)
+      Spawn(k);
+    do
+      {
+	usleep((useconds_t)(POLL_PERIOD * 1e6));
+	int status;
+	for (k = 0; k < processes; k++)
+	  if (worker_pid[k] != 0 && waitpid(worker_pid[k], &status, WNOHANG) > 0)
+	    {
+	      worker_pid[k] = 0;
+	      if (!stopping && !(WIFEXITED(status) && WEXITSTATUS(status) == 0)
+		  && respawns < max_respawns)
+		{
+		  respawns++;
+		  generation[k]++;
+		  Spawn(k);
+		}
+	    }
+	bool improved = region->incumbent.Get() < this->internal_state_cost
+	  && ReadIncumbent(this->internal_state,this->internal_state_cost);
+	if (!stopping && ((improved && this->NotifyRound(round++)) 
+			  || StopRequest::Pending() || this->DeadlinePassed() 
+			  || this->internal_state_cost == 0))
 	  {
-	    this->internal_state = this->runners[i]->GetBestState();
-	    this->internal_state_cost = this->runners[i]->BestStateCost();
+	    stopping = true;
+	    stop_time = WallClock::Now();
+	    StopWorkers(SIGTERM);
+	  }
+	else if (stopping && stop_time > 0 && WallClock::Now() > stop_time + KILL_GRACE)
+	  {
+	    stop_time = 0;
+	    StopWorkers(SIGKILL);
 	  }
+	for (k = 0, live = 0; k < processes; k++)
+	  if (worker_pid[k] != 0)
+	    live++;
       }
+    while (live > 0);
+    ReadIncumbent(this->internal_state,this->internal_state_cost);
+    total_iterations = region->iterations;
+    publications = region->publications;
+    pthread_mutex_destroy(&region->writer_lock);
+    region->~Region();
+    munmap(memory, size);
+    region = NULL;
   }
 
   /**
-     Sets the number of rounds to the given value.
-     
-     @param r the number of rounds.
+     Forks a worker, with a seed derived from its slot and from the 
+     number of its replacements.
+
+     @param slot the slot of the worker
   */
   template <class Input, class Output, class State>
-  void TokenRingSolver<Input,Output,State>::SetRounds(unsigned int r) 
-  { max_idle_rounds = r; }
+  void ProcessPoolSolver<Input,Output,State>::Spawn(unsigned int slot)
+  {
+    pid_t p = fork();
+    if (p == 0)
+      WorkerProcess(slot); // it does not return
+    else if (p > 0)
+      worker_pid[slot] = p;
+    else
+      std::cerr << "Process Pool: cannot fork worker " << slot << std::endl;
+  }
 
   /**
-     Starts the token-ring from the i-th runner.
-     
-     @param i the runner which to start form
+     The body of a worker process: it performs the restarts of the 
+     worker solver, publishing its best states, till they are over or
+     the process receives SIGTERM (SIGINT, which a terminal also sends
+     to the workers, is left to the solver process), or the deadline
+     of the solver has passed. The process ends without running the
+     destructors and the exit handlers of the solver process.
+
+     @param slot the slot of the worker
   */
   template <class Input, class Output, class State>
-  void TokenRingSolver<Input,Output,State>::SetStartRunner(unsigned int i)
-  { this->start_runner = i; }
-
+  void ProcessPoolSolver<Input,Output,State>::WorkerProcess(unsigned int slot)
+  {
+    unsigned long seed = DerivedSeed(DerivedSeed(base_seed, slot), generation[slot]);
+    FastRandom rng(seed);
+    Publisher publisher(this);
+    StopRequest::Clear();
+    StopRequest::InstallHandlers();
+    signal(SIGINT, SIG_IGN);
+    srand(seed);
+    SetThreadRandom(&rng);
+    SetConcurrentThread(true);
+    p_worker->SetObserver(&publisher);
+    p_worker->SetSnapshotWriter(NULL);
+    double time_limit = p_worker->time_limit;
+    for (unsigned int r = 0; (restarts == 0 || r < restarts) && !StopRequest::Pending(); r++)
+      {
+	unsigned long iterations = p_worker->NumberOfIterations();
+	if (this->deadline > 0)
+	  { // the restart stops at the deadline of the solver
+	    double left = this->deadline - WallClock::Now();
+	    if (left <= 0)
+	      break;
+	    p_worker->SetTimeLimit(time_limit > 0 && time_limit < left ? time_limit : left);
+	  }
+	p_worker->Solve();
+	Publish(p_worker->internal_state,p_worker->internal_state_cost);
+	__sync_fetch_and_add(&region->iterations, p_worker->NumberOfIterations() - iterations);
+      }
+    _exit(0);
+  }
 
   /**
-     Constructs a token-ring runner solver by providing it links to
-     a state manager, an output manager, an input, and an output object.
+     Publishes the internal state of the worker solver at the end of 
+     one of its rounds.
 
-     @param sm a pointer to a compatible state manager
-     @param om a pointer to a compatible output manager
-     @param in a pointer to an input object
-     @param out a pointer to an output object
+     @param cost the cost of the internal state
   */
   template <class Input, class Output, class State>
-  TokenRingSolver<Input,Output,State>::TokenRingSolver(StateManager<Input,State>* sm, OutputManager<Input,Output,State>* om, Input* in, Output* out) 
-    : MultiRunnerSolver<Input,Output,State>(sm,om,in,out), 
-    max_idle_rounds(1) 
-  {}
+  void ProcessPoolSolver<Input,Output,State>::PublishWorkerState(fvalue cost)
+  { Publish(p_worker->internal_state,cost); }
 
   /**
-     Checks wether the object state is consistent with all the related
-     objects.
+     Publishes a state as the incumbent, if it is better. The cost is 
+     checked first without the lock; the state is written under the 
+     lock of the writers (which is robust, so that it is taken over if
+     its holder has died), between the two increments of the sequence.
+     A state left half written by a dead writer is always replaced.
+
+     @param st the state
+     @param cost the cost of the state
+     @return true if the state has been published
   */
   template <class Input, class Output, class State>
-  void TokenRingSolver<Input,Output,State>::Check()
+  bool ProcessPoolSolver<Input,Output,State>::Publish(const State& st, fvalue cost)
   {
-    LocalSearchSolver<Input,Output,State>::Check();
-    for (unsigned int i = 0; i < this->runners.size(); i++)
+    if (cost >= region->incumbent.Get())
+      return false;
+    std::ostringstream os;
+    this->p_om->WriteState(st,os);
+    std::string data = os.str();
+    if (data.size() > capacity)
+      return false;
+    int locked = pthread_mutex_lock(&region->writer_lock);
+    if (locked == EOWNERDEAD) // the previous writer has died
+      pthread_mutex_consistent(&region->writer_lock);
+    else if (locked != 0)
+      return false;
+    bool torn = region->sequence % 2 == 1, published = false;
+    if (torn || cost < region->state_cost)
       {
-	this->runners[i]->Check();
-	assert(this->runners[i]->GetInput() == this->p_in);
+	if (!torn)
+	  region->sequence++;
+	__sync_synchronize();
+	memcpy(region->Data(), data.data(), data.size());
+	region->length = data.size();
+	region->state_cost = cost;
+	__sync_synchronize();
+	region->sequence++;
+	if (torn)
+	  region->incumbent.Set(cost);
+	else
+	  region->incumbent.Improve(cost);
+	__sync_fetch_and_add(&region->publications, 1);
+	published = true;
       }
+    pthread_mutex_unlock(&region->writer_lock);
+    return published;
   }
 
   /**
-     Outputs the solver state on a given output stream.
+     Reads the incumbent state: the state and its cost are copied, and
+     the copy is repeated if a writer has changed the sequence in the 
+     meantime.
 
-     @param os the output stream
+     @param st the state read
+     @param cost the cost of the state
+     @return false if the state has been left half written by a dead 
+     writer (st and cost are not changed)
   */
   template <class Input, class Output, class State>
-  void TokenRingSolver<Input,Output,State>::Print(std::ostream& os) const
+  bool ProcessPoolSolver<Input,Output,State>::ReadIncumbent(State& st, fvalue& cost) const
   {
-    os << "Solver State" << std::endl;
-    for (unsigned int i = 0; i < this->runners.size(); i++)
+    std::string data;
+    fvalue state_cost;
+    while (true)
       {
-	os << "Runner " << i << std::endl;
-	this->runners[i]->Print(os);
+	unsigned long sequence = region->sequence;
+	__sync_synchronize();
+	if (sequence % 2 == 1)
+	  { // torn if the sequence is still odd without a writer
+	    int locked = pthread_mutex_trylock(&region->writer_lock);
+	    if (locked == EBUSY)
+	      {
+		sched_yield();
+		continue;
+	      }
+	    if (locked == EOWNERDEAD)
+	      pthread_mutex_consistent(&region->writer_lock);
+	    else if (locked != 0)
+	      return false;
+	    bool torn = region->sequence % 2 == 1;
+	    pthread_mutex_unlock(&region->writer_lock);
+	    if (torn)
+	      return false;
+	    continue;
+	  }
+	unsigned long length = region->length;
+	data.assign(region->Data(), length < capacity ? length : capacity);
+	state_cost = region->state_cost;
+	__sync_synchronize();
+	if (region->sequence == sequence)
+	  break;
       }
+    std::istringstream is(data);
+    this->p_om->ReadState(st,is);
+    cost = state_cost;
+    return true;
   }
 
   /**
-     Runs all the managed runners one after another till no improvement
-     has produced in a given number of rounds
+     Sends a signal to the running workers.
+
+     @param sig the signal
   */
   template <class Input, class Output, class State>
-  void TokenRingSolver<Input,Output,State>::Run()
+  void ProcessPoolSolver<Input,Output,State>::StopWorkers(int sig)
   {
-    assert(this->start_runner < this->runners.size());
-  	
-    // i is the current runner, j is the previous one;
-    unsigned int i = this->start_runner, j = (this->start_runner >= 1) ?
-      (this->start_runner - 1) : this->runners.size() - 1;
-    int idle_rounds = 0;
-    bool interrupt_search = false;
-    bool improvement_found = false;
-	
-    this->ComputeCost(); // Set internal_state_cost
-    // internal_state_cost is used to check
-    // whether a full round has produces improvements or not
-    this->runners[i]->SetCurrentState(this->internal_state);
-	
-    while (idle_rounds < max_idle_rounds && !interrupt_search)
-      { 
-        do
-	  {
-	    this->runners[i]->Go();
-	    if (this->runners[i]->BestStateCost() < this->internal_state_cost) 
-	      { 
-	        this->internal_state = this->runners[i]->GetBestState(); 
-	        this->internal_state_cost = this->runners[i]->BestStateCost(); 
-	        improvement_found = true;
-	      } 
-	    this->total_iterations += this->runners[i]->NumberOfIterations();
-	    if (this->runners[i]->LowerBoundReached() || this->runners.size() == 1)
-	      {
-	        interrupt_search = true;
-	        break;
-	      }
-	    j = i;
-	    i = (i + 1) % this->runners.size();
-	    this->runners[i]->SetCurrentState(this->runners[j]->GetBestState());
-  	  }
-        while (i != this->start_runner);
-		
-        if (!interrupt_search)
-	  {
-	    if (improvement_found)
-	      idle_rounds = 0;
-	    else
-  	      idle_rounds++;
-  	    improvement_found = false;
-  	  }
-      }
+    for (unsigned int k = 0; k < worker_pid.size(); k++)
+      if (worker_pid[k] != 0)
+	kill(worker_pid[k], sig);
+  }
+
+  /**
+     Draws a destroy method with probability proportional to its weight.
+
+     @return the method
+  */
+  template <class Input, class Output, class State>
+  unsigned int LargeNeighborhoodSearch<Input,Output,State>::SelectMethod() const
+  {
+    double total = 0;
+    unsigned int m;
+    for (m = 0; m < weight.size(); m++)
+      total += weight[m];
+    double x = total * Random(0,RAND_MAX - 1) / (double)RAND_MAX;
+    for (m = 0; m + 1 < weight.size(); m++)
+      if ((x -= weight[m]) < 0)
+	break;
+    return m;
   }
 
   // Abstract Move Tester
@@ -2401,7 +6135,16 @@ namespace easylocal {
     p_om = om;
     state_tester = NULL;
     solver = NULL;
+    selected_solver = NULL;
+    pool = NULL;
     logstream = &std::cerr;
+    solver_time_limit = 0;
+    solver_workers = 0;
+    solver_processes = 0;
+    solver_deterministic = false;
+    solver_seed = 0;
+    solver_batch_width = 0;
+    initial_state_method = RANDOM_INITIAL_STATE;
     output_file_prefix = "";
     plot_file_prefix = "";
   }
@@ -2424,9 +6167,19 @@ namespace easylocal {
     out.SetInput(in);
     if (solver != NULL) 
       solver->SetInput(in);
+    if (pool != NULL)
+      pool->SetInput(in);
+    for (i = 0; i < solvers.size(); i++)
+      solvers[i]->SetInput(in);
     for (i = 0; i < runners.size(); i++)
       if (runners[i] != NULL) 
 	runners[i]->SetInput(in);
+    for (i = 0; i < runner_sets.size(); i++)
+      {
+	runner_set_solvers[i]->SetInput(in);
+	for (unsigned int j = 0; j < runner_sets[i].size(); j++)
+	  runner_sets[i][j]->SetInput(in);
+      }
     for (i = 0; i < move_testers.size(); i++)
       move_testers[i]->SetInput(in);
   }
@@ -2481,6 +6234,123 @@ namespace easylocal {
       solver->SetOutput(&out);
   }
 
+  /**
+     Adds a worker to the token-ring solver associated to the tester: 
+     when the batch file asks for workers, each trial is a parallel
+     multi-start with one restart per worker (see 
+     LocalSearchSolver::AddWorker). The worker runs the runners named as
+     the ones of the solver, with the same parameters, among its own.
+
+     @param p_so a pointer to the worker, a token-ring solver with its
+     own runners and neighborhood explorers
+     @param r the runners of the worker
+  */
+  template <class Input, class Output, class State>
+  void Tester<Input, Output, State>::AddWorker(TokenRingSolver<Input,Output,State>* p_so,
+					       const std::vector<Runner<Input,State>*>& r)
+  { 
+    assert(p_so != solver);
+    workers.push_back(p_so);
+    AddRunnerSet(p_so,r);
+  }
+
+  /**
+     Sets the process pool that runs the token-ring solver when the 
+     batch file asks for processes. Its worker, a token-ring solver 
+     with its own runners and output, is given by AddRunnerSet.
+
+     @param p_so a pointer to the process pool
+  */
+  template <class Input, class Output, class State>
+  void Tester<Input, Output, State>::SetProcessPool(ProcessPoolSolver<Input,Output,State>* p_so)
+  { 
+    pool = p_so; 
+    if (p_in != NULL && p_in != pool->GetInput())
+      pool->SetInput(p_in);
+    if (&out != pool->GetOutput())
+      pool->SetOutput(&out);
+  }
+
+  /**
+     Attaches to the tester a solver that a batch file can select, by 
+     its name, instead of the token-ring one (see SelectSolver). Its
+     runners, if any, are given by AddRunnerSet.
+
+     @param p_so a pointer to the solver
+     @param name the name of the solver in the batch files
+  */
+  template <class Input, class Output, class State>
+  void Tester<Input, Output, State>::AddSolver(LocalSearchSolver<Input,Output,State>* p_so,
+					       std::string name)
+  { 
+    assert(p_so != solver);
+    solvers.push_back(p_so);
+    solver_names.push_back(name);
+    if (p_in != NULL && p_in != p_so->GetInput())
+      p_so->SetInput(p_in);
+    if (&out != p_so->GetOutput())
+      p_so->SetOutput(&out);
+  }
+
+  /**
+     Gives a solver its own copies of the runners of the experiments:
+     the runners named in a batch file are added to it (with the same
+     parameters) from the given ones, as they are added to the 
+     token-ring solver from the ones of the tester. A solver can have
+     several sets, which take turns: its n-th runner comes from its 
+     (n mod sets)-th set, so that the runners of a solver that runs them
+     at the same time (e.g., a ConcurrentComparativeSolver) do not share
+     their helpers.
+
+     @param p_so a pointer to the solver
+     @param r the runners of the solver
+  */
+  template <class Input, class Output, class State>
+  void Tester<Input, Output, State>::AddRunnerSet(MultiRunnerSolver<Input,Output,State>* p_so,
+						  const std::vector<Runner<Input,State>*>& r)
+  { 
+    runner_set_solvers.push_back(p_so);
+    runner_sets.push_back(r);
+    if (p_in != NULL && p_in != p_so->GetInput())
+      p_so->SetInput(p_in);
+    for (unsigned int i = 0; i < r.size(); i++)
+      if (p_in != r[i]->GetInput())
+	r[i]->SetInput(p_in);
+  }
+
+  /**
+     Lets a solver share the runners of the tester (the ones attached 
+     so far), for the solvers that never run at the same time as the 
+     token-ring one.
+
+     @param p_so a pointer to the solver
+  */
+  template <class Input, class Output, class State>
+  void Tester<Input, Output, State>::AddRunnerSet(MultiRunnerSolver<Input,Output,State>* p_so)
+  { AddRunnerSet(p_so,runners); }
+
+  /**
+     Selects the solver of the next experiments.
+
+     @param name the name of the solver, as given to AddSolver (empty 
+     for the token-ring solver)
+     @return 0, or SOLVER_NOT_FOUND if there is no such solver
+  */
+  template <class Input, class Output, class State>
+  int Tester<Input, Output, State>::SelectSolver(std::string name)
+  {
+    selected_solver = NULL;
+    if (name == "")
+      return 0;
+    for (unsigned int i = 0; i < solvers.size(); i++)
+      if (name == solver_names[i])
+	{
+	  selected_solver = solvers[i];
+	  return 0;
+	}
+    return SOLVER_NOT_FOUND;
+  }
+
   /**
      Sets the parameters of the token-ring solver associated to the tester.
      
@@ -2493,6 +6363,11 @@ namespace easylocal {
     assert(solver != NULL);
     solver->SetRounds(rounds);
     solver->SetStartRunner(start_runner);
+    for (unsigned int i = 0; i < workers.size(); i++)
+      {
+	workers[i]->SetRounds(rounds);
+	workers[i]->SetStartRunner(start_runner);
+      }
   }  
 
   /**
@@ -2541,6 +6416,8 @@ namespace easylocal {
   { 
     assert(solver != NULL); 
     solver->ClearRunners(); 
+    for (unsigned int i = 0; i < runner_set_solvers.size(); i++)
+      runner_set_solvers[i]->ClearRunners(); 
   }
 
   /** 
@@ -2563,6 +6440,28 @@ namespace easylocal {
 	    {
 	      type_mismatch = false;
 	      solver->AddRunner(runners[i]);	  
+	      // the sets whose turn it is (see AddRunnerSet)
+	      std::vector<bool> turn(runner_sets.size());
+	      for (unsigned int k = 0; k < runner_sets.size(); k++)
+		{
+		  unsigned int rank = 0, sets = 0;
+		  for (unsigned int h = 0; h < runner_sets.size(); h++)
+		    if (runner_set_solvers[h] == runner_set_solvers[k])
+		      {
+			if (h < k)
+			  rank++;
+			sets++;
+		      }
+		  turn[k] = runner_set_solvers[k]->NumberOfRunners() % sets == rank;
+		}
+	      for (unsigned int k = 0; k < runner_sets.size(); k++)
+		if (turn[k])
+		  for (unsigned int j = 0; j < runner_sets[k].size(); j++)
+		    if (name == runner_sets[k][j]->Name())
+		      {
+			runner_set_solvers[k]->AddRunner(runner_sets[k][j]);
+			break;
+		      }
 	    }
 	  else
 	    type_mismatch = true;
@@ -2597,25 +6496,89 @@ namespace easylocal {
 	  break;
 	}
     assert(found);
+    for (unsigned int k = 0; k < runner_sets.size(); k++)
+      for (unsigned int j = 0; j < runner_sets[k].size(); j++)
+	if (name == runner_sets[k][j]->Name()) 
+	  runner_sets[k][j]->SetParameters(pb);
+  }
+
+  /**
+     Sets the time limit of the runner specified by name.
+
+     @param name the name of the runner
+     @param s the time limit in seconds (0 for no limit)
+  */
+  template <class Input, class Output, class State>
+  void Tester<Input, Output, State>::SetRunnerTimeLimit(std::string name, double s)
+  {
+    bool found = false;
+    for (unsigned int i = 0; i < runners.size(); i++) 
+      if (name == runners[i]->Name()) 
+	{
+	  runners[i]->SetTimeLimit(s);
+	  found = true;
+	  break;
+	}
+    assert(found);
+    for (unsigned int k = 0; k < runner_sets.size(); k++)
+      for (unsigned int j = 0; j < runner_sets[k].size(); j++)
+	if (name == runner_sets[k][j]->Name()) 
+	  runner_sets[k][j]->SetTimeLimit(s);
   }
   
   /**
-     Starts the solver and collects the results.
+     Starts the solver and collects the results. The elapsed time of 
+     each trial is the wall time. A stop requested from outside the 
+     process ends the trial in progress, whose output is still 
+     written, and skips the remaining ones. The trials are run by the
+     selected solver (the token-ring one by default). If workers are 
+     requested, each trial of the token-ring solver is a parallel 
+     multi-start on them; if processes are requested, it is run by the
+     process pool instead. The trials are reproducible on request.
   */
   template <class Input, class Output, class State>
   void Tester<Input, Output, State>::StartSolver()
   { 
     double avgtime = 0;
     fvalue avgcost = 0, avgviol = 0, avgobj = 0;
+    unsigned int done = 0, k;
     assert(solver != NULL);
+    LocalSearchSolver<Input,Output,State>* so = selected_solver != NULL ? selected_solver : solver;
+    bool no_runners = so == solver && solver->NumberOfRunners() == 0;
+    for (k = 0; k < runner_set_solvers.size(); k++)
+      if (so == runner_set_solvers[k] && runner_set_solvers[k]->NumberOfRunners() == 0)
+	no_runners = true;
+    if (no_runners)
+      {
+	*logstream << "Error: the solver has no runners" << std::endl;
+	return;
+      }
+    if (so == solver && solver_processes > 0 && pool != NULL)
+      {
+	pool->SetProcesses(solver_processes);
+	pool->SetRestarts(solver_time_limit > 0 ? 0 : 1);
+	so = pool;
+      }
     *logstream << "Run\t" << "elapsed time\t" << "cost \t" << "violations\t" << "objective\t" << std::endl;
     *logstream << "--------------------------------------------------------------------------" << std::endl;
-    for (unsigned int i = 1; i <= trials; i++)
+    so->SetTimeLimit(solver_time_limit);
+    so->SetInitialState(initial_state_method);
+    bool multi_start = so == solver && solver_workers > 0 && !workers.empty();
+    solver->ClearWorkers();
+    for (k = 0; multi_start && k < solver_workers && k < workers.size(); k++)
+      solver->AddWorker(workers[k]);
+    for (unsigned int i = 1; i <= trials && (i == 1 || !StopRequest::Pending()); i++)
       {
-	unsigned long start_t = clock();
-	solver->Solve();
-	unsigned long end_t = clock();      
-	double eltime = (end_t - start_t)/(double)CLOCKS_PER_SEC;
+	WallClock chrono;
+	if (solver_deterministic)
+	  so->SetDeterministic(solver_seed + i - 1, solver_batch_width);
+	else
+	  so->SetFreeRunning();
+	if (multi_start)
+	  solver->MultiStartSolve(solver_workers < workers.size() ? solver_workers : workers.size());
+	else
+	  so->Solve();
+	double eltime = chrono.Elapsed();
 	p_om->InputState(test_state,out);
 	// writing the output in a output file
 	if (output_file_prefix != "")
@@ -2637,9 +6600,10 @@ namespace easylocal {
 	avgcost += cost;
 	avgviol += viol;
 	avgobj += obj;
+	done++;
       }
 	
-    avgtime /= trials; avgcost /= trials; avgviol /= trials; avgobj /= trials;
+    avgtime /= done; avgcost /= done; avgviol /= done; avgobj /= done;
     *logstream << "--------------------------------------------------------------------------" << std::endl;
     *logstream << "Avg:\t" << avgtime << "\t\t" << avgcost << "\t" << avgviol << "\t\t" << avgobj << std::endl;
   }
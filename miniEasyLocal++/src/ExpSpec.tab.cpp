@@ -1,21 +1,22 @@
-/* A Bison parser, made by GNU Bison 2.5.  */
+/* A Bison parser, made by GNU Bison 3.8.2.  */
 
 /* Bison implementation for Yacc-like parsers in C
-   
-      Copyright (C) 1984, 1989-1990, 2000-2011 Free Software Foundation, Inc.
-   
+
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
+
    This program is free software: you can redistribute it and/or modify
    it under the terms of the GNU General Public License as published by
    the Free Software Foundation, either version 3 of the License, or
    (at your option) any later version.
-   
+
    This program is distributed in the hope that it will be useful,
    but WITHOUT ANY WARRANTY; without even the implied warranty of
    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
    GNU General Public License for more details.
-   
+
    You should have received a copy of the GNU General Public License
-   along with this program.  If not, see <http://www.gnu.org/licenses/>.  */
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
 
 /* As a special exception, you may create a larger work that contains
    part or all of the Bison parser skeleton and distribute that work
@@ -26,13 +27,17 @@
    special exception, which will cause the skeleton and the resulting
    Bison output files to be licensed under the GNU General Public
    License without this special exception.
-   
+
    This special exception was added by the Free Software Foundation in
    version 2.2 of Bison.  */
 
 /* C LALR(1) parser skeleton written by Richard Stallman, by
    simplifying the original so-called "semantic" parser.  */
 
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
 /* All symbols defined below should begin with yy or YY, to avoid
    infringing on user name space.  This should be done even for local
    variables, as they might otherwise be expanded by user macros.
@@ -40,11 +45,11 @@
    define necessary library symbols; they are noted "INFRINGES ON
    USER NAME SPACE" below.  */
 
-/* Identify Bison output.  */
-#define YYBISON 1
+/* Identify Bison output, and Bison version.  */
+#define YYBISON 30802
 
-/* Bison version.  */
-#define YYBISON_VERSION "2.5"
+/* Bison version string.  */
+#define YYBISON_VERSION "3.8.2"
 
 /* Skeleton name.  */
 #define YYSKELETON_NAME "yacc.c"
@@ -58,14 +63,10 @@
 /* Pull parsers.  */
 #define YYPULL 1
 
-/* Using locations.  */
-#define YYLSP_NEEDED 0
 
 
 
-/* Copy the first part of user declarations.  */
-
-/* Line 268 of yacc.c  */
+/* First part of user prologue.  */
 #line 18 "ExpSpec.y"
 
 #include <iostream>
@@ -100,121 +101,226 @@ struct ix_parbox {
 };
 
 
+#line 105 "ExpSpec.tab.c"
 
-/* Line 268 of yacc.c  */
-#line 106 "ExpSpec.tab.c"
-
-/* Enabling traces.  */
-#ifndef YYDEBUG
-# define YYDEBUG 0
-#endif
-
-/* Enabling verbose error messages.  */
-#ifdef YYERROR_VERBOSE
-# undef YYERROR_VERBOSE
-# define YYERROR_VERBOSE 1
-#else
-# define YYERROR_VERBOSE 0
-#endif
-
-/* Enabling the token table.  */
-#ifndef YYTOKEN_TABLE
-# define YYTOKEN_TABLE 0
-#endif
-
-
-/* Tokens.  */
-#ifndef YYTOKENTYPE
-# define YYTOKENTYPE
-   /* Put the tokens into the symbol table, so that GDB and other debuggers
-      know about them.  */
-   enum yytokentype {
-     INSTANCE = 258,
-     OUTPUT_PREFIX = 259,
-     LOG_FILE = 260,
-     PLOT_PREFIX = 261,
-     TRIALS = 262,
-     RUNNER = 263,
-     TABU_SEARCH = 264,
-     HILL_CLIMBING = 265,
-     SIMULATED_ANNEALING = 266,
-     MAX_ITERATION = 267,
-     MAX_IDLE_ITERATION = 268,
-     MIN_TABU_TENURE = 269,
-     MAX_TABU_TENURE = 270,
-     START_TEMPERATURE = 271,
-     COOLING_RATE = 272,
-     NEIGHBORS_SAMPLED = 273,
-     BBLOCK = 274,
-     EBLOCK = 275,
-     ESTMT = 276,
-     IDENTIFIER = 277,
-     STRING = 278,
-     NATURAL = 279,
-     REAL = 280
-   };
-#endif
-
-
+# ifndef YY_CAST
+#  ifdef __cplusplus
+#   define YY_CAST(Type, Val) static_cast<Type> (Val)
+#   define YY_REINTERPRET_CAST(Type, Val) reinterpret_cast<Type> (Val)
+#  else
+#   define YY_CAST(Type, Val) ((Type) (Val))
+#   define YY_REINTERPRET_CAST(Type, Val) ((Type) (Val))
+#  endif
+# endif
+# ifndef YY_NULLPTR
+#  if defined __cplusplus
+#   if 201103L <= __cplusplus
+#    define YY_NULLPTR nullptr
+#   else
+#    define YY_NULLPTR 0
+#   endif
+#  else
+#   define YY_NULLPTR ((void*)0)
+#  endif
+# endif
 
-#if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
-typedef union YYSTYPE
+#include "ExpSpec.tab.h"
+/* Symbol kind.  */
+enum yysymbol_kind_t
 {
+  YYSYMBOL_YYEMPTY = -2,
+  YYSYMBOL_YYEOF = 0,                      /* "end of file"  */
+  YYSYMBOL_YYerror = 1,                    /* error  */
+  YYSYMBOL_YYUNDEF = 2,                    /* "invalid token"  */
+  YYSYMBOL_INSTANCE = 3,                   /* "Instance"  */
+  YYSYMBOL_OUTPUT_PREFIX = 4,              /* "Output prefix"  */
+  YYSYMBOL_LOG_FILE = 5,                   /* "Log file"  */
+  YYSYMBOL_PLOT_PREFIX = 6,                /* "Plot prefix"  */
+  YYSYMBOL_TRIALS = 7,                     /* "Trials"  */
+  YYSYMBOL_RUNNER = 8,                     /* "Runner"  */
+  YYSYMBOL_TABU_SEARCH = 9,                /* "tabu search"  */
+  YYSYMBOL_HILL_CLIMBING = 10,             /* "hill climbing"  */
+  YYSYMBOL_SIMULATED_ANNEALING = 11,       /* "simulated annealing"  */
+  YYSYMBOL_MAX_ITERATION = 12,             /* "max iteration"  */
+  YYSYMBOL_MAX_IDLE_ITERATION = 13,        /* "max idle iteration"  */
+  YYSYMBOL_MIN_TABU_TENURE = 14,           /* "min tabu tenure"  */
+  YYSYMBOL_MAX_TABU_TENURE = 15,           /* "max tabu tenure"  */
+  YYSYMBOL_DIVERSIFICATION = 16,           /* "diversification"  */
+  YYSYMBOL_START_TEMPERATURE = 17,         /* "start temperature"  */
+  YYSYMBOL_COOLING_RATE = 18,              /* "cooling rate"  */
+  YYSYMBOL_NEIGHBORS_SAMPLED = 19,         /* "neighbors sampled"  */
+  YYSYMBOL_LATE_ACCEPTANCE = 20,           /* "late acceptance"  */
+  YYSYMBOL_HISTORY_LENGTH = 21,            /* "history length"  */
+  YYSYMBOL_GREAT_DELUGE = 22,              /* "great deluge"  */
+  YYSYMBOL_LEVEL_FACTOR = 23,              /* "level factor"  */
+  YYSYMBOL_FINAL_LEVEL = 24,               /* "final level"  */
+  YYSYMBOL_TIME_BUDGET = 25,               /* "time budget"  */
+  YYSYMBOL_PARALLEL_TEMPERING = 26,        /* "parallel tempering"  */
+  YYSYMBOL_REPLICAS = 27,                  /* "replicas"  */
+  YYSYMBOL_MIN_TEMPERATURE = 28,           /* "min temperature"  */
+  YYSYMBOL_MAX_TEMPERATURE = 29,           /* "max temperature"  */
+  YYSYMBOL_EXCHANGE_INTERVAL = 30,         /* "exchange interval"  */
+  YYSYMBOL_ROOM_MATCHING = 31,             /* "room matching"  */
+  YYSYMBOL_THREADS = 32,                   /* "threads"  */
+  YYSYMBOL_SOLVER_TIME_LIMIT = 33,         /* "Time limit"  */
+  YYSYMBOL_INITIAL_STATE = 34,             /* "Initial state"  */
+  YYSYMBOL_WORKERS = 35,                   /* "Workers"  */
+  YYSYMBOL_PROCESSES = 36,                 /* "Processes"  */
+  YYSYMBOL_SOLVER_KIND = 37,               /* "Solver"  */
+  YYSYMBOL_DETERMINISTIC = 38,             /* "Deterministic"  */
+  YYSYMBOL_RANDOM = 39,                    /* "random"  */
+  YYSYMBOL_GREEDY = 40,                    /* "greedy"  */
+  YYSYMBOL_TIME_LIMIT = 41,                /* "time limit"  */
+  YYSYMBOL_BBLOCK = 42,                    /* "{"  */
+  YYSYMBOL_EBLOCK = 43,                    /* "}"  */
+  YYSYMBOL_ESTMT = 44,                     /* ";"  */
+  YYSYMBOL_COMMA = 45,                     /* ","  */
+  YYSYMBOL_IDENTIFIER = 46,                /* "identifier"  */
+  YYSYMBOL_STRING = 47,                    /* "string"  */
+  YYSYMBOL_NATURAL = 48,                   /* "natural"  */
+  YYSYMBOL_REAL = 49,                      /* "real"  */
+  YYSYMBOL_DURATION = 50,                  /* "duration"  */
+  YYSYMBOL_YYACCEPT = 51,                  /* $accept  */
+  YYSYMBOL_instances = 52,                 /* instances  */
+  YYSYMBOL_instance = 53,                  /* instance  */
+  YYSYMBOL_54_1 = 54,                      /* $@1  */
+  YYSYMBOL_solver = 55,                    /* solver  */
+  YYSYMBOL_other_parameters = 56,          /* other_parameters  */
+  YYSYMBOL_file_parameters = 57,           /* file_parameters  */
+  YYSYMBOL_output_and_plot = 58,           /* output_and_plot  */
+  YYSYMBOL_solver_trials = 59,             /* solver_trials  */
+  YYSYMBOL_log_file = 60,                  /* log_file  */
+  YYSYMBOL_output_file_prefix = 61,        /* output_file_prefix  */
+  YYSYMBOL_plot_file_prefix = 62,          /* plot_file_prefix  */
+  YYSYMBOL_solver_kind = 63,               /* solver_kind  */
+  YYSYMBOL_solver_time_limit = 64,         /* solver_time_limit  */
+  YYSYMBOL_initial_state = 65,             /* initial_state  */
+  YYSYMBOL_solver_workers = 66,            /* solver_workers  */
+  YYSYMBOL_solver_processes = 67,          /* solver_processes  */
+  YYSYMBOL_solver_deterministic = 68,      /* solver_deterministic  */
+  YYSYMBOL_runners = 69,                   /* runners  */
+  YYSYMBOL_runner = 70,                    /* runner  */
+  YYSYMBOL_71_2 = 71,                      /* $@2  */
+  YYSYMBOL_72_3 = 72,                      /* $@3  */
+  YYSYMBOL_73_4 = 73,                      /* $@4  */
+  YYSYMBOL_74_5 = 74,                      /* $@5  */
+  YYSYMBOL_75_6 = 75,                      /* $@6  */
+  YYSYMBOL_76_7 = 76,                      /* $@7  */
+  YYSYMBOL_77_8 = 77,                      /* $@8  */
+  YYSYMBOL_78_9 = 78,                      /* $@9  */
+  YYSYMBOL_79_10 = 79,                     /* $@10  */
+  YYSYMBOL_80_11 = 80,                     /* $@11  */
+  YYSYMBOL_81_12 = 81,                     /* $@12  */
+  YYSYMBOL_82_13 = 82,                     /* $@13  */
+  YYSYMBOL_83_14 = 83,                     /* $@14  */
+  YYSYMBOL_84_15 = 84,                     /* $@15  */
+  YYSYMBOL_85_16 = 85,                     /* $@16  */
+  YYSYMBOL_86_17 = 86,                     /* $@17  */
+  YYSYMBOL_87_18 = 87,                     /* $@18  */
+  YYSYMBOL_88_19 = 88,                     /* $@19  */
+  YYSYMBOL_89_20 = 89,                     /* $@20  */
+  YYSYMBOL_90_21 = 90,                     /* $@21  */
+  YYSYMBOL_91_22 = 91,                     /* $@22  */
+  YYSYMBOL_runner_time_limit = 92,         /* runner_time_limit  */
+  YYSYMBOL_hc_parameters = 93,             /* hc_parameters  */
+  YYSYMBOL_ts_parameters = 94,             /* ts_parameters  */
+  YYSYMBOL_ts_diversification = 95,        /* ts_diversification  */
+  YYSYMBOL_sa_parameters = 96,             /* sa_parameters  */
+  YYSYMBOL_la_parameters = 97,             /* la_parameters  */
+  YYSYMBOL_gd_parameters = 98,             /* gd_parameters  */
+  YYSYMBOL_pt_parameters = 99,             /* pt_parameters  */
+  YYSYMBOL_rm_parameters = 100             /* rm_parameters  */
+};
+typedef enum yysymbol_kind_t yysymbol_kind_t;
 
-/* Line 293 of yacc.c  */
-#line 54 "ExpSpec.y"
-
-  std::string* char_string;
-  unsigned long natural;
-  double real;
-  ParameterBox* par_box;
 
 
 
-/* Line 293 of yacc.c  */
-#line 176 "ExpSpec.tab.c"
-} YYSTYPE;
-# define YYSTYPE_IS_TRIVIAL 1
-# define yystype YYSTYPE /* obsolescent; will be withdrawn */
-# define YYSTYPE_IS_DECLARED 1
+#ifdef short
+# undef short
 #endif
 
+/* On compilers that do not define __PTRDIFF_MAX__ etc., make sure
+   <limits.h> and (if available) <stdint.h> are included
+   so that the code can choose integer types of a good width.  */
 
-/* Copy the second part of user declarations.  */
-
+#ifndef __PTRDIFF_MAX__
+# include <limits.h> /* INFRINGES ON USER NAME SPACE */
+# if defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stdint.h> /* INFRINGES ON USER NAME SPACE */
+#  define YY_STDINT_H
+# endif
+#endif
 
-/* Line 343 of yacc.c  */
-#line 188 "ExpSpec.tab.c"
+/* Narrow types that promote to a signed type and that can represent a
+   signed or unsigned integer of at least N bits.  In tables they can
+   save space and decrease cache pressure.  Promoting to a signed type
+   helps avoid bugs in integer arithmetic.  */
 
-#ifdef short
-# undef short
+#ifdef __INT_LEAST8_MAX__
+typedef __INT_LEAST8_TYPE__ yytype_int8;
+#elif defined YY_STDINT_H
+typedef int_least8_t yytype_int8;
+#else
+typedef signed char yytype_int8;
 #endif
 
-#ifdef YYTYPE_UINT8
-typedef YYTYPE_UINT8 yytype_uint8;
+#ifdef __INT_LEAST16_MAX__
+typedef __INT_LEAST16_TYPE__ yytype_int16;
+#elif defined YY_STDINT_H
+typedef int_least16_t yytype_int16;
 #else
-typedef unsigned char yytype_uint8;
+typedef short yytype_int16;
 #endif
 
-#ifdef YYTYPE_INT8
-typedef YYTYPE_INT8 yytype_int8;
-#elif (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-typedef signed char yytype_int8;
-#else
-typedef short int yytype_int8;
+/* Work around bug in HP-UX 11.23, which defines these macros
+   incorrectly for preprocessor constants.  This workaround can likely
+   be removed in 2023, as HPE has promised support for HP-UX 11.23
+   (aka HP-UX 11i v2) only through the end of 2022; see Table 2 of
+   <https://h20195.www2.hpe.com/V2/getpdf.aspx/4AA4-7673ENW.pdf>.  */
+#ifdef __hpux
+# undef UINT_LEAST8_MAX
+# undef UINT_LEAST16_MAX
+# define UINT_LEAST8_MAX 255
+# define UINT_LEAST16_MAX 65535
 #endif
 
-#ifdef YYTYPE_UINT16
-typedef YYTYPE_UINT16 yytype_uint16;
+#if defined __UINT_LEAST8_MAX__ && __UINT_LEAST8_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST8_TYPE__ yytype_uint8;
+#elif (!defined __UINT_LEAST8_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST8_MAX <= INT_MAX)
+typedef uint_least8_t yytype_uint8;
+#elif !defined __UINT_LEAST8_MAX__ && UCHAR_MAX <= INT_MAX
+typedef unsigned char yytype_uint8;
 #else
-typedef unsigned short int yytype_uint16;
+typedef short yytype_uint8;
 #endif
 
-#ifdef YYTYPE_INT16
-typedef YYTYPE_INT16 yytype_int16;
+#if defined __UINT_LEAST16_MAX__ && __UINT_LEAST16_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST16_TYPE__ yytype_uint16;
+#elif (!defined __UINT_LEAST16_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST16_MAX <= INT_MAX)
+typedef uint_least16_t yytype_uint16;
+#elif !defined __UINT_LEAST16_MAX__ && USHRT_MAX <= INT_MAX
+typedef unsigned short yytype_uint16;
 #else
-typedef short int yytype_int16;
+typedef int yytype_uint16;
+#endif
+
+#ifndef YYPTRDIFF_T
+# if defined __PTRDIFF_TYPE__ && defined __PTRDIFF_MAX__
+#  define YYPTRDIFF_T __PTRDIFF_TYPE__
+#  define YYPTRDIFF_MAXIMUM __PTRDIFF_MAX__
+# elif defined PTRDIFF_MAX
+#  ifndef ptrdiff_t
+#   include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  endif
+#  define YYPTRDIFF_T ptrdiff_t
+#  define YYPTRDIFF_MAXIMUM PTRDIFF_MAX
+# else
+#  define YYPTRDIFF_T long
+#  define YYPTRDIFF_MAXIMUM LONG_MAX
+# endif
 #endif
 
 #ifndef YYSIZE_T
@@ -222,55 +328,106 @@ typedef short int yytype_int16;
 #  define YYSIZE_T __SIZE_TYPE__
 # elif defined size_t
 #  define YYSIZE_T size_t
-# elif ! defined YYSIZE_T && (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
+# elif defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
 #  include <stddef.h> /* INFRINGES ON USER NAME SPACE */
 #  define YYSIZE_T size_t
 # else
-#  define YYSIZE_T unsigned int
+#  define YYSIZE_T unsigned
 # endif
 #endif
 
-#define YYSIZE_MAXIMUM ((YYSIZE_T) -1)
+#define YYSIZE_MAXIMUM                                  \
+  YY_CAST (YYPTRDIFF_T,                                 \
+           (YYPTRDIFF_MAXIMUM < YY_CAST (YYSIZE_T, -1)  \
+            ? YYPTRDIFF_MAXIMUM                         \
+            : YY_CAST (YYSIZE_T, -1)))
+
+#define YYSIZEOF(X) YY_CAST (YYPTRDIFF_T, sizeof (X))
+
+
+/* Stored state numbers (used for stacks). */
+typedef yytype_uint8 yy_state_t;
+
+/* State numbers in computations.  */
+typedef int yy_state_fast_t;
 
 #ifndef YY_
 # if defined YYENABLE_NLS && YYENABLE_NLS
 #  if ENABLE_NLS
 #   include <libintl.h> /* INFRINGES ON USER NAME SPACE */
-#   define YY_(msgid) dgettext ("bison-runtime", msgid)
+#   define YY_(Msgid) dgettext ("bison-runtime", Msgid)
 #  endif
 # endif
 # ifndef YY_
-#  define YY_(msgid) msgid
+#  define YY_(Msgid) Msgid
+# endif
+#endif
+
+
+#ifndef YY_ATTRIBUTE_PURE
+# if defined __GNUC__ && 2 < __GNUC__ + (96 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_PURE __attribute__ ((__pure__))
+# else
+#  define YY_ATTRIBUTE_PURE
+# endif
+#endif
+
+#ifndef YY_ATTRIBUTE_UNUSED
+# if defined __GNUC__ && 2 < __GNUC__ + (7 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_UNUSED __attribute__ ((__unused__))
+# else
+#  define YY_ATTRIBUTE_UNUSED
 # endif
 #endif
 
 /* Suppress unused-variable warnings by "using" E.  */
 #if ! defined lint || defined __GNUC__
-# define YYUSE(e) ((void) (e))
+# define YY_USE(E) ((void) (E))
 #else
-# define YYUSE(e) /* empty */
+# define YY_USE(E) /* empty */
 #endif
 
-/* Identity function, used to suppress warnings about constant conditions.  */
-#ifndef lint
-# define YYID(n) (n)
-#else
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static int
-YYID (int yyi)
+/* Suppress an incorrect diagnostic about yylval being uninitialized.  */
+#if defined __GNUC__ && ! defined __ICC && 406 <= __GNUC__ * 100 + __GNUC_MINOR__
+# if __GNUC__ * 100 + __GNUC_MINOR__ < 407
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")
+# else
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")              \
+    _Pragma ("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
+# endif
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END      \
+    _Pragma ("GCC diagnostic pop")
 #else
-static int
-YYID (yyi)
-    int yyi;
+# define YY_INITIAL_VALUE(Value) Value
 #endif
-{
-  return yyi;
-}
+#ifndef YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END
+#endif
+#ifndef YY_INITIAL_VALUE
+# define YY_INITIAL_VALUE(Value) /* Nothing. */
+#endif
+
+#if defined __cplusplus && defined __GNUC__ && ! defined __ICC && 6 <= __GNUC__
+# define YY_IGNORE_USELESS_CAST_BEGIN                          \
+    _Pragma ("GCC diagnostic push")                            \
+    _Pragma ("GCC diagnostic ignored \"-Wuseless-cast\"")
+# define YY_IGNORE_USELESS_CAST_END            \
+    _Pragma ("GCC diagnostic pop")
 #endif
+#ifndef YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_END
+#endif
+
 
-#if ! defined yyoverflow || YYERROR_VERBOSE
+#define YY_ASSERT(E) ((void) (0 && (E)))
+
+#if !defined yyoverflow
 
 /* The parser invokes alloca or malloc; define the necessary symbols.  */
 
@@ -287,9 +444,9 @@ YYID (yyi)
 #    define alloca _alloca
 #   else
 #    define YYSTACK_ALLOC alloca
-#    if ! defined _ALLOCA_H && ! defined EXIT_SUCCESS && (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
+#    if ! defined _ALLOCA_H && ! defined EXIT_SUCCESS
 #     include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
+      /* Use EXIT_SUCCESS as a witness for stdlib.h.  */
 #     ifndef EXIT_SUCCESS
 #      define EXIT_SUCCESS 0
 #     endif
@@ -299,8 +456,8 @@ YYID (yyi)
 # endif
 
 # ifdef YYSTACK_ALLOC
-   /* Pacify GCC's `empty if-body' warning.  */
-#  define YYSTACK_FREE(Ptr) do { /* empty */; } while (YYID (0))
+   /* Pacify GCC's 'empty if-body' warning.  */
+#  define YYSTACK_FREE(Ptr) do { /* empty */; } while (0)
 #  ifndef YYSTACK_ALLOC_MAXIMUM
     /* The OS might guarantee only one guard page at the bottom of the stack,
        and a page size can be as small as 4096 bytes.  So we cannot safely
@@ -316,7 +473,7 @@ YYID (yyi)
 #  endif
 #  if (defined __cplusplus && ! defined EXIT_SUCCESS \
        && ! ((defined YYMALLOC || defined malloc) \
-	     && (defined YYFREE || defined free)))
+             && (defined YYFREE || defined free)))
 #   include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
 #   ifndef EXIT_SUCCESS
 #    define EXIT_SUCCESS 0
@@ -324,40 +481,37 @@ YYID (yyi)
 #  endif
 #  ifndef YYMALLOC
 #   define YYMALLOC malloc
-#   if ! defined malloc && ! defined EXIT_SUCCESS && (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
+#   if ! defined malloc && ! defined EXIT_SUCCESS
 void *malloc (YYSIZE_T); /* INFRINGES ON USER NAME SPACE */
 #   endif
 #  endif
 #  ifndef YYFREE
 #   define YYFREE free
-#   if ! defined free && ! defined EXIT_SUCCESS && (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
+#   if ! defined free && ! defined EXIT_SUCCESS
 void free (void *); /* INFRINGES ON USER NAME SPACE */
 #   endif
 #  endif
 # endif
-#endif /* ! defined yyoverflow || YYERROR_VERBOSE */
-
+#endif /* !defined yyoverflow */
 
 #if (! defined yyoverflow \
      && (! defined __cplusplus \
-	 || (defined YYSTYPE_IS_TRIVIAL && YYSTYPE_IS_TRIVIAL)))
+         || (defined YYSTYPE_IS_TRIVIAL && YYSTYPE_IS_TRIVIAL)))
 
 /* A type that is properly aligned for any stack member.  */
 union yyalloc
 {
-  yytype_int16 yyss_alloc;
+  yy_state_t yyss_alloc;
   YYSTYPE yyvs_alloc;
 };
 
 /* The size of the maximum gap between one aligned stack and the next.  */
-# define YYSTACK_GAP_MAXIMUM (sizeof (union yyalloc) - 1)
+# define YYSTACK_GAP_MAXIMUM (YYSIZEOF (union yyalloc) - 1)
 
 /* The size of an array large to enough to hold all stacks, each with
    N elements.  */
 # define YYSTACK_BYTES(N) \
-     ((N) * (sizeof (yytype_int16) + sizeof (YYSTYPE)) \
+     ((N) * (YYSIZEOF (yy_state_t) + YYSIZEOF (YYSTYPE)) \
       + YYSTACK_GAP_MAXIMUM)
 
 # define YYCOPY_NEEDED 1
@@ -367,35 +521,35 @@ union yyalloc
    elements in the stack, and YYPTR gives the new location of the
    stack.  Advance YYPTR to a properly aligned location for the next
    stack.  */
-# define YYSTACK_RELOCATE(Stack_alloc, Stack)				\
-    do									\
-      {									\
-	YYSIZE_T yynewbytes;						\
-	YYCOPY (&yyptr->Stack_alloc, Stack, yysize);			\
-	Stack = &yyptr->Stack_alloc;					\
-	yynewbytes = yystacksize * sizeof (*Stack) + YYSTACK_GAP_MAXIMUM; \
-	yyptr += yynewbytes / sizeof (*yyptr);				\
-      }									\
-    while (YYID (0))
+# define YYSTACK_RELOCATE(Stack_alloc, Stack)                           \
+    do                                                                  \
+      {                                                                 \
+        YYPTRDIFF_T yynewbytes;                                         \
+        YYCOPY (&yyptr->Stack_alloc, Stack, yysize);                    \
+        Stack = &yyptr->Stack_alloc;                                    \
+        yynewbytes = yystacksize * YYSIZEOF (*Stack) + YYSTACK_GAP_MAXIMUM; \
+        yyptr += yynewbytes / YYSIZEOF (*yyptr);                        \
+      }                                                                 \
+    while (0)
 
 #endif
 
 #if defined YYCOPY_NEEDED && YYCOPY_NEEDED
-/* Copy COUNT objects from FROM to TO.  The source and destination do
+/* Copy COUNT objects from SRC to DST.  The source and destination do
    not overlap.  */
 # ifndef YYCOPY
 #  if defined __GNUC__ && 1 < __GNUC__
-#   define YYCOPY(To, From, Count) \
-      __builtin_memcpy (To, From, (Count) * sizeof (*(From)))
+#   define YYCOPY(Dst, Src, Count) \
+      __builtin_memcpy (Dst, Src, YY_CAST (YYSIZE_T, (Count)) * sizeof (*(Src)))
 #  else
-#   define YYCOPY(To, From, Count)		\
-      do					\
-	{					\
-	  YYSIZE_T yyi;				\
-	  for (yyi = 0; yyi < (Count); yyi++)	\
-	    (To)[yyi] = (From)[yyi];		\
-	}					\
-      while (YYID (0))
+#   define YYCOPY(Dst, Src, Count)              \
+      do                                        \
+        {                                       \
+          YYPTRDIFF_T yyi;                      \
+          for (yyi = 0; yyi < (Count); yyi++)   \
+            (Dst)[yyi] = (Src)[yyi];            \
+        }                                       \
+      while (0)
 #  endif
 # endif
 #endif /* !YYCOPY_NEEDED */
@@ -403,26 +557,31 @@ union yyalloc
 /* YYFINAL -- State number of the termination state.  */
 #define YYFINAL  5
 /* YYLAST -- Last index in YYTABLE.  */
-#define YYLAST   83
+#define YYLAST   182
 
 /* YYNTOKENS -- Number of terminals.  */
-#define YYNTOKENS  26
+#define YYNTOKENS  51
 /* YYNNTS -- Number of nonterminals.  */
-#define YYNNTS  23
+#define YYNNTS  50
 /* YYNRULES -- Number of rules.  */
-#define YYNRULES  37
-/* YYNRULES -- Number of states.  */
-#define YYNSTATES  91
+#define YYNRULES  81
+/* YYNSTATES -- Number of states.  */
+#define YYNSTATES  212
 
-/* YYTRANSLATE(YYLEX) -- Bison symbol number corresponding to YYLEX.  */
-#define YYUNDEFTOK  2
-#define YYMAXUTOK   280
+/* YYMAXUTOK -- Last valid token kind.  */
+#define YYMAXUTOK   305
 
-#define YYTRANSLATE(YYX)						\
-  ((unsigned int) (YYX) <= YYMAXUTOK ? yytranslate[YYX] : YYUNDEFTOK)
 
-/* YYTRANSLATE[YYLEX] -- Bison symbol number corresponding to YYLEX.  */
-static const yytype_uint8 yytranslate[] =
+/* YYTRANSLATE(TOKEN-NUM) -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex, with out-of-bounds checking.  */
+#define YYTRANSLATE(YYX)                                \
+  (0 <= (YYX) && (YYX) <= YYMAXUTOK                     \
+   ? YY_CAST (yysymbol_kind_t, yytranslate[YYX])        \
+   : YYSYMBOL_YYUNDEF)
+
+/* YYTRANSLATE[TOKEN-NUM] -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex.  */
+static const yytype_int8 yytranslate[] =
 {
        0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
@@ -452,289 +611,299 @@ static const yytype_uint8 yytranslate[] =
        2,     2,     2,     2,     2,     2,     1,     2,     3,     4,
        5,     6,     7,     8,     9,    10,    11,    12,    13,    14,
       15,    16,    17,    18,    19,    20,    21,    22,    23,    24,
-      25
+      25,    26,    27,    28,    29,    30,    31,    32,    33,    34,
+      35,    36,    37,    38,    39,    40,    41,    42,    43,    44,
+      45,    46,    47,    48,    49,    50
 };
 
 #if YYDEBUG
-/* YYPRHS[YYN] -- Index of the first RHS symbol of rule number YYN in
-   YYRHS.  */
-static const yytype_uint8 yyprhs[] =
-{
-       0,     0,     3,     4,     7,     8,    13,    18,    21,    24,
-      27,    30,    33,    36,    37,    41,    42,    46,    47,    51,
-      52,    56,    58,    61,    62,    63,    72,    73,    74,    83,
-      84,    85,    94,    98,   105,   115,   128,   138
-};
-
-/* YYRHS -- A `-1'-separated list of the rules' RHS.  */
-static const yytype_int8 yyrhs[] =
-{
-      27,     0,    -1,    -1,    28,    27,    -1,    -1,     3,    23,
-      29,    30,    -1,    19,    31,    38,    20,    -1,    34,    32,
-      -1,    32,    34,    -1,    35,    33,    -1,    33,    35,    -1,
-      36,    37,    -1,    37,    36,    -1,    -1,     7,    24,    21,
-      -1,    -1,     5,    23,    21,    -1,    -1,     4,    23,    21,
-      -1,    -1,     6,    23,    21,    -1,    39,    -1,    39,    38,
-      -1,    -1,    -1,     8,    10,    23,    40,    19,    46,    41,
-      20,    -1,    -1,    -1,     8,     9,    23,    42,    19,    47,
-      43,    20,    -1,    -1,    -1,     8,    11,    23,    44,    19,
-      48,    45,    20,    -1,    13,    24,    21,    -1,    13,    24,
-      21,    12,    24,    21,    -1,    14,    24,    21,    15,    24,
-      21,    13,    24,    21,    -1,    14,    24,    21,    15,    24,
-      21,    13,    24,    21,    12,    24,    21,    -1,    16,    25,
-      21,    17,    25,    21,    18,    24,    21,    -1,    16,    25,
-      21,    17,    25,    21,    18,    24,    21,    12,    24,    21,
-      -1
-};
-
-/* YYRLINE[YYN] -- source line where rule number YYN was defined.  */
-static const yytype_uint16 yyrline[] =
+/* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
+static const yytype_int16 yyrline[] =
 {
-       0,    95,    95,    97,   103,   102,   112,   121,   121,   123,
-     123,   125,   126,   129,   132,   139,   140,   147,   148,   156,
-     157,   165,   166,   170,   190,   169,   195,   215,   194,   220,
-     240,   219,   246,   252,   261,   271,   284,   294
+       0,   126,   126,   128,   134,   133,   143,   158,   158,   160,
+     160,   162,   163,   166,   169,   176,   177,   184,   185,   193,
+     194,   203,   206,   221,   224,   231,   234,   238,   245,   248,
+     255,   258,   265,   268,   272,   278,   279,   283,   303,   307,
+     282,   312,   332,   336,   311,   341,   361,   365,   340,   370,
+     390,   394,   369,   399,   419,   423,   398,   428,   448,   452,
+     427,   457,   477,   481,   456,   488,   491,   497,   503,   512,
+     524,   542,   545,   551,   561,   574,   582,   593,   603,   615,
+     629,   646
 };
 #endif
 
-#if YYDEBUG || YYERROR_VERBOSE || YYTOKEN_TABLE
+/** Accessing symbol of state STATE.  */
+#define YY_ACCESSING_SYMBOL(State) YY_CAST (yysymbol_kind_t, yystos[State])
+
+#if YYDEBUG || 0
+/* The user-facing name of the symbol whose (internal) number is
+   YYSYMBOL.  No bounds checking.  */
+static const char *yysymbol_name (yysymbol_kind_t yysymbol) YY_ATTRIBUTE_UNUSED;
+
 /* YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
    First, the terminals, then, starting at YYNTOKENS, nonterminals.  */
 static const char *const yytname[] =
 {
-  "$end", "error", "$undefined", "\"Instance\"", "\"Output prefix\"",
-  "\"Log file\"", "\"Plot prefix\"", "\"Trials\"", "\"Runner\"",
-  "\"tabu search\"", "\"hill climbing\"", "\"simulated annealing\"",
-  "\"max iteration\"", "\"max idle iteration\"", "\"min tabu tenure\"",
-  "\"max tabu tenure\"", "\"start temperature\"", "\"cooling rate\"",
-  "\"neighbors sampled\"", "\"{\"", "\"}\"", "\";\"", "\"identifier\"",
-  "\"string\"", "\"natural\"", "\"real\"", "$accept", "instances",
-  "instance", "$@1", "solver", "other_parameters", "file_parameters",
-  "output_and_plot", "solver_trials", "log_file", "output_file_prefix",
-  "plot_file_prefix", "runners", "runner", "$@2", "$@3", "$@4", "$@5",
-  "$@6", "$@7", "hc_parameters", "ts_parameters", "sa_parameters", 0
+  "\"end of file\"", "error", "\"invalid token\"", "\"Instance\"",
+  "\"Output prefix\"", "\"Log file\"", "\"Plot prefix\"", "\"Trials\"",
+  "\"Runner\"", "\"tabu search\"", "\"hill climbing\"",
+  "\"simulated annealing\"", "\"max iteration\"", "\"max idle iteration\"",
+  "\"min tabu tenure\"", "\"max tabu tenure\"", "\"diversification\"",
+  "\"start temperature\"", "\"cooling rate\"", "\"neighbors sampled\"",
+  "\"late acceptance\"", "\"history length\"", "\"great deluge\"",
+  "\"level factor\"", "\"final level\"", "\"time budget\"",
+  "\"parallel tempering\"", "\"replicas\"", "\"min temperature\"",
+  "\"max temperature\"", "\"exchange interval\"", "\"room matching\"",
+  "\"threads\"", "\"Time limit\"", "\"Initial state\"", "\"Workers\"",
+  "\"Processes\"", "\"Solver\"", "\"Deterministic\"", "\"random\"",
+  "\"greedy\"", "\"time limit\"", "\"{\"", "\"}\"", "\";\"", "\",\"",
+  "\"identifier\"", "\"string\"", "\"natural\"", "\"real\"",
+  "\"duration\"", "$accept", "instances", "instance", "$@1", "solver",
+  "other_parameters", "file_parameters", "output_and_plot",
+  "solver_trials", "log_file", "output_file_prefix", "plot_file_prefix",
+  "solver_kind", "solver_time_limit", "initial_state", "solver_workers",
+  "solver_processes", "solver_deterministic", "runners", "runner", "$@2",
+  "$@3", "$@4", "$@5", "$@6", "$@7", "$@8", "$@9", "$@10", "$@11", "$@12",
+  "$@13", "$@14", "$@15", "$@16", "$@17", "$@18", "$@19", "$@20", "$@21",
+  "$@22", "runner_time_limit", "hc_parameters", "ts_parameters",
+  "ts_diversification", "sa_parameters", "la_parameters", "gd_parameters",
+  "pt_parameters", "rm_parameters", YY_NULLPTR
 };
-#endif
 
-# ifdef YYPRINT
-/* YYTOKNUM[YYLEX-NUM] -- Internal token number corresponding to
-   token YYLEX-NUM.  */
-static const yytype_uint16 yytoknum[] =
+static const char *
+yysymbol_name (yysymbol_kind_t yysymbol)
 {
-       0,   256,   257,   258,   259,   260,   261,   262,   263,   264,
-     265,   266,   267,   268,   269,   270,   271,   272,   273,   274,
-     275,   276,   277,   278,   279,   280
-};
-# endif
+  return yytname[yysymbol];
+}
+#endif
 
-/* YYR1[YYN] -- Symbol number of symbol that rule YYN derives.  */
-static const yytype_uint8 yyr1[] =
-{
-       0,    26,    27,    27,    29,    28,    30,    31,    31,    32,
-      32,    33,    33,    34,    34,    35,    35,    36,    36,    37,
-      37,    38,    38,    40,    41,    39,    42,    43,    39,    44,
-      45,    39,    46,    46,    47,    47,    48,    48
-};
+#define YYPACT_NINF (-129)
+
+#define yypact_value_is_default(Yyn) \
+  ((Yyn) == YYPACT_NINF)
+
+#define YYTABLE_NINF (-1)
 
-/* YYR2[YYN] -- Number of symbols composing right hand side of rule YYN.  */
-static const yytype_uint8 yyr2[] =
+#define yytable_value_is_error(Yyn) \
+  0
+
+/* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
+   STATE-NUM.  */
+static const yytype_int16 yypact[] =
 {
-       0,     2,     0,     2,     0,     4,     4,     2,     2,     2,
-       2,     2,     2,     0,     3,     0,     3,     0,     3,     0,
-       3,     1,     2,     0,     0,     8,     0,     0,     8,     0,
-       0,     8,     3,     6,     9,    12,     9,    12
+       0,   -40,     9,     0,  -129,  -129,  -129,   -26,    -6,  -129,
+     -12,     4,    -8,   -10,     5,  -129,    -3,   -19,     7,  -129,
+      -1,     1,    -4,     2,  -129,  -129,     6,    -2,    10,  -129,
+       8,    11,    19,  -129,   -11,    13,    14,    15,    16,    39,
+      42,    46,    23,    26,    47,    50,  -129,    17,    12,    22,
+      24,    25,    -9,    20,    39,  -129,  -129,  -129,  -129,  -129,
+    -129,    27,  -129,  -129,  -129,  -129,    28,    29,    30,    31,
+      32,    33,    34,  -129,  -129,  -129,  -129,  -129,  -129,  -129,
+    -129,  -129,  -129,    40,    41,    43,    44,    45,    48,    49,
+      53,    57,    38,    36,    35,    61,    52,    51,  -129,    54,
+    -129,    55,  -129,    58,  -129,    56,  -129,    59,  -129,    60,
+    -129,    65,    62,    66,    62,    67,    62,    68,    62,    69,
+      62,    70,    62,    71,    62,    74,    72,  -129,    80,  -129,
+      75,  -129,    81,  -129,    73,  -129,    88,  -129,  -129,  -129,
+      76,    77,    82,    78,    84,    79,    86,    83,    87,    85,
+      89,    90,    92,    93,    94,  -129,  -129,    96,  -129,    97,
+    -129,    98,  -129,    99,  -129,   100,  -129,  -129,   104,  -129,
+     101,   106,    -7,   108,   102,   103,   105,   107,    95,   109,
+     110,   112,   113,   115,   116,   117,     3,   111,  -129,  -129,
+    -129,   118,   114,   119,  -129,   120,   121,   122,   126,   127,
+     128,   130,  -129,  -129,   134,  -129,   125,   131,   137,   129,
+     132,  -129
 };
 
-/* YYDEFACT[STATE-NAME] -- Default reduction number in state STATE-NUM.
-   Performed when YYTABLE doesn't specify something else to do.  Zero
+/* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
+   Performed when YYTABLE does not specify something else to do.  Zero
    means the default is an error.  */
-static const yytype_uint8 yydefact[] =
-{
-       2,     0,     0,     2,     4,     1,     3,     0,    13,     5,
-       0,     0,     0,     0,     0,    13,    15,    15,    17,    19,
-      17,     0,     0,     0,     0,     0,     0,    21,     8,    10,
-       7,     9,    11,    12,    18,    16,    20,    14,     0,     0,
-       0,     6,    22,    26,    23,    29,     0,     0,     0,     0,
-       0,     0,     0,    27,     0,    24,     0,    30,     0,     0,
-       0,     0,     0,     0,     0,    28,    32,    25,     0,    31,
-       0,     0,     0,     0,     0,     0,     0,    33,     0,     0,
-       0,     0,     0,    34,    36,     0,     0,     0,     0,    35,
-      37
-};
-
-/* YYDEFGOTO[NTERM-NUM].  */
-static const yytype_int8 yydefgoto[] =
+static const yytype_int8 yydefact[] =
 {
-      -1,     2,     3,     7,     9,    14,    15,    16,    17,    18,
-      19,    20,    26,    27,    47,    61,    46,    59,    48,    63,
-      55,    53,    57
+       2,     0,     0,     2,     4,     1,     3,     0,    21,     5,
+       0,    23,     0,     0,    25,    22,     0,     0,    28,    24,
+       0,     0,     0,    30,    26,    27,     0,     0,    32,    29,
+       0,     0,    13,    31,     0,     0,     0,     0,     0,    35,
+      13,    15,    15,    17,    19,    17,    33,     0,     0,     0,
+       0,     0,     0,     0,    35,     8,    10,     7,     9,    11,
+      12,     0,    18,    16,    20,    14,     0,     0,     0,     0,
+       0,     0,     0,     6,    36,    34,    41,    37,    45,    49,
+      53,    57,    61,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,    42,     0,
+      38,     0,    46,     0,    50,     0,    54,     0,    58,     0,
+      62,     0,    65,     0,    65,     0,    65,     0,    65,     0,
+      65,     0,    65,     0,    65,     0,     0,    43,    67,    39,
+       0,    47,     0,    51,     0,    55,     0,    59,    81,    63,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,    66,    44,     0,    40,     0,
+      48,     0,    52,     0,    56,     0,    60,    64,     0,    68,
+       0,    75,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,    71,    73,    76,    78,
+      77,     0,     0,     0,    69,     0,     0,     0,     0,     0,
+       0,    71,    72,    74,     0,    70,     0,     0,    79,     0,
+       0,    80
 };
 
-/* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
-   STATE-NUM.  */
-#define YYPACT_NINF -11
-static const yytype_int8 yypact[] =
-{
-       8,   -10,    14,     8,   -11,   -11,   -11,    -3,    -4,   -11,
-      -8,    -6,    -5,    -1,    11,    13,    16,     0,     6,    18,
-      21,     1,     5,     7,     9,    -2,    12,    11,   -11,   -11,
-     -11,   -11,   -11,   -11,   -11,   -11,   -11,   -11,     4,    10,
-      15,   -11,   -11,   -11,   -11,   -11,    17,    20,    22,    23,
-      27,    19,    24,   -11,    25,   -11,    26,   -11,    29,    32,
-      33,    35,    36,    38,    28,   -11,    30,   -11,    39,   -11,
-      37,    40,    34,    41,    42,    44,    31,   -11,    48,    43,
-      45,    47,    49,    59,    60,    50,    51,    52,    55,   -11,
-     -11
+/* YYPGOTO[NTERM-NUM].  */
+static const yytype_int16 yypgoto[] =
+{
+    -129,   149,  -129,  -129,  -129,  -129,    91,   135,   123,   124,
+     136,   138,  -129,  -129,  -129,  -129,  -129,  -129,    18,  -129,
+    -129,  -129,  -129,  -129,  -129,  -129,  -129,  -129,  -129,  -129,
+    -129,  -129,  -129,  -129,  -129,  -129,  -129,  -129,  -129,  -129,
+    -129,  -110,  -129,  -129,  -128,  -129,  -129,  -129,  -129,  -129
 };
 
-/* YYPGOTO[NTERM-NUM].  */
-static const yytype_int8 yypgoto[] =
+/* YYDEFGOTO[NTERM-NUM].  */
+static const yytype_uint8 yydefgoto[] =
 {
-     -11,    57,   -11,   -11,   -11,   -11,    61,    62,    64,    65,
-      63,    58,     2,   -11,   -11,   -11,   -11,   -11,   -11,   -11,
-     -11,   -11,   -11
+       0,     2,     3,     7,     9,    39,    40,    41,    42,    43,
+      44,    45,    11,    14,    18,    23,    28,    32,    53,    54,
+      84,   114,   144,    83,   112,   142,    85,   116,   146,    86,
+     118,   148,    87,   120,   150,    88,   122,   152,    89,   124,
+     153,   127,   100,    98,   194,   102,   104,   106,   108,   110
 };
 
-/* YYTABLE[YYPACT[STATE-NUM]].  What to do in state STATE-NUM.  If
-   positive, shift that token.  If negative, reduce the rule which
+/* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
+   positive, shift that token.  If negative, reduce the rule whose
    number is the opposite.  If YYTABLE_NINF, syntax error.  */
-#define YYTABLE_NINF -1
 static const yytype_uint8 yytable[] =
 {
-      10,    11,    12,    13,    10,    11,    12,    38,    39,    40,
-      10,     1,    12,     4,     5,    21,     8,    22,    23,    25,
-      13,    11,    34,    24,    12,    10,    35,    43,    36,    42,
-      37,     0,    41,    44,     0,    56,    49,    52,    45,    50,
-      54,    51,    71,    70,    79,     0,     0,     0,    58,    60,
-      64,    62,    65,     0,    66,    67,    72,    68,    69,    75,
-       6,    73,    76,    77,    74,    78,    80,    81,    83,    82,
-      84,    85,    86,    89,    87,    88,    90,    32,    30,    28,
-      31,    29,     0,    33
+      66,    67,    68,     1,   129,   177,   131,     4,   133,     5,
+     135,    69,   137,    70,   139,   192,     8,    71,   178,   193,
+      20,    21,    72,    35,    36,    37,    38,    35,    36,    37,
+      35,    10,    37,    46,    47,    12,    15,    13,    27,    17,
+      16,    19,    22,    24,    26,    25,    30,    52,    31,    38,
+      29,    36,    33,    37,    35,   101,    62,   103,   105,    34,
+      48,    49,    50,    73,    51,    61,    63,    97,    64,    65,
+      99,    75,    74,   205,     0,    76,    77,    78,    79,    80,
+      81,    82,    90,    91,   109,    92,    93,    94,   107,   140,
+      95,    96,   143,   145,   147,     0,     0,   149,     0,   111,
+       0,     0,   113,   126,   115,   119,   117,   121,   123,   125,
+     128,   130,   132,   134,   136,   138,   151,   174,   176,     0,
+     175,   155,   141,   195,   154,   156,   157,   158,   159,   160,
+     162,   161,   164,    57,   163,   166,   167,   179,   168,   165,
+     169,   170,   171,   172,   173,   184,   193,   206,   196,   209,
+     180,   181,     6,   182,   186,   183,   187,   188,   185,   189,
+     190,   191,   197,    55,     0,    56,   201,   198,   199,   200,
+     202,   203,   204,   207,     0,   208,   211,   210,    58,     0,
+       0,    60,    59
 };
 
-#define yypact_value_is_default(yystate) \
-  ((yystate) == (-11))
-
-#define yytable_value_is_error(yytable_value) \
-  YYID (0)
+static const yytype_int16 yycheck[] =
+{
+       9,    10,    11,     3,   114,    12,   116,    47,   118,     0,
+     120,    20,   122,    22,   124,    12,    42,    26,    25,    16,
+      39,    40,    31,     4,     5,     6,     7,     4,     5,     6,
+       4,    37,     6,    44,    45,    47,    44,    33,    36,    34,
+      50,    44,    35,    44,    48,    44,    48,     8,    38,     7,
+      44,     5,    44,     6,     4,    17,    44,    21,    23,    48,
+      47,    47,    47,    43,    48,    48,    44,    14,    44,    44,
+      13,    44,    54,   201,    -1,    47,    47,    47,    47,    47,
+      47,    47,    42,    42,    32,    42,    42,    42,    27,    15,
+      42,    42,    12,    18,    13,    -1,    -1,    24,    -1,    48,
+      -1,    -1,    48,    41,    49,    49,    48,    48,    48,    44,
+      44,    44,    44,    44,    44,    44,    28,    13,    12,    -1,
+      19,    44,    50,    12,    48,    43,    48,    43,    49,    43,
+      43,    48,    43,    42,    49,    43,    43,    29,    44,    49,
+      44,    44,    44,    44,    44,    50,    16,    13,    30,    12,
+      48,    48,     3,    48,    44,    48,    44,    44,    49,    44,
+      44,    44,    48,    40,    -1,    41,    44,    48,    48,    48,
+      44,    44,    44,    48,    -1,    44,    44,    48,    43,    -1,
+      -1,    45,    44
+};
 
-static const yytype_int8 yycheck[] =
+/* YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
+   state STATE-NUM.  */
+static const yytype_int8 yystos[] =
 {
-       4,     5,     6,     7,     4,     5,     6,     9,    10,    11,
-       4,     3,     6,    23,     0,    23,    19,    23,    23,     8,
-       7,     5,    21,    24,     6,     4,    21,    23,    21,    27,
-      21,    -1,    20,    23,    -1,    16,    19,    14,    23,    19,
-      13,    19,    12,    15,    13,    -1,    -1,    -1,    24,    24,
-      21,    25,    20,    -1,    21,    20,    17,    21,    20,    25,
-       3,    24,    21,    21,    24,    21,    18,    24,    21,    24,
-      21,    12,    12,    21,    24,    24,    21,    19,    17,    15,
-      18,    16,    -1,    20
+       0,     3,    52,    53,    47,     0,    52,    54,    42,    55,
+      37,    63,    47,    33,    64,    44,    50,    34,    65,    44,
+      39,    40,    35,    66,    44,    44,    48,    36,    67,    44,
+      48,    38,    68,    44,    48,     4,     5,     6,     7,    56,
+      57,    58,    59,    60,    61,    62,    44,    45,    47,    47,
+      47,    48,     8,    69,    70,    59,    60,    57,    58,    62,
+      61,    48,    44,    44,    44,    44,     9,    10,    11,    20,
+      22,    26,    31,    43,    69,    44,    47,    47,    47,    47,
+      47,    47,    47,    74,    71,    77,    80,    83,    86,    89,
+      42,    42,    42,    42,    42,    42,    42,    14,    94,    13,
+      93,    17,    96,    21,    97,    23,    98,    27,    99,    32,
+     100,    48,    75,    48,    72,    49,    78,    48,    81,    49,
+      84,    48,    87,    48,    90,    44,    41,    92,    44,    92,
+      44,    92,    44,    92,    44,    92,    44,    92,    44,    92,
+      15,    50,    76,    12,    73,    18,    79,    13,    82,    24,
+      85,    28,    88,    91,    48,    44,    43,    48,    43,    49,
+      43,    48,    43,    49,    43,    49,    43,    43,    44,    44,
+      44,    44,    44,    44,    13,    19,    12,    12,    25,    29,
+      48,    48,    48,    48,    50,    49,    44,    44,    44,    44,
+      44,    44,    12,    16,    95,    12,    30,    48,    48,    48,
+      48,    44,    44,    44,    44,    95,    13,    48,    44,    12,
+      48,    44
 };
 
-/* YYSTOS[STATE-NUM] -- The (internal number of the) accessing
-   symbol of state STATE-NUM.  */
-static const yytype_uint8 yystos[] =
-{
-       0,     3,    27,    28,    23,     0,    27,    29,    19,    30,
-       4,     5,     6,     7,    31,    32,    33,    34,    35,    36,
-      37,    23,    23,    23,    24,     8,    38,    39,    34,    35,
-      32,    33,    37,    36,    21,    21,    21,    21,     9,    10,
-      11,    20,    38,    23,    23,    23,    42,    40,    44,    19,
-      19,    19,    14,    47,    13,    46,    16,    48,    24,    43,
-      24,    41,    25,    45,    21,    20,    21,    20,    21,    20,
-      15,    12,    17,    24,    24,    25,    21,    21,    21,    13,
-      18,    24,    24,    21,    21,    12,    12,    24,    24,    21,
-      21
+/* YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.  */
+static const yytype_int8 yyr1[] =
+{
+       0,    51,    52,    52,    54,    53,    55,    56,    56,    57,
+      57,    58,    58,    59,    59,    60,    60,    61,    61,    62,
+      62,    63,    63,    64,    64,    65,    65,    65,    66,    66,
+      67,    67,    68,    68,    68,    69,    69,    71,    72,    73,
+      70,    74,    75,    76,    70,    77,    78,    79,    70,    80,
+      81,    82,    70,    83,    84,    85,    70,    86,    87,    88,
+      70,    89,    90,    91,    70,    92,    92,    93,    93,    94,
+      94,    95,    95,    96,    96,    97,    97,    98,    98,    99,
+      99,   100
 };
 
-#define yyerrok		(yyerrstatus = 0)
-#define yyclearin	(yychar = YYEMPTY)
-#define YYEMPTY		(-2)
-#define YYEOF		0
-
-#define YYACCEPT	goto yyacceptlab
-#define YYABORT		goto yyabortlab
-#define YYERROR		goto yyerrorlab
-
-
-/* Like YYERROR except do call yyerror.  This remains here temporarily
-   to ease the transition to the new meaning of YYERROR, for GCC.
-   Once GCC version 2 has supplanted version 1, this can go.  However,
-   YYFAIL appears to be in use.  Nevertheless, it is formally deprecated
-   in Bison 2.4.2's NEWS entry, where a plan to phase it out is
-   discussed.  */
-
-#define YYFAIL		goto yyerrlab
-#if defined YYFAIL
-  /* This is here to suppress warnings from the GCC cpp's
-     -Wunused-macros.  Normally we don't worry about that warning, but
-     some users do, and we want to make it easy for users to remove
-     YYFAIL uses, which will produce warnings from Bison 2.5.  */
-#endif
+/* YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.  */
+static const yytype_int8 yyr2[] =
+{
+       0,     2,     0,     2,     0,     4,    10,     2,     2,     2,
+       2,     2,     2,     0,     3,     0,     3,     0,     3,     0,
+       3,     0,     3,     0,     3,     0,     3,     3,     0,     3,
+       0,     3,     0,     3,     5,     0,     2,     0,     0,     0,
+      10,     0,     0,     0,    10,     0,     0,     0,    10,     0,
+       0,     0,    10,     0,     0,     0,    10,     0,     0,     0,
+      10,     0,     0,     0,    10,     0,     3,     3,     6,    10,
+      13,     0,     3,     9,    12,     6,     9,     9,     9,    15,
+      18,     3
+};
 
-#define YYRECOVERING()  (!!yyerrstatus)
 
-#define YYBACKUP(Token, Value)					\
-do								\
-  if (yychar == YYEMPTY && yylen == 1)				\
-    {								\
-      yychar = (Token);						\
-      yylval = (Value);						\
-      YYPOPSTACK (1);						\
-      goto yybackup;						\
-    }								\
-  else								\
-    {								\
-      yyerror (YY_("syntax error: cannot back up")); \
-      YYERROR;							\
-    }								\
-while (YYID (0))
-
-
-#define YYTERROR	1
-#define YYERRCODE	256
-
-
-/* YYLLOC_DEFAULT -- Set CURRENT to span from RHS[1] to RHS[N].
-   If N is 0, then set CURRENT to the empty location which ends
-   the previous symbol: RHS[0] (always defined).  */
-
-#define YYRHSLOC(Rhs, K) ((Rhs)[K])
-#ifndef YYLLOC_DEFAULT
-# define YYLLOC_DEFAULT(Current, Rhs, N)				\
-    do									\
-      if (YYID (N))                                                    \
-	{								\
-	  (Current).first_line   = YYRHSLOC (Rhs, 1).first_line;	\
-	  (Current).first_column = YYRHSLOC (Rhs, 1).first_column;	\
-	  (Current).last_line    = YYRHSLOC (Rhs, N).last_line;		\
-	  (Current).last_column  = YYRHSLOC (Rhs, N).last_column;	\
-	}								\
-      else								\
-	{								\
-	  (Current).first_line   = (Current).last_line   =		\
-	    YYRHSLOC (Rhs, 0).last_line;				\
-	  (Current).first_column = (Current).last_column =		\
-	    YYRHSLOC (Rhs, 0).last_column;				\
-	}								\
-    while (YYID (0))
-#endif
+enum { YYENOMEM = -2 };
 
+#define yyerrok         (yyerrstatus = 0)
+#define yyclearin       (yychar = YYEMPTY)
 
-/* This macro is provided for backward compatibility. */
+#define YYACCEPT        goto yyacceptlab
+#define YYABORT         goto yyabortlab
+#define YYERROR         goto yyerrorlab
+#define YYNOMEM         goto yyexhaustedlab
 
-#ifndef YY_LOCATION_PRINT
-# define YY_LOCATION_PRINT(File, Loc) ((void) 0)
-#endif
 
+#define YYRECOVERING()  (!!yyerrstatus)
 
-/* YYLEX -- calling `yylex' with the right arguments.  */
+#define YYBACKUP(Token, Value)                                    \
+  do                                                              \
+    if (yychar == YYEMPTY)                                        \
+      {                                                           \
+        yychar = (Token);                                         \
+        yylval = (Value);                                         \
+        YYPOPSTACK (yylen);                                       \
+        yystate = *yyssp;                                         \
+        goto yybackup;                                            \
+      }                                                           \
+    else                                                          \
+      {                                                           \
+        yyerror (YY_("syntax error: cannot back up")); \
+        YYERROR;                                                  \
+      }                                                           \
+  while (0)
+
+/* Backward compatibility with an undocumented macro.
+   Use YYerror or YYUNDEF. */
+#define YYERRCODE YYUNDEF
 
-#ifdef YYLEX_PARAM
-# define YYLEX yylex (YYLEX_PARAM)
-#else
-# define YYLEX yylex ()
-#endif
 
 /* Enable debugging if requested.  */
 #if YYDEBUG
@@ -744,80 +913,58 @@ while (YYID (0))
 #  define YYFPRINTF fprintf
 # endif
 
-# define YYDPRINTF(Args)			\
-do {						\
-  if (yydebug)					\
-    YYFPRINTF Args;				\
-} while (YYID (0))
-
-# define YY_SYMBOL_PRINT(Title, Type, Value, Location)			  \
-do {									  \
-  if (yydebug)								  \
-    {									  \
-      YYFPRINTF (stderr, "%s ", Title);					  \
-      yy_symbol_print (stderr,						  \
-		  Type, Value); \
-      YYFPRINTF (stderr, "\n");						  \
-    }									  \
-} while (YYID (0))
-
-
-/*--------------------------------.
-| Print this symbol on YYOUTPUT.  |
-`--------------------------------*/
-
-/*ARGSUSED*/
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static void
-yy_symbol_value_print (FILE *yyoutput, int yytype, YYSTYPE const * const yyvaluep)
-#else
+# define YYDPRINTF(Args)                        \
+do {                                            \
+  if (yydebug)                                  \
+    YYFPRINTF Args;                             \
+} while (0)
+
+
+
+
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)                    \
+do {                                                                      \
+  if (yydebug)                                                            \
+    {                                                                     \
+      YYFPRINTF (stderr, "%s ", Title);                                   \
+      yy_symbol_print (stderr,                                            \
+                  Kind, Value); \
+      YYFPRINTF (stderr, "\n");                                           \
+    }                                                                     \
+} while (0)
+
+
+/*-----------------------------------.
+| Print this symbol's value on YYO.  |
+`-----------------------------------*/
+
 static void
-yy_symbol_value_print (yyoutput, yytype, yyvaluep)
-    FILE *yyoutput;
-    int yytype;
-    YYSTYPE const * const yyvaluep;
-#endif
+yy_symbol_value_print (FILE *yyo,
+                       yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep)
 {
+  FILE *yyoutput = yyo;
+  YY_USE (yyoutput);
   if (!yyvaluep)
     return;
-# ifdef YYPRINT
-  if (yytype < YYNTOKENS)
-    YYPRINT (yyoutput, yytoknum[yytype], *yyvaluep);
-# else
-  YYUSE (yyoutput);
-# endif
-  switch (yytype)
-    {
-      default:
-	break;
-    }
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
 }
 
 
-/*--------------------------------.
-| Print this symbol on YYOUTPUT.  |
-`--------------------------------*/
+/*---------------------------.
+| Print this symbol on YYO.  |
+`---------------------------*/
 
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
 static void
-yy_symbol_print (FILE *yyoutput, int yytype, YYSTYPE const * const yyvaluep)
-#else
-static void
-yy_symbol_print (yyoutput, yytype, yyvaluep)
-    FILE *yyoutput;
-    int yytype;
-    YYSTYPE const * const yyvaluep;
-#endif
+yy_symbol_print (FILE *yyo,
+                 yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep)
 {
-  if (yytype < YYNTOKENS)
-    YYFPRINTF (yyoutput, "token %s (", yytname[yytype]);
-  else
-    YYFPRINTF (yyoutput, "nterm %s (", yytname[yytype]);
+  YYFPRINTF (yyo, "%s %s (",
+             yykind < YYNTOKENS ? "token" : "nterm", yysymbol_name (yykind));
 
-  yy_symbol_value_print (yyoutput, yytype, yyvaluep);
-  YYFPRINTF (yyoutput, ")");
+  yy_symbol_value_print (yyo, yykind, yyvaluep);
+  YYFPRINTF (yyo, ")");
 }
 
 /*------------------------------------------------------------------.
@@ -825,16 +972,8 @@ yy_symbol_print (yyoutput, yytype, yyvaluep)
 | TOP (included).                                                   |
 `------------------------------------------------------------------*/
 
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
 static void
-yy_stack_print (yytype_int16 *yybottom, yytype_int16 *yytop)
-#else
-static void
-yy_stack_print (yybottom, yytop)
-    yytype_int16 *yybottom;
-    yytype_int16 *yytop;
-#endif
+yy_stack_print (yy_state_t *yybottom, yy_state_t *yytop)
 {
   YYFPRINTF (stderr, "Stack now");
   for (; yybottom <= yytop; yybottom++)
@@ -845,63 +984,56 @@ yy_stack_print (yybottom, yytop)
   YYFPRINTF (stderr, "\n");
 }
 
-# define YY_STACK_PRINT(Bottom, Top)				\
-do {								\
-  if (yydebug)							\
-    yy_stack_print ((Bottom), (Top));				\
-} while (YYID (0))
+# define YY_STACK_PRINT(Bottom, Top)                            \
+do {                                                            \
+  if (yydebug)                                                  \
+    yy_stack_print ((Bottom), (Top));                           \
+} while (0)
 
 
 /*------------------------------------------------.
 | Report that the YYRULE is going to be reduced.  |
 `------------------------------------------------*/
 
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static void
-yy_reduce_print (YYSTYPE *yyvsp, int yyrule)
-#else
 static void
-yy_reduce_print (yyvsp, yyrule)
-    YYSTYPE *yyvsp;
-    int yyrule;
-#endif
+yy_reduce_print (yy_state_t *yyssp, YYSTYPE *yyvsp,
+                 int yyrule)
 {
+  int yylno = yyrline[yyrule];
   int yynrhs = yyr2[yyrule];
   int yyi;
-  unsigned long int yylno = yyrline[yyrule];
-  YYFPRINTF (stderr, "Reducing stack by rule %d (line %lu):\n",
-	     yyrule - 1, yylno);
+  YYFPRINTF (stderr, "Reducing stack by rule %d (line %d):\n",
+             yyrule - 1, yylno);
   /* The symbols being reduced.  */
   for (yyi = 0; yyi < yynrhs; yyi++)
     {
       YYFPRINTF (stderr, "   $%d = ", yyi + 1);
-      yy_symbol_print (stderr, yyrhs[yyprhs[yyrule] + yyi],
-		       &(yyvsp[(yyi + 1) - (yynrhs)])
-		       		       );
+      yy_symbol_print (stderr,
+                       YY_ACCESSING_SYMBOL (+yyssp[yyi + 1 - yynrhs]),
+                       &yyvsp[(yyi + 1) - (yynrhs)]);
       YYFPRINTF (stderr, "\n");
     }
 }
 
-# define YY_REDUCE_PRINT(Rule)		\
-do {					\
-  if (yydebug)				\
-    yy_reduce_print (yyvsp, Rule); \
-} while (YYID (0))
+# define YY_REDUCE_PRINT(Rule)          \
+do {                                    \
+  if (yydebug)                          \
+    yy_reduce_print (yyssp, yyvsp, Rule); \
+} while (0)
 
 /* Nonzero means print parse trace.  It is left uninitialized so that
    multiple parsers can coexist.  */
 int yydebug;
 #else /* !YYDEBUG */
-# define YYDPRINTF(Args)
-# define YY_SYMBOL_PRINT(Title, Type, Value, Location)
+# define YYDPRINTF(Args) ((void) 0)
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)
 # define YY_STACK_PRINT(Bottom, Top)
 # define YY_REDUCE_PRINT(Rule)
 #endif /* !YYDEBUG */
 
 
 /* YYINITDEPTH -- initial size of the parser's stacks.  */
-#ifndef	YYINITDEPTH
+#ifndef YYINITDEPTH
 # define YYINITDEPTH 200
 #endif
 
@@ -917,365 +1049,77 @@ int yydebug;
 #endif
 
 
-#if YYERROR_VERBOSE
-
-# ifndef yystrlen
-#  if defined __GLIBC__ && defined _STRING_H
-#   define yystrlen strlen
-#  else
-/* Return the length of YYSTR.  */
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static YYSIZE_T
-yystrlen (const char *yystr)
-#else
-static YYSIZE_T
-yystrlen (yystr)
-    const char *yystr;
-#endif
-{
-  YYSIZE_T yylen;
-  for (yylen = 0; yystr[yylen]; yylen++)
-    continue;
-  return yylen;
-}
-#  endif
-# endif
-
-# ifndef yystpcpy
-#  if defined __GLIBC__ && defined _STRING_H && defined _GNU_SOURCE
-#   define yystpcpy stpcpy
-#  else
-/* Copy YYSRC to YYDEST, returning the address of the terminating '\0' in
-   YYDEST.  */
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static char *
-yystpcpy (char *yydest, const char *yysrc)
-#else
-static char *
-yystpcpy (yydest, yysrc)
-    char *yydest;
-    const char *yysrc;
-#endif
-{
-  char *yyd = yydest;
-  const char *yys = yysrc;
-
-  while ((*yyd++ = *yys++) != '\0')
-    continue;
-
-  return yyd - 1;
-}
-#  endif
-# endif
-
-# ifndef yytnamerr
-/* Copy to YYRES the contents of YYSTR after stripping away unnecessary
-   quotes and backslashes, so that it's suitable for yyerror.  The
-   heuristic is that double-quoting is unnecessary unless the string
-   contains an apostrophe, a comma, or backslash (other than
-   backslash-backslash).  YYSTR is taken from yytname.  If YYRES is
-   null, do not copy; instead, return the length of what the result
-   would have been.  */
-static YYSIZE_T
-yytnamerr (char *yyres, const char *yystr)
-{
-  if (*yystr == '"')
-    {
-      YYSIZE_T yyn = 0;
-      char const *yyp = yystr;
-
-      for (;;)
-	switch (*++yyp)
-	  {
-	  case '\'':
-	  case ',':
-	    goto do_not_strip_quotes;
-
-	  case '\\':
-	    if (*++yyp != '\\')
-	      goto do_not_strip_quotes;
-	    /* Fall through.  */
-	  default:
-	    if (yyres)
-	      yyres[yyn] = *yyp;
-	    yyn++;
-	    break;
-
-	  case '"':
-	    if (yyres)
-	      yyres[yyn] = '\0';
-	    return yyn;
-	  }
-    do_not_strip_quotes: ;
-    }
-
-  if (! yyres)
-    return yystrlen (yystr);
-
-  return yystpcpy (yyres, yystr) - yyres;
-}
-# endif
-
-/* Copy into *YYMSG, which is of size *YYMSG_ALLOC, an error message
-   about the unexpected token YYTOKEN for the state stack whose top is
-   YYSSP.
-
-   Return 0 if *YYMSG was successfully written.  Return 1 if *YYMSG is
-   not large enough to hold the message.  In that case, also set
-   *YYMSG_ALLOC to the required number of bytes.  Return 2 if the
-   required number of bytes is too large to store.  */
-static int
-yysyntax_error (YYSIZE_T *yymsg_alloc, char **yymsg,
-                yytype_int16 *yyssp, int yytoken)
-{
-  YYSIZE_T yysize0 = yytnamerr (0, yytname[yytoken]);
-  YYSIZE_T yysize = yysize0;
-  YYSIZE_T yysize1;
-  enum { YYERROR_VERBOSE_ARGS_MAXIMUM = 5 };
-  /* Internationalized format string. */
-  const char *yyformat = 0;
-  /* Arguments of yyformat. */
-  char const *yyarg[YYERROR_VERBOSE_ARGS_MAXIMUM];
-  /* Number of reported tokens (one for the "unexpected", one per
-     "expected"). */
-  int yycount = 0;
-
-  /* There are many possibilities here to consider:
-     - Assume YYFAIL is not used.  It's too flawed to consider.  See
-       <http://lists.gnu.org/archive/html/bison-patches/2009-12/msg00024.html>
-       for details.  YYERROR is fine as it does not invoke this
-       function.
-     - If this state is a consistent state with a default action, then
-       the only way this function was invoked is if the default action
-       is an error action.  In that case, don't check for expected
-       tokens because there are none.
-     - The only way there can be no lookahead present (in yychar) is if
-       this state is a consistent state with a default action.  Thus,
-       detecting the absence of a lookahead is sufficient to determine
-       that there is no unexpected or expected token to report.  In that
-       case, just report a simple "syntax error".
-     - Don't assume there isn't a lookahead just because this state is a
-       consistent state with a default action.  There might have been a
-       previous inconsistent state, consistent state with a non-default
-       action, or user semantic action that manipulated yychar.
-     - Of course, the expected token list depends on states to have
-       correct lookahead information, and it depends on the parser not
-       to perform extra reductions after fetching a lookahead from the
-       scanner and before detecting a syntax error.  Thus, state merging
-       (from LALR or IELR) and default reductions corrupt the expected
-       token list.  However, the list is correct for canonical LR with
-       one exception: it will still contain any token that will not be
-       accepted due to an error action in a later state.
-  */
-  if (yytoken != YYEMPTY)
-    {
-      int yyn = yypact[*yyssp];
-      yyarg[yycount++] = yytname[yytoken];
-      if (!yypact_value_is_default (yyn))
-        {
-          /* Start YYX at -YYN if negative to avoid negative indexes in
-             YYCHECK.  In other words, skip the first -YYN actions for
-             this state because they are default actions.  */
-          int yyxbegin = yyn < 0 ? -yyn : 0;
-          /* Stay within bounds of both yycheck and yytname.  */
-          int yychecklim = YYLAST - yyn + 1;
-          int yyxend = yychecklim < YYNTOKENS ? yychecklim : YYNTOKENS;
-          int yyx;
-
-          for (yyx = yyxbegin; yyx < yyxend; ++yyx)
-            if (yycheck[yyx + yyn] == yyx && yyx != YYTERROR
-                && !yytable_value_is_error (yytable[yyx + yyn]))
-              {
-                if (yycount == YYERROR_VERBOSE_ARGS_MAXIMUM)
-                  {
-                    yycount = 1;
-                    yysize = yysize0;
-                    break;
-                  }
-                yyarg[yycount++] = yytname[yyx];
-                yysize1 = yysize + yytnamerr (0, yytname[yyx]);
-                if (! (yysize <= yysize1
-                       && yysize1 <= YYSTACK_ALLOC_MAXIMUM))
-                  return 2;
-                yysize = yysize1;
-              }
-        }
-    }
-
-  switch (yycount)
-    {
-# define YYCASE_(N, S)                      \
-      case N:                               \
-        yyformat = S;                       \
-      break
-      YYCASE_(0, YY_("syntax error"));
-      YYCASE_(1, YY_("syntax error, unexpected %s"));
-      YYCASE_(2, YY_("syntax error, unexpected %s, expecting %s"));
-      YYCASE_(3, YY_("syntax error, unexpected %s, expecting %s or %s"));
-      YYCASE_(4, YY_("syntax error, unexpected %s, expecting %s or %s or %s"));
-      YYCASE_(5, YY_("syntax error, unexpected %s, expecting %s or %s or %s or %s"));
-# undef YYCASE_
-    }
 
-  yysize1 = yysize + yystrlen (yyformat);
-  if (! (yysize <= yysize1 && yysize1 <= YYSTACK_ALLOC_MAXIMUM))
-    return 2;
-  yysize = yysize1;
 
-  if (*yymsg_alloc < yysize)
-    {
-      *yymsg_alloc = 2 * yysize;
-      if (! (yysize <= *yymsg_alloc
-             && *yymsg_alloc <= YYSTACK_ALLOC_MAXIMUM))
-        *yymsg_alloc = YYSTACK_ALLOC_MAXIMUM;
-      return 1;
-    }
 
-  /* Avoid sprintf, as that infringes on the user's name space.
-     Don't have undefined behavior even if the translation
-     produced a string with the wrong number of "%s"s.  */
-  {
-    char *yyp = *yymsg;
-    int yyi = 0;
-    while ((*yyp = *yyformat) != '\0')
-      if (*yyp == '%' && yyformat[1] == 's' && yyi < yycount)
-        {
-          yyp += yytnamerr (yyp, yyarg[yyi++]);
-          yyformat += 2;
-        }
-      else
-        {
-          yyp++;
-          yyformat++;
-        }
-  }
-  return 0;
-}
-#endif /* YYERROR_VERBOSE */
 
 /*-----------------------------------------------.
 | Release the memory associated to this symbol.  |
 `-----------------------------------------------*/
 
-/*ARGSUSED*/
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static void
-yydestruct (const char *yymsg, int yytype, YYSTYPE *yyvaluep)
-#else
 static void
-yydestruct (yymsg, yytype, yyvaluep)
-    const char *yymsg;
-    int yytype;
-    YYSTYPE *yyvaluep;
-#endif
+yydestruct (const char *yymsg,
+            yysymbol_kind_t yykind, YYSTYPE *yyvaluep)
 {
-  YYUSE (yyvaluep);
-
+  YY_USE (yyvaluep);
   if (!yymsg)
     yymsg = "Deleting";
-  YY_SYMBOL_PRINT (yymsg, yytype, yyvaluep, yylocationp);
-
-  switch (yytype)
-    {
+  YY_SYMBOL_PRINT (yymsg, yykind, yyvaluep, yylocationp);
 
-      default:
-	break;
-    }
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
 }
 
 
-/* Prevent warnings from -Wmissing-prototypes.  */
-#ifdef YYPARSE_PARAM
-#if defined __STDC__ || defined __cplusplus
-int yyparse (void *YYPARSE_PARAM);
-#else
-int yyparse ();
-#endif
-#else /* ! YYPARSE_PARAM */
-#if defined __STDC__ || defined __cplusplus
-int yyparse (void);
-#else
-int yyparse ();
-#endif
-#endif /* ! YYPARSE_PARAM */
-
-
-/* The lookahead symbol.  */
+/* Lookahead token kind.  */
 int yychar;
 
 /* The semantic value of the lookahead symbol.  */
 YYSTYPE yylval;
-
 /* Number of syntax errors so far.  */
 int yynerrs;
 
 
+
+
 /*----------.
 | yyparse.  |
 `----------*/
 
-#ifdef YYPARSE_PARAM
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-int
-yyparse (void *YYPARSE_PARAM)
-#else
-int
-yyparse (YYPARSE_PARAM)
-    void *YYPARSE_PARAM;
-#endif
-#else /* ! YYPARSE_PARAM */
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
 int
 yyparse (void)
-#else
-int
-yyparse ()
-
-#endif
-#endif
 {
-    int yystate;
+    yy_state_fast_t yystate = 0;
     /* Number of tokens to shift before error messages enabled.  */
-    int yyerrstatus;
-
-    /* The stacks and their tools:
-       `yyss': related to states.
-       `yyvs': related to semantic values.
+    int yyerrstatus = 0;
 
-       Refer to the stacks thru separate pointers, to allow yyoverflow
+    /* Refer to the stacks through separate pointers, to allow yyoverflow
        to reallocate them elsewhere.  */
 
-    /* The state stack.  */
-    yytype_int16 yyssa[YYINITDEPTH];
-    yytype_int16 *yyss;
-    yytype_int16 *yyssp;
+    /* Their size.  */
+    YYPTRDIFF_T yystacksize = YYINITDEPTH;
 
-    /* The semantic value stack.  */
-    YYSTYPE yyvsa[YYINITDEPTH];
-    YYSTYPE *yyvs;
-    YYSTYPE *yyvsp;
+    /* The state stack: array, bottom, top.  */
+    yy_state_t yyssa[YYINITDEPTH];
+    yy_state_t *yyss = yyssa;
+    yy_state_t *yyssp = yyss;
 
-    YYSIZE_T yystacksize;
+    /* The semantic value stack: array, bottom, top.  */
+    YYSTYPE yyvsa[YYINITDEPTH];
+    YYSTYPE *yyvs = yyvsa;
+    YYSTYPE *yyvsp = yyvs;
 
   int yyn;
+  /* The return value of yyparse.  */
   int yyresult;
-  /* Lookahead token as an internal (translated) token number.  */
-  int yytoken;
+  /* Lookahead symbol kind.  */
+  yysymbol_kind_t yytoken = YYSYMBOL_YYEMPTY;
   /* The variables used to return semantic value and location from the
      action routines.  */
   YYSTYPE yyval;
 
-#if YYERROR_VERBOSE
-  /* Buffer for error messages, and its allocated size.  */
-  char yymsgbuf[128];
-  char *yymsg = yymsgbuf;
-  YYSIZE_T yymsg_alloc = sizeof yymsgbuf;
-#endif
+
 
 #define YYPOPSTACK(N)   (yyvsp -= (N), yyssp -= (N))
 
@@ -1283,111 +1127,107 @@ yyparse ()
      Keep to zero when no symbol should be popped.  */
   int yylen = 0;
 
-  yytoken = 0;
-  yyss = yyssa;
-  yyvs = yyvsa;
-  yystacksize = YYINITDEPTH;
-
   YYDPRINTF ((stderr, "Starting parse\n"));
 
-  yystate = 0;
-  yyerrstatus = 0;
-  yynerrs = 0;
   yychar = YYEMPTY; /* Cause a token to be read.  */
 
-  /* Initialize stack pointers.
-     Waste one element of value and location stack
-     so that they stay on the same level as the state stack.
-     The wasted elements are never initialized.  */
-  yyssp = yyss;
-  yyvsp = yyvs;
-
   goto yysetstate;
 
+
 /*------------------------------------------------------------.
-| yynewstate -- Push a new state, which is found in yystate.  |
+| yynewstate -- push a new state, which is found in yystate.  |
 `------------------------------------------------------------*/
- yynewstate:
+yynewstate:
   /* In all cases, when you get here, the value and location stacks
      have just been pushed.  So pushing a state here evens the stacks.  */
   yyssp++;
 
- yysetstate:
-  *yyssp = yystate;
+
+/*--------------------------------------------------------------------.
+| yysetstate -- set current state (the top of the stack) to yystate.  |
+`--------------------------------------------------------------------*/
+yysetstate:
+  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
+  YY_ASSERT (0 <= yystate && yystate < YYNSTATES);
+  YY_IGNORE_USELESS_CAST_BEGIN
+  *yyssp = YY_CAST (yy_state_t, yystate);
+  YY_IGNORE_USELESS_CAST_END
+  YY_STACK_PRINT (yyss, yyssp);
 
   if (yyss + yystacksize - 1 <= yyssp)
+#if !defined yyoverflow && !defined YYSTACK_RELOCATE
+    YYNOMEM;
+#else
     {
       /* Get the current used size of the three stacks, in elements.  */
-      YYSIZE_T yysize = yyssp - yyss + 1;
+      YYPTRDIFF_T yysize = yyssp - yyss + 1;
 
-#ifdef yyoverflow
+# if defined yyoverflow
       {
-	/* Give user a chance to reallocate the stack.  Use copies of
-	   these so that the &'s don't force the real ones into
-	   memory.  */
-	YYSTYPE *yyvs1 = yyvs;
-	yytype_int16 *yyss1 = yyss;
-
-	/* Each stack pointer address is followed by the size of the
-	   data in use in that stack, in bytes.  This used to be a
-	   conditional around just the two extra args, but that might
-	   be undefined if yyoverflow is a macro.  */
-	yyoverflow (YY_("memory exhausted"),
-		    &yyss1, yysize * sizeof (*yyssp),
-		    &yyvs1, yysize * sizeof (*yyvsp),
-		    &yystacksize);
-
-	yyss = yyss1;
-	yyvs = yyvs1;
+        /* Give user a chance to reallocate the stack.  Use copies of
+           these so that the &'s don't force the real ones into
+           memory.  */
+        yy_state_t *yyss1 = yyss;
+        YYSTYPE *yyvs1 = yyvs;
+
+        /* Each stack pointer address is followed by the size of the
+           data in use in that stack, in bytes.  This used to be a
+           conditional around just the two extra args, but that might
+           be undefined if yyoverflow is a macro.  */
+        yyoverflow (YY_("memory exhausted"),
+                    &yyss1, yysize * YYSIZEOF (*yyssp),
+                    &yyvs1, yysize * YYSIZEOF (*yyvsp),
+                    &yystacksize);
+        yyss = yyss1;
+        yyvs = yyvs1;
       }
-#else /* no yyoverflow */
-# ifndef YYSTACK_RELOCATE
-      goto yyexhaustedlab;
-# else
+# else /* defined YYSTACK_RELOCATE */
       /* Extend the stack our own way.  */
       if (YYMAXDEPTH <= yystacksize)
-	goto yyexhaustedlab;
+        YYNOMEM;
       yystacksize *= 2;
       if (YYMAXDEPTH < yystacksize)
-	yystacksize = YYMAXDEPTH;
+        yystacksize = YYMAXDEPTH;
 
       {
-	yytype_int16 *yyss1 = yyss;
-	union yyalloc *yyptr =
-	  (union yyalloc *) YYSTACK_ALLOC (YYSTACK_BYTES (yystacksize));
-	if (! yyptr)
-	  goto yyexhaustedlab;
-	YYSTACK_RELOCATE (yyss_alloc, yyss);
-	YYSTACK_RELOCATE (yyvs_alloc, yyvs);
+        yy_state_t *yyss1 = yyss;
+        union yyalloc *yyptr =
+          YY_CAST (union yyalloc *,
+                   YYSTACK_ALLOC (YY_CAST (YYSIZE_T, YYSTACK_BYTES (yystacksize))));
+        if (! yyptr)
+          YYNOMEM;
+        YYSTACK_RELOCATE (yyss_alloc, yyss);
+        YYSTACK_RELOCATE (yyvs_alloc, yyvs);
 #  undef YYSTACK_RELOCATE
-	if (yyss1 != yyssa)
-	  YYSTACK_FREE (yyss1);
+        if (yyss1 != yyssa)
+          YYSTACK_FREE (yyss1);
       }
 # endif
-#endif /* no yyoverflow */
 
       yyssp = yyss + yysize - 1;
       yyvsp = yyvs + yysize - 1;
 
-      YYDPRINTF ((stderr, "Stack size increased to %lu\n",
-		  (unsigned long int) yystacksize));
+      YY_IGNORE_USELESS_CAST_BEGIN
+      YYDPRINTF ((stderr, "Stack size increased to %ld\n",
+                  YY_CAST (long, yystacksize)));
+      YY_IGNORE_USELESS_CAST_END
 
       if (yyss + yystacksize - 1 <= yyssp)
-	YYABORT;
+        YYABORT;
     }
+#endif /* !defined yyoverflow && !defined YYSTACK_RELOCATE */
 
-  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
 
   if (yystate == YYFINAL)
     YYACCEPT;
 
   goto yybackup;
 
+
 /*-----------.
 | yybackup.  |
 `-----------*/
 yybackup:
-
   /* Do appropriate processing given the current state.  Read a
      lookahead token if we need one and don't already have one.  */
 
@@ -1398,18 +1238,29 @@ yybackup:
 
   /* Not known => get a lookahead token if don't already have one.  */
 
-  /* YYCHAR is either YYEMPTY or YYEOF or a valid lookahead symbol.  */
+  /* YYCHAR is either empty, or end-of-input, or a valid lookahead.  */
   if (yychar == YYEMPTY)
     {
-      YYDPRINTF ((stderr, "Reading a token: "));
-      yychar = YYLEX;
+      YYDPRINTF ((stderr, "Reading a token\n"));
+      yychar = yylex ();
     }
 
   if (yychar <= YYEOF)
     {
-      yychar = yytoken = YYEOF;
+      yychar = YYEOF;
+      yytoken = YYSYMBOL_YYEOF;
       YYDPRINTF ((stderr, "Now at end of input.\n"));
     }
+  else if (yychar == YYerror)
+    {
+      /* The scanner already issued an error message, process directly
+         to error recovery.  But do not keep the error token as
+         lookahead, it is too special and may lead us to an endless
+         loop in error recovery. */
+      yychar = YYUNDEF;
+      yytoken = YYSYMBOL_YYerror;
+      goto yyerrlab1;
+    }
   else
     {
       yytoken = YYTRANSLATE (yychar);
@@ -1437,13 +1288,13 @@ yybackup:
 
   /* Shift the lookahead token.  */
   YY_SYMBOL_PRINT ("Shifting", yytoken, &yylval, &yylloc);
-
-  /* Discard the shifted token.  */
-  yychar = YYEMPTY;
-
   yystate = yyn;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
   *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
 
+  /* Discard the shifted token.  */
+  yychar = YYEMPTY;
   goto yynewstate;
 
 
@@ -1458,14 +1309,14 @@ yydefault:
 
 
 /*-----------------------------.
-| yyreduce -- Do a reduction.  |
+| yyreduce -- do a reduction.  |
 `-----------------------------*/
 yyreduce:
   /* yyn is the number of a rule to reduce with.  */
   yylen = yyr2[yyn];
 
   /* If YYLEN is nonzero, implement the default value of the action:
-     `$$ = $1'.
+     '$$ = $1'.
 
      Otherwise, the following line sets YYVAL to garbage.
      This behavior is undocumented and Bison
@@ -1478,273 +1329,667 @@ yyreduce:
   YY_REDUCE_PRINT (yyn);
   switch (yyn)
     {
-        case 4:
-
-/* Line 1806 of yacc.c  */
-#line 103 "ExpSpec.y"
-    { 
+  case 4: /* $@1: %empty  */
+#line 134 "ExpSpec.y"
+{ 
   /* write on the output stream some header data */
   //  write_header($2);
   /* get the solver from the tester class */
-  main_tester->LoadInstance(*(yyvsp[(2) - (2)].char_string));
+  main_tester->LoadInstance(*(yyvsp[0].char_string));
 }
+#line 1341 "ExpSpec.tab.c"
     break;
 
-  case 6:
-
-/* Line 1806 of yacc.c  */
-#line 116 "ExpSpec.y"
-    {
+  case 6: /* solver: "{" solver_kind solver_time_limit initial_state solver_workers solver_processes solver_deterministic other_parameters runners "}"  */
+#line 153 "ExpSpec.y"
+{
   main_tester->StartSolver();
 }
+#line 1349 "ExpSpec.tab.c"
     break;
 
-  case 13:
-
-/* Line 1806 of yacc.c  */
-#line 129 "ExpSpec.y"
-    {
+  case 13: /* solver_trials: %empty  */
+#line 166 "ExpSpec.y"
+{
   main_tester->SetSolverTrials(1);
 }
+#line 1357 "ExpSpec.tab.c"
     break;
 
-  case 14:
+  case 14: /* solver_trials: "Trials" "natural" ";"  */
+#line 170 "ExpSpec.y"
+{
+  main_tester->SetSolverTrials((yyvsp[-1].natural));
+}
+#line 1365 "ExpSpec.tab.c"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 133 "ExpSpec.y"
-    {
-  main_tester->SetSolverTrials((yyvsp[(2) - (3)].natural));
+  case 15: /* log_file: %empty  */
+#line 176 "ExpSpec.y"
+{}
+#line 1371 "ExpSpec.tab.c"
+    break;
+
+  case 16: /* log_file: "Log file" "string" ";"  */
+#line 178 "ExpSpec.y"
+{
+	main_tester->SetLogFile(*(yyvsp[-1].char_string));
+	delete (yyvsp[-1].char_string);
 }
+#line 1380 "ExpSpec.tab.c"
     break;
 
-  case 15:
+  case 17: /* output_file_prefix: %empty  */
+#line 184 "ExpSpec.y"
+{}
+#line 1386 "ExpSpec.tab.c"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 139 "ExpSpec.y"
-    {}
+  case 18: /* output_file_prefix: "Output prefix" "string" ";"  */
+#line 186 "ExpSpec.y"
+{ 
+  main_tester->SetOutputPrefix(*(yyvsp[-1].char_string)); 
+  delete (yyvsp[-1].char_string);
+}
+#line 1395 "ExpSpec.tab.c"
     break;
 
-  case 16:
+  case 19: /* plot_file_prefix: %empty  */
+#line 193 "ExpSpec.y"
+{}
+#line 1401 "ExpSpec.tab.c"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 141 "ExpSpec.y"
+  case 20: /* plot_file_prefix: "Plot prefix" "string" ";"  */
+#line 195 "ExpSpec.y"
+{ 
+  main_tester->SetPlotPrefix(*(yyvsp[-1].char_string)); 
+  delete (yyvsp[-1].char_string);
+}
+#line 1410 "ExpSpec.tab.c"
+    break;
+
+  case 21: /* solver_kind: %empty  */
+#line 203 "ExpSpec.y"
+{
+  main_tester->SelectSolver("");
+}
+#line 1418 "ExpSpec.tab.c"
+    break;
+
+  case 22: /* solver_kind: "Solver" "string" ";"  */
+#line 207 "ExpSpec.y"
+{
+  if (main_tester->SelectSolver(*(yyvsp[-1].char_string)) == SOLVER_NOT_FOUND)
     {
-	main_tester->SetLogFile(*(yyvsp[(2) - (3)].char_string));
-	delete (yyvsp[(2) - (3)].char_string);
+      std::string s(*(yyvsp[-1].char_string));
+      s = "solver `" + s + "' not found error";
+      delete (yyvsp[-1].char_string);
+      yyerror(s.c_str());
+      YYABORT;
+    }
+  delete (yyvsp[-1].char_string);
 }
+#line 1434 "ExpSpec.tab.c"
     break;
 
-  case 17:
+  case 23: /* solver_time_limit: %empty  */
+#line 221 "ExpSpec.y"
+{
+  main_tester->SetSolverTimeLimit(0);
+}
+#line 1442 "ExpSpec.tab.c"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 147 "ExpSpec.y"
-    {}
+  case 24: /* solver_time_limit: "Time limit" "duration" ";"  */
+#line 225 "ExpSpec.y"
+{
+  main_tester->SetSolverTimeLimit((yyvsp[-1].real));
+}
+#line 1450 "ExpSpec.tab.c"
     break;
 
-  case 18:
+  case 25: /* initial_state: %empty  */
+#line 231 "ExpSpec.y"
+{
+  main_tester->SetInitialState(RANDOM_INITIAL_STATE);
+}
+#line 1458 "ExpSpec.tab.c"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 149 "ExpSpec.y"
-    { 
-  main_tester->SetOutputPrefix(*(yyvsp[(2) - (3)].char_string)); 
-  delete (yyvsp[(2) - (3)].char_string);
+  case 26: /* initial_state: "Initial state" "random" ";"  */
+#line 235 "ExpSpec.y"
+{
+  main_tester->SetInitialState(RANDOM_INITIAL_STATE);
 }
+#line 1466 "ExpSpec.tab.c"
     break;
 
-  case 19:
+  case 27: /* initial_state: "Initial state" "greedy" ";"  */
+#line 239 "ExpSpec.y"
+{
+  main_tester->SetInitialState(GREEDY_INITIAL_STATE);
+}
+#line 1474 "ExpSpec.tab.c"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 156 "ExpSpec.y"
-    {}
+  case 28: /* solver_workers: %empty  */
+#line 245 "ExpSpec.y"
+{
+  main_tester->SetSolverWorkers(0);
+}
+#line 1482 "ExpSpec.tab.c"
     break;
 
-  case 20:
+  case 29: /* solver_workers: "Workers" "natural" ";"  */
+#line 249 "ExpSpec.y"
+{
+  main_tester->SetSolverWorkers((yyvsp[-1].natural));
+}
+#line 1490 "ExpSpec.tab.c"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 158 "ExpSpec.y"
-    { 
-  main_tester->SetPlotPrefix(*(yyvsp[(2) - (3)].char_string)); 
-  delete (yyvsp[(2) - (3)].char_string);
+  case 30: /* solver_processes: %empty  */
+#line 255 "ExpSpec.y"
+{
+  main_tester->SetSolverProcesses(0);
 }
+#line 1498 "ExpSpec.tab.c"
     break;
 
-  case 23:
+  case 31: /* solver_processes: "Processes" "natural" ";"  */
+#line 259 "ExpSpec.y"
+{
+  main_tester->SetSolverProcesses((yyvsp[-1].natural));
+}
+#line 1506 "ExpSpec.tab.c"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 170 "ExpSpec.y"
-    {
+  case 32: /* solver_deterministic: %empty  */
+#line 265 "ExpSpec.y"
+{
+  main_tester->SetSolverDeterministic(false);
+}
+#line 1514 "ExpSpec.tab.c"
+    break;
+
+  case 33: /* solver_deterministic: "Deterministic" "natural" ";"  */
+#line 269 "ExpSpec.y"
+{
+  main_tester->SetSolverDeterministic(true, (yyvsp[-1].natural));
+}
+#line 1522 "ExpSpec.tab.c"
+    break;
+
+  case 34: /* solver_deterministic: "Deterministic" "natural" "," "natural" ";"  */
+#line 273 "ExpSpec.y"
+{
+  main_tester->SetSolverDeterministic(true, (yyvsp[-3].natural), (yyvsp[-1].natural));
+}
+#line 1530 "ExpSpec.tab.c"
+    break;
+
+  case 37: /* $@2: %empty  */
+#line 283 "ExpSpec.y"
+{
   // add runner of type hill climbing to the solver
-  int status_value = main_tester->AddRunnerToSolver(*(yyvsp[(3) - (3)].char_string), "Hill Climbing");
+  int status_value = main_tester->AddRunnerToSolver(*(yyvsp[0].char_string), "Hill Climbing");
   if (status_value  == RUNNER_NOT_FOUND)
     {
-      std::string s(*(yyvsp[(3) - (3)].char_string));
+      std::string s(*(yyvsp[0].char_string));
       s = "runner `" + s + "' not found error";
       yyerror(s.c_str());
       YYABORT;
     }
   else if (status_value == RUNNER_TYPE_MISMATCH)
     {
-      std::string s(*(yyvsp[(3) - (3)].char_string));
+      std::string s(*(yyvsp[0].char_string));
       s = "runner `" + s + "' type mismatch";
       yyerror(s.c_str());
       YYABORT;
     }
 }
+#line 1553 "ExpSpec.tab.c"
     break;
 
-  case 24:
-
-/* Line 1806 of yacc.c  */
-#line 190 "ExpSpec.y"
-    {
-  main_tester->SetRunningParameters(*(yyvsp[(3) - (6)].char_string), "Hill Climbing", *(yyvsp[(6) - (6)].par_box));
+  case 38: /* $@3: %empty  */
+#line 303 "ExpSpec.y"
+{
+  main_tester->SetRunningParameters(*(yyvsp[-3].char_string), "Hill Climbing", *(yyvsp[0].par_box));
 }
+#line 1561 "ExpSpec.tab.c"
     break;
 
-  case 26:
+  case 39: /* $@4: %empty  */
+#line 307 "ExpSpec.y"
+{
+  main_tester->SetRunnerTimeLimit(*(yyvsp[-5].char_string), (yyvsp[0].real));
+}
+#line 1569 "ExpSpec.tab.c"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 195 "ExpSpec.y"
-    {
+  case 41: /* $@5: %empty  */
+#line 312 "ExpSpec.y"
+{
   // add runner of type tabu search to the solver
-  int status_value = main_tester->AddRunnerToSolver(*(yyvsp[(3) - (3)].char_string), "Tabu Search");
+  int status_value = main_tester->AddRunnerToSolver(*(yyvsp[0].char_string), "Tabu Search");
   if (status_value  == RUNNER_NOT_FOUND)
     {
-      std::string s(*(yyvsp[(3) - (3)].char_string));
+      std::string s(*(yyvsp[0].char_string));
       s = "runner `" + s + "' not found error";
       yyerror(s.c_str());
       YYABORT;
     }
   else if (status_value == RUNNER_TYPE_MISMATCH)
     {
-      std::string s(*(yyvsp[(3) - (3)].char_string));
+      std::string s(*(yyvsp[0].char_string));
       s = "runner `" + s + "' type mismatch";
       yyerror(s.c_str());
       YYABORT;
     }
 }
+#line 1592 "ExpSpec.tab.c"
     break;
 
-  case 27:
+  case 42: /* $@6: %empty  */
+#line 332 "ExpSpec.y"
+{
+  main_tester->SetRunningParameters(*(yyvsp[-3].char_string), "Tabu Search", *(yyvsp[0].par_box));
+}
+#line 1600 "ExpSpec.tab.c"
+    break;
+
+  case 43: /* $@7: %empty  */
+#line 336 "ExpSpec.y"
+{
+  main_tester->SetRunnerTimeLimit(*(yyvsp[-5].char_string), (yyvsp[0].real));
+}
+#line 1608 "ExpSpec.tab.c"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 215 "ExpSpec.y"
+  case 45: /* $@8: %empty  */
+#line 341 "ExpSpec.y"
+{
+  // add runner of type simulated annealing to the solver
+  int status_value = main_tester->AddRunnerToSolver(*(yyvsp[0].char_string), "Simulated Annealing");
+  if (status_value  == RUNNER_NOT_FOUND)
+    {
+      std::string s(*(yyvsp[0].char_string));
+      s = "runner `" + s + "' not found error";
+      yyerror(s.c_str());
+      YYABORT;
+    }
+  else if (status_value == RUNNER_TYPE_MISMATCH)
     {
-  main_tester->SetRunningParameters(*(yyvsp[(3) - (6)].char_string), "Tabu Search", *(yyvsp[(6) - (6)].par_box));
+      std::string s(*(yyvsp[0].char_string));
+      s = "runner `" + s + "' type mismatch";
+      yyerror(s.c_str());
+      YYABORT;
+    }
+}
+#line 1631 "ExpSpec.tab.c"
+    break;
+
+  case 46: /* $@9: %empty  */
+#line 361 "ExpSpec.y"
+{
+  main_tester->SetRunningParameters(*(yyvsp[-3].char_string), "Simulated Annealing", *(yyvsp[0].par_box));
 }
+#line 1639 "ExpSpec.tab.c"
     break;
 
-  case 29:
+  case 47: /* $@10: %empty  */
+#line 365 "ExpSpec.y"
+{
+  main_tester->SetRunnerTimeLimit(*(yyvsp[-5].char_string), (yyvsp[0].real));
+}
+#line 1647 "ExpSpec.tab.c"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 220 "ExpSpec.y"
+  case 49: /* $@11: %empty  */
+#line 370 "ExpSpec.y"
+{
+  // add runner of type late acceptance hill climbing to the solver
+  int status_value = main_tester->AddRunnerToSolver(*(yyvsp[0].char_string), "Late Acceptance Hill Climbing");
+  if (status_value  == RUNNER_NOT_FOUND)
     {
-  // add runner of type simulated annealing to the solver
-  int status_value = main_tester->AddRunnerToSolver(*(yyvsp[(3) - (3)].char_string), "Simulated Annealing");
+      std::string s(*(yyvsp[0].char_string));
+      s = "runner `" + s + "' not found error";
+      yyerror(s.c_str());
+      YYABORT;
+    }
+  else if (status_value == RUNNER_TYPE_MISMATCH)
+    {
+      std::string s(*(yyvsp[0].char_string));
+      s = "runner `" + s + "' type mismatch";
+      yyerror(s.c_str());
+      YYABORT;
+    }
+}
+#line 1670 "ExpSpec.tab.c"
+    break;
+
+  case 50: /* $@12: %empty  */
+#line 390 "ExpSpec.y"
+{
+  main_tester->SetRunningParameters(*(yyvsp[-3].char_string), "Late Acceptance Hill Climbing", *(yyvsp[0].par_box));
+}
+#line 1678 "ExpSpec.tab.c"
+    break;
+
+  case 51: /* $@13: %empty  */
+#line 394 "ExpSpec.y"
+{
+  main_tester->SetRunnerTimeLimit(*(yyvsp[-5].char_string), (yyvsp[0].real));
+}
+#line 1686 "ExpSpec.tab.c"
+    break;
+
+  case 53: /* $@14: %empty  */
+#line 399 "ExpSpec.y"
+{
+  // add runner of type great deluge to the solver
+  int status_value = main_tester->AddRunnerToSolver(*(yyvsp[0].char_string), "Great Deluge");
   if (status_value  == RUNNER_NOT_FOUND)
     {
-      std::string s(*(yyvsp[(3) - (3)].char_string));
+      std::string s(*(yyvsp[0].char_string));
       s = "runner `" + s + "' not found error";
       yyerror(s.c_str());
       YYABORT;
     }
   else if (status_value == RUNNER_TYPE_MISMATCH)
     {
-      std::string s(*(yyvsp[(3) - (3)].char_string));
+      std::string s(*(yyvsp[0].char_string));
       s = "runner `" + s + "' type mismatch";
       yyerror(s.c_str());
       YYABORT;
     }
 }
+#line 1709 "ExpSpec.tab.c"
     break;
 
-  case 30:
+  case 54: /* $@15: %empty  */
+#line 419 "ExpSpec.y"
+{
+  main_tester->SetRunningParameters(*(yyvsp[-3].char_string), "Great Deluge", *(yyvsp[0].par_box));
+}
+#line 1717 "ExpSpec.tab.c"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 240 "ExpSpec.y"
+  case 55: /* $@16: %empty  */
+#line 423 "ExpSpec.y"
+{
+  main_tester->SetRunnerTimeLimit(*(yyvsp[-5].char_string), (yyvsp[0].real));
+}
+#line 1725 "ExpSpec.tab.c"
+    break;
+
+  case 57: /* $@17: %empty  */
+#line 428 "ExpSpec.y"
+{
+  // add runner of type parallel tempering to the solver
+  int status_value = main_tester->AddRunnerToSolver(*(yyvsp[0].char_string), "Parallel Tempering");
+  if (status_value  == RUNNER_NOT_FOUND)
     {
-  main_tester->SetRunningParameters(*(yyvsp[(3) - (6)].char_string), "Simulated Annealing", *(yyvsp[(6) - (6)].par_box));
+      std::string s(*(yyvsp[0].char_string));
+      s = "runner `" + s + "' not found error";
+      yyerror(s.c_str());
+      YYABORT;
+    }
+  else if (status_value == RUNNER_TYPE_MISMATCH)
+    {
+      std::string s(*(yyvsp[0].char_string));
+      s = "runner `" + s + "' type mismatch";
+      yyerror(s.c_str());
+      YYABORT;
+    }
 }
+#line 1748 "ExpSpec.tab.c"
+    break;
+
+  case 58: /* $@18: %empty  */
+#line 448 "ExpSpec.y"
+{
+  main_tester->SetRunningParameters(*(yyvsp[-3].char_string), "Parallel Tempering", *(yyvsp[0].par_box));
+}
+#line 1756 "ExpSpec.tab.c"
     break;
 
-  case 32:
+  case 59: /* $@19: %empty  */
+#line 452 "ExpSpec.y"
+{
+  main_tester->SetRunnerTimeLimit(*(yyvsp[-5].char_string), (yyvsp[0].real));
+}
+#line 1764 "ExpSpec.tab.c"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 247 "ExpSpec.y"
+  case 61: /* $@20: %empty  */
+#line 457 "ExpSpec.y"
+{
+  // add runner of type room matching to the solver
+  int status_value = main_tester->AddRunnerToSolver(*(yyvsp[0].char_string), "Room Matching");
+  if (status_value  == RUNNER_NOT_FOUND)
+    {
+      std::string s(*(yyvsp[0].char_string));
+      s = "runner `" + s + "' not found error";
+      yyerror(s.c_str());
+      YYABORT;
+    }
+  else if (status_value == RUNNER_TYPE_MISMATCH)
     {
+      std::string s(*(yyvsp[0].char_string));
+      s = "runner `" + s + "' type mismatch";
+      yyerror(s.c_str());
+      YYABORT;
+    }
+}
+#line 1787 "ExpSpec.tab.c"
+    break;
+
+  case 62: /* $@21: %empty  */
+#line 477 "ExpSpec.y"
+{
+  main_tester->SetRunningParameters(*(yyvsp[-3].char_string), "Room Matching", *(yyvsp[0].par_box));
+}
+#line 1795 "ExpSpec.tab.c"
+    break;
+
+  case 63: /* $@22: %empty  */
+#line 481 "ExpSpec.y"
+{
+  main_tester->SetRunnerTimeLimit(*(yyvsp[-5].char_string), (yyvsp[0].real));
+}
+#line 1803 "ExpSpec.tab.c"
+    break;
+
+  case 65: /* runner_time_limit: %empty  */
+#line 488 "ExpSpec.y"
+{
+  (yyval.real) = 0;
+}
+#line 1811 "ExpSpec.tab.c"
+    break;
+
+  case 66: /* runner_time_limit: "time limit" "duration" ";"  */
+#line 492 "ExpSpec.y"
+{
+  (yyval.real) = (yyvsp[-1].real);
+}
+#line 1819 "ExpSpec.tab.c"
+    break;
+
+  case 67: /* hc_parameters: "max idle iteration" "natural" ";"  */
+#line 498 "ExpSpec.y"
+{
   (yyval.par_box) = new ParameterBox;
-  (yyval.par_box)->Put("max idle iteration", (yyvsp[(2) - (3)].natural));  
+  (yyval.par_box)->Put("max idle iteration", (yyvsp[-1].natural));  
   (yyval.par_box)->Put("max iteration", ULONG_MAX);  
 }
+#line 1829 "ExpSpec.tab.c"
     break;
 
-  case 33:
+  case 68: /* hc_parameters: "max idle iteration" "natural" ";" "max iteration" "natural" ";"  */
+#line 505 "ExpSpec.y"
+{
+  (yyval.par_box) = new ParameterBox;
+  (yyval.par_box)->Put("max idle iteration", (yyvsp[-4].natural));
+  (yyval.par_box)->Put("max iteration", (yyvsp[-1].natural));  
+}
+#line 1839 "ExpSpec.tab.c"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 254 "ExpSpec.y"
-    {
+  case 69: /* ts_parameters: "min tabu tenure" "natural" ";" "max tabu tenure" "natural" ";" "max idle iteration" "natural" ";" ts_diversification  */
+#line 516 "ExpSpec.y"
+{
   (yyval.par_box) = new ParameterBox;
-  (yyval.par_box)->Put("max idle iteration", (yyvsp[(2) - (6)].natural));
-  (yyval.par_box)->Put("max iteration", (yyvsp[(5) - (6)].natural));  
+  (yyval.par_box)->Put("min tenure", (unsigned int)(yyvsp[-8].natural));
+  (yyval.par_box)->Put("max tenure", (unsigned int)(yyvsp[-5].natural));
+  (yyval.par_box)->Put("max idle iteration", (yyvsp[-2].natural));  
+  (yyval.par_box)->Put("max iteration", ULONG_MAX);  
+  (yyval.par_box)->Put("diversification", (yyvsp[0].natural));
 }
+#line 1852 "ExpSpec.tab.c"
     break;
 
-  case 34:
+  case 70: /* ts_parameters: "min tabu tenure" "natural" ";" "max tabu tenure" "natural" ";" "max idle iteration" "natural" ";" "max iteration" "natural" ";" ts_diversification  */
+#line 529 "ExpSpec.y"
+{
+  (yyval.par_box) = new ParameterBox;
+  (yyval.par_box)->Put("min tenure", (unsigned int)(yyvsp[-11].natural));
+  (yyval.par_box)->Put("max tenure", (unsigned int)(yyvsp[-8].natural));
+  (yyval.par_box)->Put("max idle iteration", (yyvsp[-5].natural));  
+  (yyval.par_box)->Put("max iteration", (yyvsp[-2].natural));
+  (yyval.par_box)->Put("diversification", (yyvsp[0].natural));
+}
+#line 1865 "ExpSpec.tab.c"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 264 "ExpSpec.y"
-    {
+  case 71: /* ts_diversification: %empty  */
+#line 542 "ExpSpec.y"
+{
+  (yyval.natural) = 0;
+}
+#line 1873 "ExpSpec.tab.c"
+    break;
+
+  case 72: /* ts_diversification: "diversification" "natural" ";"  */
+#line 546 "ExpSpec.y"
+{
+  (yyval.natural) = (yyvsp[-1].natural);
+}
+#line 1881 "ExpSpec.tab.c"
+    break;
+
+  case 73: /* sa_parameters: "start temperature" "real" ";" "cooling rate" "real" ";" "neighbors sampled" "natural" ";"  */
+#line 554 "ExpSpec.y"
+{
   (yyval.par_box) = new ParameterBox;
-  (yyval.par_box)->Put("min tenure", (unsigned int)(yyvsp[(2) - (9)].natural));
-  (yyval.par_box)->Put("max tenure", (unsigned int)(yyvsp[(5) - (9)].natural));
-  (yyval.par_box)->Put("max idle iteration", (yyvsp[(8) - (9)].natural));  
-  (yyval.par_box)->Put("max iteration", ULONG_MAX);  
+  (yyval.par_box)->Put("start temperature", (yyvsp[-7].real));
+  (yyval.par_box)->Put("cooling rate", (yyvsp[-4].real));
+  (yyval.par_box)->Put("neighbors sampled", (unsigned int)(yyvsp[-1].natural));
+  (yyval.par_box)->Put("max iteration", ULONG_MAX);
 }
+#line 1893 "ExpSpec.tab.c"
     break;
 
-  case 35:
+  case 74: /* sa_parameters: "start temperature" "real" ";" "cooling rate" "real" ";" "neighbors sampled" "natural" ";" "max iteration" "natural" ";"  */
+#line 565 "ExpSpec.y"
+{
+  (yyval.par_box) = new ParameterBox;
+  (yyval.par_box)->Put("start temperature", (yyvsp[-10].real));
+  (yyval.par_box)->Put("cooling rate", (yyvsp[-7].real));
+  (yyval.par_box)->Put("neighbors sampled", (unsigned int)(yyvsp[-4].natural));
+  (yyval.par_box)->Put("max iteration", (yyvsp[-1].natural));
+}
+#line 1905 "ExpSpec.tab.c"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 275 "ExpSpec.y"
-    {
+  case 75: /* la_parameters: "history length" "natural" ";" "max idle iteration" "natural" ";"  */
+#line 576 "ExpSpec.y"
+{
   (yyval.par_box) = new ParameterBox;
-  (yyval.par_box)->Put("min tenure", (unsigned int)(yyvsp[(2) - (12)].natural));
-  (yyval.par_box)->Put("max tenure", (unsigned int)(yyvsp[(5) - (12)].natural));
-  (yyval.par_box)->Put("max idle iteration", (yyvsp[(8) - (12)].natural));  
-  (yyval.par_box)->Put("max iteration", (yyvsp[(11) - (12)].natural));
+  (yyval.par_box)->Put("history length", (unsigned int)(yyvsp[-4].natural));
+  (yyval.par_box)->Put("max idle iteration", (yyvsp[-1].natural));
+  (yyval.par_box)->Put("max iteration", ULONG_MAX);
 }
+#line 1916 "ExpSpec.tab.c"
     break;
 
-  case 36:
+  case 76: /* la_parameters: "history length" "natural" ";" "max idle iteration" "natural" ";" "max iteration" "natural" ";"  */
+#line 585 "ExpSpec.y"
+{
+  (yyval.par_box) = new ParameterBox;
+  (yyval.par_box)->Put("history length", (unsigned int)(yyvsp[-7].natural));
+  (yyval.par_box)->Put("max idle iteration", (yyvsp[-4].natural));
+  (yyval.par_box)->Put("max iteration", (yyvsp[-1].natural));
+}
+#line 1927 "ExpSpec.tab.c"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 287 "ExpSpec.y"
-    {
+  case 77: /* gd_parameters: "level factor" "real" ";" "final level" "real" ";" "time budget" "duration" ";"  */
+#line 596 "ExpSpec.y"
+{
+  (yyval.par_box) = new ParameterBox;
+  (yyval.par_box)->Put("level factor", (yyvsp[-7].real));
+  (yyval.par_box)->Put("final level", (yyvsp[-4].real));
+  (yyval.par_box)->Put("time budget", (yyvsp[-1].real));
+  (yyval.par_box)->Put("max iteration", ULONG_MAX);
+}
+#line 1939 "ExpSpec.tab.c"
+    break;
+
+  case 78: /* gd_parameters: "level factor" "real" ";" "final level" "real" ";" "max iteration" "natural" ";"  */
+#line 606 "ExpSpec.y"
+{
+  (yyval.par_box) = new ParameterBox;
+  (yyval.par_box)->Put("level factor", (yyvsp[-7].real));
+  (yyval.par_box)->Put("final level", (yyvsp[-4].real));
+  (yyval.par_box)->Put("time budget", 0.0);
+  (yyval.par_box)->Put("max iteration", (yyvsp[-1].natural));
+}
+#line 1951 "ExpSpec.tab.c"
+    break;
+
+  case 79: /* pt_parameters: "replicas" "natural" ";" "min temperature" "real" ";" "max temperature" "real" ";" "exchange interval" "natural" ";" "max idle iteration" "natural" ";"  */
+#line 620 "ExpSpec.y"
+{
   (yyval.par_box) = new ParameterBox;
-  (yyval.par_box)->Put("start temperature", (yyvsp[(2) - (9)].real));
-  (yyval.par_box)->Put("cooling rate", (yyvsp[(5) - (9)].real));
-  (yyval.par_box)->Put("neighbors sampled", (unsigned int)(yyvsp[(8) - (9)].natural));
+  (yyval.par_box)->Put("replicas", (unsigned int)(yyvsp[-13].natural));
+  (yyval.par_box)->Put("min temperature", (yyvsp[-10].real));
+  (yyval.par_box)->Put("max temperature", (yyvsp[-7].real));
+  (yyval.par_box)->Put("exchange interval", (unsigned int)(yyvsp[-4].natural));
+  (yyval.par_box)->Put("max idle iteration", (yyvsp[-1].natural));
   (yyval.par_box)->Put("max iteration", ULONG_MAX);
 }
+#line 1965 "ExpSpec.tab.c"
     break;
 
-  case 37:
+  case 80: /* pt_parameters: "replicas" "natural" ";" "min temperature" "real" ";" "max temperature" "real" ";" "exchange interval" "natural" ";" "max idle iteration" "natural" ";" "max iteration" "natural" ";"  */
+#line 635 "ExpSpec.y"
+{
+  (yyval.par_box) = new ParameterBox;
+  (yyval.par_box)->Put("replicas", (unsigned int)(yyvsp[-16].natural));
+  (yyval.par_box)->Put("min temperature", (yyvsp[-13].real));
+  (yyval.par_box)->Put("max temperature", (yyvsp[-10].real));
+  (yyval.par_box)->Put("exchange interval", (unsigned int)(yyvsp[-7].natural));
+  (yyval.par_box)->Put("max idle iteration", (yyvsp[-4].natural));
+  (yyval.par_box)->Put("max iteration", (yyvsp[-1].natural));
+}
+#line 1979 "ExpSpec.tab.c"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 298 "ExpSpec.y"
-    {
+  case 81: /* rm_parameters: "threads" "natural" ";"  */
+#line 647 "ExpSpec.y"
+{
   (yyval.par_box) = new ParameterBox;
-  (yyval.par_box)->Put("start temperature", (yyvsp[(2) - (12)].real));
-  (yyval.par_box)->Put("cooling rate", (yyvsp[(5) - (12)].real));
-  (yyval.par_box)->Put("neighbors sampled", (unsigned int)(yyvsp[(8) - (12)].natural));
-  (yyval.par_box)->Put("max iteration", (yyvsp[(11) - (12)].natural));
+  (yyval.par_box)->Put("threads", (unsigned int)(yyvsp[-1].natural));
 }
+#line 1988 "ExpSpec.tab.c"
     break;
 
 
+#line 1992 "ExpSpec.tab.c"
 
-/* Line 1806 of yacc.c  */
-#line 1748 "ExpSpec.tab.c"
       default: break;
     }
   /* User semantic actions sometimes alter yychar, and that requires
@@ -1758,96 +2003,58 @@ yyreduce:
      case of YYERROR or YYBACKUP, subsequent parser actions might lead
      to an incorrect destructor call or verbose syntax error message
      before the lookahead is translated.  */
-  YY_SYMBOL_PRINT ("-> $$ =", yyr1[yyn], &yyval, &yyloc);
+  YY_SYMBOL_PRINT ("-> $$ =", YY_CAST (yysymbol_kind_t, yyr1[yyn]), &yyval, &yyloc);
 
   YYPOPSTACK (yylen);
   yylen = 0;
-  YY_STACK_PRINT (yyss, yyssp);
 
   *++yyvsp = yyval;
 
-  /* Now `shift' the result of the reduction.  Determine what state
+  /* Now 'shift' the result of the reduction.  Determine what state
      that goes to, based on the state we popped back to and the rule
      number reduced by.  */
-
-  yyn = yyr1[yyn];
-
-  yystate = yypgoto[yyn - YYNTOKENS] + *yyssp;
-  if (0 <= yystate && yystate <= YYLAST && yycheck[yystate] == *yyssp)
-    yystate = yytable[yystate];
-  else
-    yystate = yydefgoto[yyn - YYNTOKENS];
+  {
+    const int yylhs = yyr1[yyn] - YYNTOKENS;
+    const int yyi = yypgoto[yylhs] + *yyssp;
+    yystate = (0 <= yyi && yyi <= YYLAST && yycheck[yyi] == *yyssp
+               ? yytable[yyi]
+               : yydefgoto[yylhs]);
+  }
 
   goto yynewstate;
 
 
-/*------------------------------------.
-| yyerrlab -- here on detecting error |
-`------------------------------------*/
+/*--------------------------------------.
+| yyerrlab -- here on detecting error.  |
+`--------------------------------------*/
 yyerrlab:
   /* Make sure we have latest lookahead translation.  See comments at
      user semantic actions for why this is necessary.  */
-  yytoken = yychar == YYEMPTY ? YYEMPTY : YYTRANSLATE (yychar);
-
+  yytoken = yychar == YYEMPTY ? YYSYMBOL_YYEMPTY : YYTRANSLATE (yychar);
   /* If not already recovering from an error, report this error.  */
   if (!yyerrstatus)
     {
       ++yynerrs;
-#if ! YYERROR_VERBOSE
       yyerror (YY_("syntax error"));
-#else
-# define YYSYNTAX_ERROR yysyntax_error (&yymsg_alloc, &yymsg, \
-                                        yyssp, yytoken)
-      {
-        char const *yymsgp = YY_("syntax error");
-        int yysyntax_error_status;
-        yysyntax_error_status = YYSYNTAX_ERROR;
-        if (yysyntax_error_status == 0)
-          yymsgp = yymsg;
-        else if (yysyntax_error_status == 1)
-          {
-            if (yymsg != yymsgbuf)
-              YYSTACK_FREE (yymsg);
-            yymsg = (char *) YYSTACK_ALLOC (yymsg_alloc);
-            if (!yymsg)
-              {
-                yymsg = yymsgbuf;
-                yymsg_alloc = sizeof yymsgbuf;
-                yysyntax_error_status = 2;
-              }
-            else
-              {
-                yysyntax_error_status = YYSYNTAX_ERROR;
-                yymsgp = yymsg;
-              }
-          }
-        yyerror (yymsgp);
-        if (yysyntax_error_status == 2)
-          goto yyexhaustedlab;
-      }
-# undef YYSYNTAX_ERROR
-#endif
     }
 
-
-
   if (yyerrstatus == 3)
     {
       /* If just tried and failed to reuse lookahead token after an
-	 error, discard it.  */
+         error, discard it.  */
 
       if (yychar <= YYEOF)
-	{
-	  /* Return failure if at end of input.  */
-	  if (yychar == YYEOF)
-	    YYABORT;
-	}
+        {
+          /* Return failure if at end of input.  */
+          if (yychar == YYEOF)
+            YYABORT;
+        }
       else
-	{
-	  yydestruct ("Error: discarding",
-		      yytoken, &yylval);
-	  yychar = YYEMPTY;
-	}
+        {
+          yydestruct ("Error: discarding",
+                      yytoken, &yylval);
+          yychar = YYEMPTY;
+        }
     }
 
   /* Else will try to reuse lookahead token after shifting the error
@@ -1859,14 +2066,13 @@ yyerrlab:
 | yyerrorlab -- error raised explicitly by YYERROR.  |
 `---------------------------------------------------*/
 yyerrorlab:
+  /* Pacify compilers when the user code never invokes YYERROR and the
+     label yyerrorlab therefore never appears in user code.  */
+  if (0)
+    YYERROR;
+  ++yynerrs;
 
-  /* Pacify compilers like GCC when the user code never invokes
-     YYERROR and the label yyerrorlab therefore never appears in user
-     code.  */
-  if (/*CONSTCOND*/ 0)
-     goto yyerrorlab;
-
-  /* Do not reclaim the symbols of the rule which action triggered
+  /* Do not reclaim the symbols of the rule whose action triggered
      this YYERROR.  */
   YYPOPSTACK (yylen);
   yylen = 0;
@@ -1879,39 +2085,42 @@ yyerrorlab:
 | yyerrlab1 -- common code for both syntax error and YYERROR.  |
 `-------------------------------------------------------------*/
 yyerrlab1:
-  yyerrstatus = 3;	/* Each real token shifted decrements this.  */
+  yyerrstatus = 3;      /* Each real token shifted decrements this.  */
 
+  /* Pop stack until we find a state that shifts the error token.  */
   for (;;)
     {
       yyn = yypact[yystate];
       if (!yypact_value_is_default (yyn))
-	{
-	  yyn += YYTERROR;
-	  if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYTERROR)
-	    {
-	      yyn = yytable[yyn];
-	      if (0 < yyn)
-		break;
-	    }
-	}
+        {
+          yyn += YYSYMBOL_YYerror;
+          if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYSYMBOL_YYerror)
+            {
+              yyn = yytable[yyn];
+              if (0 < yyn)
+                break;
+            }
+        }
 
       /* Pop the current state because it cannot handle the error token.  */
       if (yyssp == yyss)
-	YYABORT;
+        YYABORT;
 
 
       yydestruct ("Error: popping",
-		  yystos[yystate], yyvsp);
+                  YY_ACCESSING_SYMBOL (yystate), yyvsp);
       YYPOPSTACK (1);
       yystate = *yyssp;
       YY_STACK_PRINT (yyss, yyssp);
     }
 
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
   *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
 
 
   /* Shift the error token.  */
-  YY_SYMBOL_PRINT ("Shifting", yystos[yyn], yyvsp, yylsp);
+  YY_SYMBOL_PRINT ("Shifting", YY_ACCESSING_SYMBOL (yyn), yyvsp, yylsp);
 
   yystate = yyn;
   goto yynewstate;
@@ -1922,26 +2131,30 @@ yyerrlab1:
 `-------------------------------------*/
 yyacceptlab:
   yyresult = 0;
-  goto yyreturn;
+  goto yyreturnlab;
+
 
 /*-----------------------------------.
 | yyabortlab -- YYABORT comes here.  |
 `-----------------------------------*/
 yyabortlab:
   yyresult = 1;
-  goto yyreturn;
+  goto yyreturnlab;
 
-#if !defined(yyoverflow) || YYERROR_VERBOSE
-/*-------------------------------------------------.
-| yyexhaustedlab -- memory exhaustion comes here.  |
-`-------------------------------------------------*/
+
+/*-----------------------------------------------------------.
+| yyexhaustedlab -- YYNOMEM (memory exhaustion) comes here.  |
+`-----------------------------------------------------------*/
 yyexhaustedlab:
   yyerror (YY_("memory exhausted"));
   yyresult = 2;
-  /* Fall through.  */
-#endif
+  goto yyreturnlab;
 
-yyreturn:
+
+/*----------------------------------------------------------.
+| yyreturnlab -- parsing is finished, clean up and return.  |
+`----------------------------------------------------------*/
+yyreturnlab:
   if (yychar != YYEMPTY)
     {
       /* Make sure we have latest lookahead translation.  See comments at
@@ -1950,31 +2163,23 @@ yyreturn:
       yydestruct ("Cleanup: discarding lookahead",
                   yytoken, &yylval);
     }
-  /* Do not reclaim the symbols of the rule which action triggered
+  /* Do not reclaim the symbols of the rule whose action triggered
      this YYABORT or YYACCEPT.  */
   YYPOPSTACK (yylen);
   YY_STACK_PRINT (yyss, yyssp);
   while (yyssp != yyss)
     {
       yydestruct ("Cleanup: popping",
-		  yystos[*yyssp], yyvsp);
+                  YY_ACCESSING_SYMBOL (+*yyssp), yyvsp);
       YYPOPSTACK (1);
     }
 #ifndef yyoverflow
   if (yyss != yyssa)
     YYSTACK_FREE (yyss);
 #endif
-#if YYERROR_VERBOSE
-  if (yymsg != yymsgbuf)
-    YYSTACK_FREE (yymsg);
-#endif
-  /* Make sure YYID is used.  */
-  return YYID (yyresult);
-}
-
 
+  return yyresult;
+}
 
-/* Line 2067 of yacc.c  */
-#line 307 "ExpSpec.y"
-
+#line 653 "ExpSpec.y"
 
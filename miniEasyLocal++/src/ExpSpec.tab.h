@@ -1,21 +1,22 @@
-/* A Bison parser, made by GNU Bison 2.5.  */
+/* A Bison parser, made by GNU Bison 3.8.2.  */
 
 /* Bison interface for Yacc-like parsers in C
-   
-      Copyright (C) 1984, 1989-1990, 2000-2011 Free Software Foundation, Inc.
-   
+
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
+
    This program is free software: you can redistribute it and/or modify
    it under the terms of the GNU General Public License as published by
    the Free Software Foundation, either version 3 of the License, or
    (at your option) any later version.
-   
+
    This program is distributed in the hope that it will be useful,
    but WITHOUT ANY WARRANTY; without even the implied warranty of
    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
    GNU General Public License for more details.
-   
+
    You should have received a copy of the GNU General Public License
-   along with this program.  If not, see <http://www.gnu.org/licenses/>.  */
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
 
 /* As a special exception, you may create a larger work that contains
    part or all of the Bison parser skeleton and distribute that work
@@ -26,50 +27,89 @@
    special exception, which will cause the skeleton and the resulting
    Bison output files to be licensed under the GNU General Public
    License without this special exception.
-   
+
    This special exception was added by the Free Software Foundation in
    version 2.2 of Bison.  */
 
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
+#ifndef YY_YY_EXPSPEC_TAB_H_INCLUDED
+# define YY_YY_EXPSPEC_TAB_H_INCLUDED
+/* Debug traces.  */
+#ifndef YYDEBUG
+# define YYDEBUG 0
+#endif
+#if YYDEBUG
+extern int yydebug;
+#endif
 
-/* Tokens.  */
+/* Token kinds.  */
 #ifndef YYTOKENTYPE
 # define YYTOKENTYPE
-   /* Put the tokens into the symbol table, so that GDB and other debuggers
-      know about them.  */
-   enum yytokentype {
-     INSTANCE = 258,
-     OUTPUT_PREFIX = 259,
-     LOG_FILE = 260,
-     PLOT_PREFIX = 261,
-     TRIALS = 262,
-     RUNNER = 263,
-     TABU_SEARCH = 264,
-     HILL_CLIMBING = 265,
-     SIMULATED_ANNEALING = 266,
-     MAX_ITERATION = 267,
-     MAX_IDLE_ITERATION = 268,
-     MIN_TABU_TENURE = 269,
-     MAX_TABU_TENURE = 270,
-     START_TEMPERATURE = 271,
-     COOLING_RATE = 272,
-     NEIGHBORS_SAMPLED = 273,
-     BBLOCK = 274,
-     EBLOCK = 275,
-     ESTMT = 276,
-     IDENTIFIER = 277,
-     STRING = 278,
-     NATURAL = 279,
-     REAL = 280
-   };
+  enum yytokentype
+  {
+    YYEMPTY = -2,
+    YYEOF = 0,                     /* "end of file"  */
+    YYerror = 256,                 /* error  */
+    YYUNDEF = 257,                 /* "invalid token"  */
+    INSTANCE = 258,                /* "Instance"  */
+    OUTPUT_PREFIX = 259,           /* "Output prefix"  */
+    LOG_FILE = 260,                /* "Log file"  */
+    PLOT_PREFIX = 261,             /* "Plot prefix"  */
+    TRIALS = 262,                  /* "Trials"  */
+    RUNNER = 263,                  /* "Runner"  */
+    TABU_SEARCH = 264,             /* "tabu search"  */
+    HILL_CLIMBING = 265,           /* "hill climbing"  */
+    SIMULATED_ANNEALING = 266,     /* "simulated annealing"  */
+    MAX_ITERATION = 267,           /* "max iteration"  */
+    MAX_IDLE_ITERATION = 268,      /* "max idle iteration"  */
+    MIN_TABU_TENURE = 269,         /* "min tabu tenure"  */
+    MAX_TABU_TENURE = 270,         /* "max tabu tenure"  */
+    DIVERSIFICATION = 271,         /* "diversification"  */
+    START_TEMPERATURE = 272,       /* "start temperature"  */
+    COOLING_RATE = 273,            /* "cooling rate"  */
+    NEIGHBORS_SAMPLED = 274,       /* "neighbors sampled"  */
+    LATE_ACCEPTANCE = 275,         /* "late acceptance"  */
+    HISTORY_LENGTH = 276,          /* "history length"  */
+    GREAT_DELUGE = 277,            /* "great deluge"  */
+    LEVEL_FACTOR = 278,            /* "level factor"  */
+    FINAL_LEVEL = 279,             /* "final level"  */
+    TIME_BUDGET = 280,             /* "time budget"  */
+    PARALLEL_TEMPERING = 281,      /* "parallel tempering"  */
+    REPLICAS = 282,                /* "replicas"  */
+    MIN_TEMPERATURE = 283,         /* "min temperature"  */
+    MAX_TEMPERATURE = 284,         /* "max temperature"  */
+    EXCHANGE_INTERVAL = 285,       /* "exchange interval"  */
+    ROOM_MATCHING = 286,           /* "room matching"  */
+    THREADS = 287,                 /* "threads"  */
+    SOLVER_TIME_LIMIT = 288,       /* "Time limit"  */
+    INITIAL_STATE = 289,           /* "Initial state"  */
+    WORKERS = 290,                 /* "Workers"  */
+    PROCESSES = 291,               /* "Processes"  */
+    SOLVER_KIND = 292,             /* "Solver"  */
+    DETERMINISTIC = 293,           /* "Deterministic"  */
+    RANDOM = 294,                  /* "random"  */
+    GREEDY = 295,                  /* "greedy"  */
+    TIME_LIMIT = 296,              /* "time limit"  */
+    BBLOCK = 297,                  /* "{"  */
+    EBLOCK = 298,                  /* "}"  */
+    ESTMT = 299,                   /* ";"  */
+    COMMA = 300,                   /* ","  */
+    IDENTIFIER = 301,              /* "identifier"  */
+    STRING = 302,                  /* "string"  */
+    NATURAL = 303,                 /* "natural"  */
+    REAL = 304,                    /* "real"  */
+    DURATION = 305                 /* "duration"  */
+  };
+  typedef enum yytokentype yytoken_kind_t;
 #endif
 
-
-
+/* Value type.  */
 #if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
-typedef union YYSTYPE
+union YYSTYPE
 {
-
-/* Line 2068 of yacc.c  */
 #line 54 "ExpSpec.y"
 
   std::string* char_string;
@@ -77,16 +117,19 @@ typedef union YYSTYPE
   double real;
   ParameterBox* par_box;
 
+#line 121 "ExpSpec.tab.h"
 
-
-/* Line 2068 of yacc.c  */
-#line 84 "ExpSpec.tab.h"
-} YYSTYPE;
+};
+typedef union YYSTYPE YYSTYPE;
 # define YYSTYPE_IS_TRIVIAL 1
-# define yystype YYSTYPE /* obsolescent; will be withdrawn */
 # define YYSTYPE_IS_DECLARED 1
 #endif
 
+
 extern YYSTYPE yylval;
 
 
+int yyparse (void);
+
+
+#endif /* !YY_YY_EXPSPEC_TAB_H_INCLUDED  */
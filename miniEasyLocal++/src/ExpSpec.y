@@ -71,20 +71,51 @@ struct ix_parbox {
 %token MAX_IDLE_ITERATION "max idle iteration"
 %token MIN_TABU_TENURE "min tabu tenure"
 %token MAX_TABU_TENURE "max tabu tenure"
+%token DIVERSIFICATION "diversification"
 %token START_TEMPERATURE "start temperature"
 %token COOLING_RATE "cooling rate"
 %token NEIGHBORS_SAMPLED   "neighbors sampled"
+%token LATE_ACCEPTANCE "late acceptance"
+%token HISTORY_LENGTH "history length"
+%token GREAT_DELUGE "great deluge"
+%token LEVEL_FACTOR "level factor"
+%token FINAL_LEVEL "final level"
+%token TIME_BUDGET "time budget"
+%token PARALLEL_TEMPERING "parallel tempering"
+%token REPLICAS "replicas"
+%token MIN_TEMPERATURE "min temperature"
+%token MAX_TEMPERATURE "max temperature"
+%token EXCHANGE_INTERVAL "exchange interval"
+%token ROOM_MATCHING "room matching"
+%token THREADS "threads"
+%token SOLVER_TIME_LIMIT "Time limit"
+%token INITIAL_STATE "Initial state"
+%token WORKERS "Workers"
+%token PROCESSES "Processes"
+%token SOLVER_KIND "Solver"
+%token DETERMINISTIC "Deterministic"
+%token RANDOM "random"
+%token GREEDY "greedy"
+%token TIME_LIMIT "time limit"
 %token BBLOCK "{"
 %token EBLOCK "}"
 %token ESTMT ";"
+%token COMMA ","
 %token <char_string> IDENTIFIER "identifier"
 %token <char_string> STRING "string"
 %token <natural> NATURAL "natural"
 %token <real> REAL "real"
+%token <real> DURATION "duration"
 
 %type <par_box> hc_parameters
 %type <par_box> ts_parameters
 %type <par_box> sa_parameters
+%type <par_box> la_parameters
+%type <par_box> gd_parameters
+%type <par_box> pt_parameters
+%type <par_box> rm_parameters
+%type <real> runner_time_limit
+%type <natural> ts_diversification
 
 %start instances
 
@@ -110,6 +141,12 @@ instance: 	INSTANCE STRING
 ;
 
 solver:          BBLOCK
+                   solver_kind
+                   solver_time_limit
+                   initial_state
+                   solver_workers
+                   solver_processes
+                   solver_deterministic
 				   other_parameters
                    runners
                  EBLOCK
@@ -162,7 +199,83 @@ plot_file_prefix: /* no plot */
 ;
 
 
-runners:   runner
+solver_kind: /* the token-ring solver */
+{
+  main_tester->SelectSolver("");
+}
+|          SOLVER_KIND STRING ESTMT /* a solver attached to the tester */
+{
+  if (main_tester->SelectSolver(*$2) == SOLVER_NOT_FOUND)
+    {
+      std::string s(*$2);
+      s = "solver `" + s + "' not found error";
+      delete $2;
+      yyerror(s.c_str());
+      YYABORT;
+    }
+  delete $2;
+}
+;
+
+solver_time_limit: /* no time limit */
+{
+  main_tester->SetSolverTimeLimit(0);
+}
+|          SOLVER_TIME_LIMIT DURATION ESTMT /* wall time of each trial */
+{
+  main_tester->SetSolverTimeLimit($2);
+}
+;
+
+initial_state: /* random initial states */
+{
+  main_tester->SetInitialState(RANDOM_INITIAL_STATE);
+}
+|          INITIAL_STATE RANDOM ESTMT
+{
+  main_tester->SetInitialState(RANDOM_INITIAL_STATE);
+}
+|          INITIAL_STATE GREEDY ESTMT /* constructive initial states */
+{
+  main_tester->SetInitialState(GREEDY_INITIAL_STATE);
+}
+;
+
+solver_workers: /* trials in the calling thread */
+{
+  main_tester->SetSolverWorkers(0);
+}
+|          WORKERS NATURAL ESTMT /* parallel multi-start trials */
+{
+  main_tester->SetSolverWorkers($2);
+}
+;
+
+solver_processes: /* trials in the calling process */
+{
+  main_tester->SetSolverProcesses(0);
+}
+|          PROCESSES NATURAL ESTMT /* trials on a process pool */
+{
+  main_tester->SetSolverProcesses($2);
+}
+;
+
+solver_deterministic: /* free-running trials */
+{
+  main_tester->SetSolverDeterministic(false);
+}
+|          DETERMINISTIC NATURAL ESTMT /* reproducible trials, with a seed */
+{
+  main_tester->SetSolverDeterministic(true, $2);
+}
+|          DETERMINISTIC NATURAL COMMA NATURAL ESTMT /* and a batch width */
+{
+  main_tester->SetSolverDeterministic(true, $2, $4);
+}
+;
+
+runners:   /* no runners, for the solvers that do not use them */
 |          runner runners
 ;
 
@@ -189,6 +302,10 @@ runner:    RUNNER HILL_CLIMBING STRING
              hc_parameters
 {
   main_tester->SetRunningParameters(*$3, "Hill Climbing", *$6);
+}
+             runner_time_limit
+{
+  main_tester->SetRunnerTimeLimit(*$3, $8);
 }
            EBLOCK
 |          RUNNER TABU_SEARCH STRING 
@@ -214,6 +331,10 @@ runner:    RUNNER HILL_CLIMBING STRING
              ts_parameters
 {
   main_tester->SetRunningParameters(*$3, "Tabu Search", *$6);
+}
+             runner_time_limit
+{
+  main_tester->SetRunnerTimeLimit(*$3, $8);
 }
            EBLOCK
 |          RUNNER SIMULATED_ANNEALING STRING 
@@ -239,10 +360,140 @@ runner:    RUNNER HILL_CLIMBING STRING
              sa_parameters
 {
   main_tester->SetRunningParameters(*$3, "Simulated Annealing", *$6);
+}
+             runner_time_limit
+{
+  main_tester->SetRunnerTimeLimit(*$3, $8);
+}
+           EBLOCK
+|          RUNNER LATE_ACCEPTANCE STRING 
+{
+  // add runner of type late acceptance hill climbing to the solver
+  int status_value = main_tester->AddRunnerToSolver(*$3, "Late Acceptance Hill Climbing");
+  if (status_value  == RUNNER_NOT_FOUND)
+    {
+      std::string s(*$3);
+      s = "runner `" + s + "' not found error";
+      yyerror(s.c_str());
+      YYABORT;
+    }
+  else if (status_value == RUNNER_TYPE_MISMATCH)
+    {
+      std::string s(*$3);
+      s = "runner `" + s + "' type mismatch";
+      yyerror(s.c_str());
+      YYABORT;
+    }
+}
+           BBLOCK
+             la_parameters
+{
+  main_tester->SetRunningParameters(*$3, "Late Acceptance Hill Climbing", *$6);
+}
+             runner_time_limit
+{
+  main_tester->SetRunnerTimeLimit(*$3, $8);
+}
+           EBLOCK
+|          RUNNER GREAT_DELUGE STRING 
+{
+  // add runner of type great deluge to the solver
+  int status_value = main_tester->AddRunnerToSolver(*$3, "Great Deluge");
+  if (status_value  == RUNNER_NOT_FOUND)
+    {
+      std::string s(*$3);
+      s = "runner `" + s + "' not found error";
+      yyerror(s.c_str());
+      YYABORT;
+    }
+  else if (status_value == RUNNER_TYPE_MISMATCH)
+    {
+      std::string s(*$3);
+      s = "runner `" + s + "' type mismatch";
+      yyerror(s.c_str());
+      YYABORT;
+    }
+}
+           BBLOCK
+             gd_parameters
+{
+  main_tester->SetRunningParameters(*$3, "Great Deluge", *$6);
+}
+             runner_time_limit
+{
+  main_tester->SetRunnerTimeLimit(*$3, $8);
+}
+           EBLOCK
+|          RUNNER PARALLEL_TEMPERING STRING 
+{
+  // add runner of type parallel tempering to the solver
+  int status_value = main_tester->AddRunnerToSolver(*$3, "Parallel Tempering");
+  if (status_value  == RUNNER_NOT_FOUND)
+    {
+      std::string s(*$3);
+      s = "runner `" + s + "' not found error";
+      yyerror(s.c_str());
+      YYABORT;
+    }
+  else if (status_value == RUNNER_TYPE_MISMATCH)
+    {
+      std::string s(*$3);
+      s = "runner `" + s + "' type mismatch";
+      yyerror(s.c_str());
+      YYABORT;
+    }
+}
+           BBLOCK
+             pt_parameters
+{
+  main_tester->SetRunningParameters(*$3, "Parallel Tempering", *$6);
+}
+             runner_time_limit
+{
+  main_tester->SetRunnerTimeLimit(*$3, $8);
+}
+           EBLOCK
+|          RUNNER ROOM_MATCHING STRING 
+{
+  // add runner of type room matching to the solver
+  int status_value = main_tester->AddRunnerToSolver(*$3, "Room Matching");
+  if (status_value  == RUNNER_NOT_FOUND)
+    {
+      std::string s(*$3);
+      s = "runner `" + s + "' not found error";
+      yyerror(s.c_str());
+      YYABORT;
+    }
+  else if (status_value == RUNNER_TYPE_MISMATCH)
+    {
+      std::string s(*$3);
+      s = "runner `" + s + "' type mismatch";
+      yyerror(s.c_str());
+      YYABORT;
+    }
+}
+           BBLOCK
+             rm_parameters
+{
+  main_tester->SetRunningParameters(*$3, "Room Matching", *$6);
+}
+             runner_time_limit
+{
+  main_tester->SetRunnerTimeLimit(*$3, $8);
 }
            EBLOCK
 ; /* remember to add other runner types */
 
+runner_time_limit: /* no time limit */
+{
+  $$ = 0;
+}
+|               TIME_LIMIT DURATION ESTMT
+{
+  $$ = $2;
+}
+;
+
 hc_parameters:  MAX_IDLE_ITERATION NATURAL ESTMT
 {
   $$ = new ParameterBox;
@@ -261,23 +512,39 @@ hc_parameters:  MAX_IDLE_ITERATION NATURAL ESTMT
 ts_parameters:  MIN_TABU_TENURE NATURAL ESTMT
                 MAX_TABU_TENURE NATURAL ESTMT
                 MAX_IDLE_ITERATION NATURAL ESTMT
+                ts_diversification
 {
   $$ = new ParameterBox;
   $$->Put("min tenure", (unsigned int)$2);
   $$->Put("max tenure", (unsigned int)$5);
   $$->Put("max idle iteration", $8);  
   $$->Put("max iteration", ULONG_MAX);  
+  $$->Put("diversification", $10);
 }
 |               MIN_TABU_TENURE NATURAL ESTMT
                 MAX_TABU_TENURE NATURAL ESTMT
                 MAX_IDLE_ITERATION NATURAL ESTMT
                 MAX_ITERATION NATURAL ESTMT
+                ts_diversification
 {
   $$ = new ParameterBox;
   $$->Put("min tenure", (unsigned int)$2);
   $$->Put("max tenure", (unsigned int)$5);
   $$->Put("max idle iteration", $8);  
   $$->Put("max iteration", $11);
+  $$->Put("diversification", $13);
+}
+;
+
+/* the long-term memory of the tabu search is used only on request */
+
+ts_diversification: /* no diversification */
+{
+  $$ = 0;
+}
+|               DIVERSIFICATION NATURAL ESTMT
+{
+  $$ = $2;
 }
 ;
 
@@ -304,4 +571,83 @@ sa_parameters:  START_TEMPERATURE REAL ESTMT
 }
 ;
 
+la_parameters:  HISTORY_LENGTH NATURAL ESTMT
+                MAX_IDLE_ITERATION NATURAL ESTMT
+{
+  $$ = new ParameterBox;
+  $$->Put("history length", (unsigned int)$2);
+  $$->Put("max idle iteration", $5);
+  $$->Put("max iteration", ULONG_MAX);
+}
+|               HISTORY_LENGTH NATURAL ESTMT
+                MAX_IDLE_ITERATION NATURAL ESTMT
+                MAX_ITERATION NATURAL ESTMT
+{
+  $$ = new ParameterBox;
+  $$->Put("history length", (unsigned int)$2);
+  $$->Put("max idle iteration", $5);
+  $$->Put("max iteration", $8);
+}
+;
+
+gd_parameters:  LEVEL_FACTOR REAL ESTMT
+                FINAL_LEVEL REAL ESTMT
+                TIME_BUDGET DURATION ESTMT
+{
+  $$ = new ParameterBox;
+  $$->Put("level factor", $2);
+  $$->Put("final level", $5);
+  $$->Put("time budget", $8);
+  $$->Put("max iteration", ULONG_MAX);
+}
+|               LEVEL_FACTOR REAL ESTMT
+                FINAL_LEVEL REAL ESTMT
+                MAX_ITERATION NATURAL ESTMT
+{
+  $$ = new ParameterBox;
+  $$->Put("level factor", $2);
+  $$->Put("final level", $5);
+  $$->Put("time budget", 0.0);
+  $$->Put("max iteration", $8);
+}
+;
+
+pt_parameters:  REPLICAS NATURAL ESTMT
+                MIN_TEMPERATURE REAL ESTMT
+                MAX_TEMPERATURE REAL ESTMT
+                EXCHANGE_INTERVAL NATURAL ESTMT
+                MAX_IDLE_ITERATION NATURAL ESTMT
+{
+  $$ = new ParameterBox;
+  $$->Put("replicas", (unsigned int)$2);
+  $$->Put("min temperature", $5);
+  $$->Put("max temperature", $8);
+  $$->Put("exchange interval", (unsigned int)$11);
+  $$->Put("max idle iteration", $14);
+  $$->Put("max iteration", ULONG_MAX);
+}
+|               REPLICAS NATURAL ESTMT
+                MIN_TEMPERATURE REAL ESTMT
+                MAX_TEMPERATURE REAL ESTMT
+                EXCHANGE_INTERVAL NATURAL ESTMT
+                MAX_IDLE_ITERATION NATURAL ESTMT
+                MAX_ITERATION NATURAL ESTMT
+{
+  $$ = new ParameterBox;
+  $$->Put("replicas", (unsigned int)$2);
+  $$->Put("min temperature", $5);
+  $$->Put("max temperature", $8);
+  $$->Put("exchange interval", (unsigned int)$11);
+  $$->Put("max idle iteration", $14);
+  $$->Put("max iteration", $17);
+}
+;
+
+rm_parameters:  THREADS NATURAL ESTMT
+{
+  $$ = new ParameterBox;
+  $$->Put("threads", (unsigned int)$2);
+}
+;
+
 %%
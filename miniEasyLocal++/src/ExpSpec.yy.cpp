@@ -385,8 +385,8 @@ static void yy_fatal_error (yyconst char msg[]  );
 	*yy_cp = '\0'; \
 	(yy_c_buf_p) = yy_cp;
 
-#define YY_NUM_RULES 33
-#define YY_END_OF_BUFFER 34
+#define YY_NUM_RULES 58
+#define YY_END_OF_BUFFER 59
 /* This struct is not used in this scanner,
    but its presence is necessary. */
 struct yy_trans_info
@@ -394,36 +394,71 @@ struct yy_trans_info
 	flex_int32_t yy_verify;
 	flex_int32_t yy_nxt;
 	};
-static yyconst flex_int16_t yy_accept[256] =
+static yyconst flex_int16_t yy_accept[524] =
     {   0,
-        0,    0,    0,    0,    0,    0,    2,    2,   34,   32,
-       30,   31,   29,   32,   32,   32,   26,   24,   28,   28,
-       23,   28,   28,   28,   28,   28,   11,   28,   28,   28,
-       28,   28,   28,   22,    2,    2,    2,    2,    3,    2,
-        2,    2,    2,    2,    2,    0,   27,    1,    0,   26,
-       28,   28,   28,   28,   28,   28,   28,   28,   28,   28,
-       28,   28,   28,   28,   28,   28,    2,    2,    3,    3,
-        4,    2,    2,    2,    2,    2,   25,   28,   28,   28,
-       28,   28,   28,   28,   28,   28,   28,   28,   28,   28,
-       28,    2,   28,    0,   28,   28,   28,   28,   28,   28,
-
-        0,    0,   28,   28,   28,   28,   28,    0,   28,    0,
-       28,   28,   28,    0,    0,    0,    0,   28,   28,   28,
-        0,   28,    0,   28,    0,   10,   28,   28,    0,    0,
-        0,    0,    0,   28,   28,    0,    0,   28,    0,    0,
-        0,    9,   28,    0,    0,    0,    0,    0,   28,   28,
-        0,    0,    5,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,   28,   28,    0,    0,    6,    0,    0,    0,
-        0,    0,    0,    0,    0,   28,   28,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    2,    2,   59,   57,
+       55,   56,   54,   57,   57,   57,   51,   48,   53,   53,
+       47,   16,   53,   53,   53,   53,   53,   53,   53,   53,
+       53,   53,   53,   20,   53,   53,   53,   53,   53,   53,
+       53,   53,   53,   53,   53,   53,   53,   46,    2,    2,
+
+        2,    2,    3,    2,    2,    2,    2,    2,    2,    0,
+       52,    1,    0,   51,    0,   50,   53,   53,   53,   53,
+       53,   53,   53,   53,   53,   53,   53,   53,   53,   53,
+       53,   53,   53,   53,   53,   53,   53,   53,   53,   53,
+       53,   53,   53,   53,   53,   53,   53,   53,   53,   53,
+
+       53,    2,    2,    3,    3,    4,    2,    2,    2,    2,
+        2,    2,    2,   49,    0,   50,   53,   53,   53,   53,
+       53,   53,   53,   53,   53,   53,   53,   53,   53,   53,
+       53,   53,   53,   53,   53,   53,   53,   53,   53,   53,
+       53,   53,   53,   53,   53,   53,   53,   53,   53,   53,
+
+        2,    2,    2,   50,   53,   53,   53,    0,   53,   53,
+       53,   53,   53,   53,   53,   53,   53,   53,   53,   53,
+       53,   53,   53,   53,   53,   53,   53,    0,    0,   53,
+       53,   53,   53,   53,   53,   53,   53,   53,    2,   53,
+       53,   53,    0,   53,    0,   53,   53,   53,    0,   53,
+
+       53,   53,   53,   53,   53,   53,   53,   53,    0,   53,
+        0,   53,    0,    0,    0,   53,   53,   53,    0,   53,
+       53,    0,   53,    0,   53,   53,   53,    0,   53,    0,
+       53,   19,   53,    0,   53,   53,   18,   17,   53,   53,
+       53,    0,    0,    0,   53,    0,    0,    0,    0,    0,
+
+        0,    0,    0,   53,   53,   53,    0,   53,    0,    0,
+       53,    0,    0,   53,   53,   53,    0,    0,    0,   53,
+       14,    0,    9,   53,   53,   53,   53,    0,    0,    0,
+       53,    0,    0,    0,    0,    0,    0,    0,    0,   53,
+       53,   53,    0,   53,    0,    0,   53,    0,    0,    5,
+
+       53,    0,    0,    0,    0,   53,    0,   12,    0,   53,
+       53,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,   53,   53,   53,    0,   53,    0,    0,
+       44,    0,    0,   53,    0,    6,    0,    0,   53,    0,
+        0,   53,    0,    0,    0,    0,    0,    0,    0,    0,
+
+        0,    0,    0,    0,    0,   53,    0,   40,    0,   53,
+        0,    0,    0,    0,   53,    0,    0,    0,   13,    0,
+        0,   53,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,   53,    0,    0,    0,   10,    0,   53,
+
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,   22,    0,
+       45,   53,    0,    0,    8,    0,   53,    0,   38,   25,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,   39,   53,    0,    0,   34,
+
+       53,    0,   21,    0,    0,   37,    0,    0,    0,    0,
+        0,    0,    0,    0,   27,    0,    0,   15,   11,    7,
+       53,    0,    0,    0,    0,   28,    0,    0,    0,    0,
+        0,    0,    0,    0,   53,    0,   36,   24,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,   32,    0,    0,
 
-        0,    0,   13,    0,    8,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,   20,   12,    0,    0,    0,
-        0,    0,    0,    0,    7,    0,   15,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,   17,
-       18,    0,    0,    0,    0,    0,    0,    0,    0,   21,
-        0,   19,   16,   14,    0
+       30,   42,   31,   41,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,   43,    0,   35,   26,    0,   33,
+       29,   23,    0
     } ;
 
 static yyconst flex_int32_t yy_ec[256] =
@@ -432,18 +467,20 @@ static yyconst flex_int32_t yy_ec[256] =
         1,    1,    4,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    5,    1,    6,    1,    1,    1,    1,    1,    1,
-        1,    7,    1,    1,    8,    9,   10,   11,   11,   11,
-       11,   11,   11,   11,   11,   11,   11,   12,   13,    1,
-        1,    1,    1,    1,   14,   14,   14,   14,   14,   14,
-       14,   14,   15,   14,   14,   16,   14,   14,   17,   18,
-       14,   19,   14,   20,   14,   14,   14,   14,   14,   14,
-        1,    1,    1,    1,   21,    1,   22,   23,   24,   25,
-
-       26,   27,   28,   29,   30,   14,   14,   31,   32,   33,
-       34,   35,   14,   36,   37,   38,   39,   14,   14,   40,
-       14,   14,   41,    1,   42,    1,    1,    1,    1,    1,
+        1,    7,    1,    8,    9,   10,   11,   12,   12,   12,
+
+       12,   12,   12,   12,   12,   12,   12,   13,   14,    1,
+        1,    1,    1,    1,   15,   15,   15,   16,   15,   15,
+       15,   15,   17,   15,   15,   18,   15,   15,   19,   20,
+       15,   21,   22,   23,   15,   15,   24,   15,   15,   15,
+        1,    1,    1,    1,   25,    1,   26,   27,   28,   29,
+
+       30,   31,   32,   33,   34,   15,   35,   36,   37,   38,
+       39,   40,   15,   41,   42,   43,   44,   45,   15,   46,
+       47,   15,   48,    1,   49,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
@@ -455,203 +492,415 @@ static yyconst flex_int32_t yy_ec[256] =
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+
         1,    1,    1,    1,    1
     } ;
 
-static yyconst flex_int32_t yy_meta[43] =
+static yyconst flex_int32_t yy_meta[50] =
     {   0,
-        1,    1,    2,    1,    1,    3,    4,    5,    1,    1,
-        5,    1,    1,    5,    5,    5,    5,    5,    5,    5,
-        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
-        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
-        1,    1
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1
     } ;
 
-static yyconst flex_int16_t yy_base[263] =
+static yyconst flex_int16_t yy_base[524] =
     {   0,
-        0,    0,   28,   56,   84,  112,  154,  196,  446,  447,
-      447,  447,  447,    0,  434,  437,   40,  447,  435,   44,
-      447,   45,   42,   47,   46,   48,  447,   49,   50,   60,
-       61,   56,   80,  447,    0,    0,    0,   53,   55,  431,
-      434,   52,    0,  238,    0,  434,  428,  447,  427,   80,
-      429,  428,   58,   84,   59,   85,   92,   88,   95,   93,
-       97,   98,  102,   96,  101,  107,    0,  127,  104,  128,
-      447,  424,  423,  131,  280,    0,  447,  131,  138,  112,
-      140,  143,  160,  162,  163,  169,  175,  144,  145,  177,
-      171,    0,  165,  406,  173,  181,  203,  183,  211,  210,
-
-      186,  394,  220,  214,  182,  218,  219,  401,  217,  395,
-      222,  184,  223,  405,  228,  406,  405,  246,  249,  227,
-      389,  251,  394,  228,  388,  415,  252,  255,  391,  390,
-      394,  396,  395,  253,  257,  379,  390,  265,  389,  379,
-      387,  447,  262,  382,  385,  374,  370,  369,  226,  268,
-      381,  384,  397,  392,  367,  375,  365,  368,  394,  376,
-      392,  391,  260,  288,  363,  358,  447,  367,  362,  369,
-      367,  359,  350,  349,  348,  269,  293,  350,  360,  356,
-      342,  343,  350,  341,  348,  351,  350,  338,  352,  347,
-      343,  341,  358,  343,  335,  341,  332,  332,  331,  341,
-
-      329,  325,  447,  320,  447,  347,  330,  321,  323,  316,
-      315,  321,  318,  327,  333,  447,  447,  322,  327,  300,
-      298,  295,  303,  282,  447,  281,  447,  292,  291,  285,
-      293,  275,  282,  299,  298,  283,  277,  271,  272,  447,
-      447,  280,  274,  277,  269,  288,  266,  266,  260,  447,
-      160,  447,  447,  447,  447,  322,  327,  102,  332,  337,
-      342,  347
+       51,  101,   94,  103,   91,  104,  140,  105,  106,  107,
+      109,  125,  130,  189,  124,  131,  229,  137,  258,  154,
+      139,  195,  210,  204,  205,  199,  209,  202,  208,  214,
+      212,  211,  223,  253,  215,  222,  213,  224,  216,  226,
+      235,  238,  232,  237,  276,  273,  284,  268,  318,  269,
+
+      308,  367,  416,  297,  304,  456,  312,  485,  313,  315,
+      430,  314,  325,  370,  435,  374,  419,  422,  428,  431,
+      437,  441,  432,  439,  440,  438,  444,  445,  447,  442,
+      454,  448,  446,  443,  459,  451,  460,  497,  449,  450,
+      453,  458,  457,  493,  495,  498,  499,  512,  513,  500,
+
+      505,  543,  538,  539,  545,  547,  511,  549,  551,  518,
+      554,  555,  556,  557,  520,  559,  519,  531,  521,  558,
+      525,  523,  540,  529,  524,  541,  544,  537,  546,  548,
+      542,  550,  552,  553,  560,  561,  530,  562,  563,  569,
+      570,  564,  565,  566,  567,  568,  572,  571,  573,  575,
+
+      581,  576,  582,  583,  574,  577,  585,  578,  579,  584,
+      580,  586,  587,  589,  588,  590,  592,  591,  593,  594,
+      596,  595,  597,  601,  598,  602,  600,  599,  603,  605,
+      607,  610,  606,  609,  604,  620,  608,  621,  628,  611,
+      613,  615,  614,  612,  616,  617,  619,  622,  618,  623,
+
+      625,  624,  627,  629,  626,  631,  634,  646,  630,  632,
+      635,  647,  633,  644,  649,  645,  641,  650,  643,  655,
+      648,  640,  654,  657,  658,  651,  652,  653,  682,  656,
+      659,  690,  678,  660,  679,  661,  695,  696,  666,  665,
+      668,  669,  673,  670,  662,  676,  677,  671,  680,  684,
+
+      675,  686,  681,  683,  685,  688,  691,  687,  689,  693,
+      674,  692,  694,  697,  699,  714,  701,  698,  703,  704,
+      720,  702,  721,  711,  724,  709,  705,  712,  713,  707,
+      739,  717,  700,  716,  706,  708,  710,  715,  718,  719,
+      725,  722,  723,  726,  727,  728,  735,  733,  730,  749,
+
+      729,  731,  738,  734,  737,  732,  736,  753,  740,  742,
+      750,  741,  743,  745,  744,  747,  755,  760,  746,  764,
+      748,  766,  754,  751,  780,  774,  761,  759,  757,  756,
+      790,  763,  758,  762,  765,  791,  768,  767,  783,  769,
+      773,  772,  771,  776,  770,  775,  777,  778,  779,  781,
+
+      782,  784,  785,  786,  787,  798,  788,  809,  797,  805,
+      792,  789,  793,  794,  795,  807,  803,  796,  811,  800,
+      801,  810,  802,  799,  813,  812,  814,  804,  815,  806,
+      816,  818,  817,  821,  827,  819,  825,  822,  831,  828,
+      808,  820,  826,  830,  823,  833,  846,  824,  832,  829,
+
+      834,  847,  835,  836,  837,  842,  838,  840,  839,  843,
+      841,  844,  845,  849,  848,  851,  852,  850,  871,  860,
+      876,  855,  856,  853,  880,  874,  858,  863,  894,  895,
+      864,  854,  862,  885,  861,  865,  857,  866,  867,  868,
+      869,  873,  872,  870,  879,  907,  896,  901,  902,  916,
+
+      878,  877,  919,  887,  893,  922,  897,  911,  884,  886,
+      888,  889,  891,  898,  926,  903,  892,  932,  934,  936,
+      899,  900,  925,  909,  904,  940,  912,  913,  914,  918,
+      905,  908,  920,  906,  938,  927,  952,  954,  921,  943,
+      944,  945,  946,  930,  928,  929,  923,  961,  931,  924,
+
+      966,  968,  969,  970,  942,  935,  941,  947,  959,  948,
+      963,  949,  950,  965,  974,  967,  979,  982,  951,  984,
+      985,  987,    1
     } ;
 
-static yyconst flex_int16_t yy_def[263] =
+static yyconst flex_int16_t yy_def[524] =
     {   0,
-      255,    1,    1,    1,    1,    1,  256,  256,  255,  255,
-      255,  255,  255,  257,  255,  255,  255,  255,  258,  258,
-      255,  258,  258,  258,  258,  258,  255,  258,  258,  258,
-      258,  258,  258,  255,  259,  259,  259,  260,  261,  259,
-      259,  259,  259,  262,  259,  257,  255,  255,  255,  255,
-      258,  258,  258,  258,  258,  258,  258,  258,  258,  258,
-      258,  258,  258,  258,  258,  258,  259,  260,  261,  261,
-      255,  259,  259,  259,  262,   75,  255,  258,  258,  258,
-      258,  258,  258,  258,  258,  258,  258,  258,  258,  258,
-      258,  259,  258,  255,  258,  258,  258,  258,  258,  258,
-
-      255,  255,  258,  258,  258,  258,  258,  255,  258,  255,
-      258,  258,  258,  255,  255,  255,  255,  258,  258,  258,
-      255,  258,  255,  258,  255,  258,  258,  258,  255,  255,
-      255,  255,  255,  258,  258,  255,  255,  258,  255,  255,
-      255,  255,  258,  255,  255,  255,  255,  255,  258,  258,
-      255,  255,  258,  255,  255,  255,  255,  255,  255,  255,
-      255,  255,  258,  258,  255,  255,  255,  255,  255,  255,
-      255,  255,  255,  255,  255,  258,  258,  255,  255,  255,
-      255,  255,  255,  255,  255,  255,  255,  255,  255,  255,
-      255,  255,  255,  255,  255,  255,  255,  255,  255,  255,
-
-      255,  255,  255,  255,  255,  255,  255,  255,  255,  255,
-      255,  255,  255,  255,  255,  255,  255,  255,  255,  255,
-      255,  255,  255,  255,  255,  255,  255,  255,  255,  255,
-      255,  255,  255,  255,  255,  255,  255,  255,  255,  255,
-      255,  255,  255,  255,  255,  255,  255,  255,  255,  255,
-      255,  255,  255,  255,    0,  255,  255,  255,  255,  255,
-      255,  255
+      523,    1,    1,    3,    1,    5,    1,    7,  523,  523,
+       10,   10,   10,   10,   10,   10,   10,   10,   10,   19,
+       10,   10,   19,   19,   19,   19,   19,   19,   19,   19,
+       19,   19,   19,   10,   19,   19,   19,   19,   19,   19,
+       19,   19,   19,   19,   19,   19,   19,   10,   10,   49,
+
+       49,   14,   10,   49,   49,   49,   49,   49,   49,   14,
+       15,   10,   15,   17,   10,   10,   19,   19,   19,   19,
+       19,   19,   19,   19,   19,   19,   19,   19,   19,   19,
+       19,   19,   19,   19,   19,   19,   19,   19,   19,   19,
+       19,   19,   19,   19,   19,   19,   19,   19,   19,   19,
+
+       19,   49,   52,   53,   53,   10,   54,   54,   56,   49,
+       49,   58,   58,   10,   10,   10,   19,   19,   19,   19,
+       19,   19,   19,   19,   19,   19,   19,   19,   19,   19,
+       19,   19,   19,   19,   19,   19,   19,   19,   19,   19,
+       19,   19,   19,   19,   19,   19,   19,   19,   19,   19,
+
+       49,   49,   49,   10,   19,   19,   19,   10,   19,   19,
+       19,   19,   19,   19,   19,   19,   19,   19,   19,   19,
+       19,   19,   19,   19,   19,   19,   19,   10,   10,   19,
+       19,   19,   19,   19,   19,   19,   19,   19,   49,   19,
+       19,   19,   10,   19,   10,   19,   19,   19,   10,   19,
+
+       19,   19,   19,   19,   19,   19,   19,   19,   10,   19,
+       10,   19,   10,   10,   10,   19,   19,   19,   10,   19,
+       19,   10,   19,   10,   19,   19,   19,   10,   19,   10,
+       19,   19,   19,   10,   19,   19,   19,   19,   19,   19,
+       19,   10,   10,   10,   19,   10,   10,   10,   10,   10,
+
+       10,   10,   10,   19,   19,   19,   10,   19,   10,   10,
+       19,   10,   10,   19,   19,   19,   10,   10,   10,   19,
+       10,   10,   10,   19,   19,   19,   19,   10,   10,   10,
+       19,   10,   10,   10,   10,   10,   10,   10,   10,   19,
+       19,   19,   10,   19,   10,   10,   19,   10,   10,   19,
+
+       19,   10,   10,   10,   10,   19,   10,   10,   10,   19,
+       19,   10,   10,   10,   10,   10,   10,   10,   10,   10,
+       10,   10,   10,   19,   19,   19,   10,   19,   10,   10,
+       10,   10,   10,   19,   10,   10,   10,   10,   19,   10,
+       10,   19,   10,   10,   10,   10,   10,   10,   10,   10,
+
+       10,   10,   10,   10,   10,   19,   10,   10,   10,   19,
+       10,   10,   10,   10,   19,   10,   10,   10,   10,   10,
+       10,   19,   10,   10,   10,   10,   10,   10,   10,   10,
+       10,   10,   10,   10,   10,   10,   10,   10,   10,   10,
+       10,   10,   10,   19,   10,   10,   10,   10,   10,   19,
+
+       10,   10,   10,   10,   10,   10,   10,   10,   10,   10,
+       10,   10,   10,   10,   10,   10,   10,   10,   10,   10,
+       10,   19,   10,   10,   10,   10,   19,   10,   10,   10,
+       10,   10,   10,   10,   10,   10,   10,   10,   10,   10,
+       10,   10,   10,   10,   10,   10,   19,   10,   10,   10,
+
+       19,   10,   10,   10,   10,   10,   10,   10,   10,   10,
+       10,   10,   10,   10,   10,   10,   10,   10,   10,   10,
+       19,   10,   10,   10,   10,   10,   10,   10,   10,   10,
+       10,   10,   10,   10,   19,   10,   10,   10,   10,   10,
+       10,   10,   10,   10,   10,   10,   10,   10,   10,   10,
+
+       10,   10,   10,   10,   10,   10,   10,   10,   10,   10,
+       10,   10,   10,   10,   10,   10,   10,   10,   10,   10,
+       10,   10,  523
     } ;
 
-static yyconst flex_int16_t yy_nxt[490] =
+static yyconst flex_int16_t yy_nxt[1037] =
     {   0,
-       10,   11,   12,   13,   13,   14,   10,   10,   15,   16,
-       17,   10,   18,   19,   20,   19,   19,   19,   19,   19,
-       10,   19,   19,   19,   19,   19,   19,   19,   19,   19,
+      523,  523,  523,  523,  523,  523,  523,  523,  523,  523,
+      523,  523,  523,  523,  523,  523,  523,  523,  523,  523,
+      523,  523,  523,  523,  523,  523,  523,  523,  523,  523,
+      523,  523,  523,  523,  523,  523,  523,  523,  523,  523,
+      523,  523,  523,  523,  523,  523,  523,  523,  523,  523,
+
+        9,   10,   11,   12,   13,   13,   14,   10,   10,   10,
+       15,   16,   17,   10,   18,   19,   19,   20,   19,   19,
+       19,   19,   19,   19,   19,   10,   19,   19,   19,   19,
        19,   19,   19,   19,   19,   19,   19,   19,   19,   19,
-       21,   10,   19,   22,   23,   24,   25,   26,   49,   51,
-       50,   51,   51,   51,   51,   51,   51,   51,   67,   46,
-       73,   70,   74,   51,   71,   51,   51,   51,   51,   27,
-       19,   22,   23,   24,   25,   26,   53,   56,   54,   60,
-       55,   61,   59,   58,   57,   64,   63,   51,   49,   62,
-       50,   51,   51,   65,   78,   51,   80,   27,   19,   51,
-
-       51,   66,   51,   51,   51,   51,   52,   28,   51,   51,
-      255,   79,   29,  255,   51,   30,   31,   83,   81,   51,
-       32,   33,   90,   85,   82,   34,   19,   89,   84,   91,
-       87,   88,   92,   46,   70,   28,   86,   71,   51,   73,
-       29,   74,   94,   30,   31,   51,   95,   51,   32,   33,
-       51,   51,   51,   34,   35,   36,   12,   37,   37,   38,
-       39,   35,   40,   41,   42,   35,   43,   51,   93,   51,
-       51,  103,   51,  101,   35,   97,   51,   96,   51,  102,
-       51,   98,   51,  104,   51,  110,  107,  254,   51,   51,
-       51,   51,   99,  100,   45,   35,   35,   36,   12,   37,
-
-       37,   38,   39,   35,   40,   41,   42,   35,   43,  106,
-       51,  109,  105,  112,  114,  115,   35,   51,   51,  120,
-      127,   51,  121,  116,   51,   51,   51,   51,  111,   51,
-       51,  136,  140,   51,   51,   51,   45,   35,   67,   67,
-      113,   67,   67,   67,  119,   75,   67,   67,  118,   67,
-       67,  122,  130,   51,  124,  128,   51,  126,   51,   51,
-       51,  163,   51,  142,   51,  131,  157,   51,  134,   51,
-      135,  253,   51,  188,  138,   51,   51,  252,   67,   67,
-       67,   67,  143,   67,   67,   67,  149,   75,   67,   67,
-      153,   67,   67,  164,  150,   51,  176,  189,  251,  250,
-
-       51,  249,  248,  247,  246,  245,  244,  243,  242,  241,
-      240,  239,  177,  238,  237,  236,  235,  234,  233,  232,
-       67,   67,   44,   44,   44,   44,   44,   46,  231,  230,
-       46,   46,   67,  229,   67,  228,   67,   68,  227,   68,
-       68,   68,   69,  226,  225,   69,   69,   76,  224,   76,
-      223,   76,  222,  221,  220,  219,  218,  217,  216,  215,
-      214,  213,  212,  211,  210,  209,  208,  207,  206,  205,
-      204,  203,  202,  201,  200,  199,  198,  197,  196,  195,
-      194,  193,  192,  191,  190,  187,  186,  185,  184,  183,
-      182,  181,  180,  179,  178,  175,  174,  173,  172,  171,
-
-      170,  169,  168,  167,   51,  166,  165,  162,  161,  160,
-      159,  158,  156,  155,  154,  152,  151,  148,  147,  146,
-      145,  144,   51,  141,  139,  137,  133,  132,  129,  125,
-      123,  117,  108,   72,   72,   51,   51,   47,   47,   77,
-       48,   72,   51,   48,   47,  255,    9,  255,  255,  255,
-      255,  255,  255,  255,  255,  255,  255,  255,  255,  255,
-      255,  255,  255,  255,  255,  255,  255,  255,  255,  255,
-      255,  255,  255,  255,  255,  255,  255,  255,  255,  255,
-      255,  255,  255,  255,  255,  255,  255,  255,  255
+       19,   19,   19,   19,   19,   19,   19,   19,   21,   10,
+
+        9,   22,    9,    9,    9,  523,    9,   19,    9,   23,
+       24,   25,   26,   27,   28,   29,   30,   31,   35,   36,
+       37,   38,   39,   40,    9,   32,   41,   42,   43,    9,
+       44,   45,   46,   47,   33,   61,    9,   62,    9,   48,
+       49,   50,   34,   51,   51,   52,   53,   49,   49,   54,
+
+       55,   56,   49,   57,   58,   58,   58,   58,   58,   58,
+       58,   58,   58,   58,   49,   58,   58,   58,   58,   58,
+       58,   58,   58,   58,   58,   58,   58,   58,   58,   58,
+       58,   58,   58,   58,   58,   58,   58,   59,   49,   60,
+       60,   69,   60,   60,    9,   60,   60,   60,   60,   60,
+
+       60,   60,   60,   60,   60,   60,   60,   60,   60,   60,
+       60,   60,   60,   60,   60,   60,   60,   60,   60,   60,
+       60,   60,   60,   60,   60,   60,   60,   60,   60,   60,
+       60,   60,   60,   60,   60,   60,   60,   60,   63,   70,
+       64,   71,   73,   72,   74,   76,   77,   78,   82,   75,
+
+       80,   81,    9,   83,   79,   84,   87,   86,   85,   88,
+       89,   93,   94,   91,   90,   65,   67,    9,    9,   68,
+       66,   92,   68,   68,   68,   68,   68,   68,   68,   68,
+       68,   68,   68,   68,   68,   68,   68,   68,   68,   68,
+       68,   68,   68,   68,   68,   68,   68,   68,   68,   68,
+
+       68,   68,   68,   68,   68,   95,   97,    9,  107,   99,
+       62,    9,    9,    9,   96,   98,  100,  101,  102,  102,
+      114,  102,  102,  102,    9,  102,  102,  102,  102,  102,
+      102,  102,  102,  102,  102,  102,  102,  102,  102,  102,
+      102,  102,  102,  102,  102,  102,  102,  102,  102,  102,
+
+      102,  102,  102,  102,  102,  102,  102,  102,  102,  102,
+      102,  102,  102,  102,  102,  102,  102,  103,  103,    9,
+      103,  103,  102,    9,  103,  103,  103,  103,  103,  103,
+      103,  103,  103,  103,  103,  103,  103,  103,  103,  103,
+      103,  103,  103,  103,  103,  103,  103,  103,  103,  103,
+
+      103,  103,  103,  103,  103,  103,  103,  103,  103,  103,
+      103,  103,  103,  103,  103,  103,  104,  104,    9,  104,
+      104,    9,  105,  104,  104,  104,  106,  104,  104,  104,
+      104,  104,  104,  104,  104,  104,  104,  104,  104,  104,
+      104,  104,  104,  104,  104,  104,  104,  104,  104,  104,
+
+      104,  104,  104,  104,  104,  104,  104,  104,  104,  104,
+      104,  104,  104,  104,  104,  108,   65,  109,  115,  117,
+      119,   66,  120,  118,  121,  124,  116,  122,  123,  125,
+      127,  126,  128,  129,  131,  130,  133,  132,  134,  135,
+      142,  138,  110,  112,  139,  141,  113,  111,  140,  113,
+
+      113,  113,  113,  113,  113,  113,  113,  113,  113,  113,
+      113,  113,  113,  113,  113,  113,  113,  113,  113,  113,
+      113,  113,  113,  113,  113,  113,  113,  113,  113,  113,
+      113,  113,  136,  143,  144,  146,  145,  147,  137,  148,
+      149,  150,    9,  151,    9,  523,    9,  110,    9,  523,
+
+        9,  152,  111,    9,    9,    9,    9,  154,    9,  153,
+      156,  155,  158,  157,  159,  160,  162,  161,  163,  165,
+      164,  166,  175,  178,  179,  167,  168,  169,  172,  170,
+        9,    9,    9,    0,  171,  173,    0,    0,  195,    0,
+      181,  176,  177,  199,    0,  180,  174,    0,    0,  190,
+
+        0,  182,  187,  183,  188,  209,  211,    0,  193,  196,
+      219,  184,  185,  189,  186,  197,  198,  191,  192,  201,
+      202,  206,  194,  200,  222,  224,  204,    9,    0,  203,
+      207,    0,  213,  223,  205,  212,  210,  216,  242,  208,
+      227,  214,  217,  218,  220,  215,  221,  228,  225,  226,
+
+      243,  247,  259,  234,  229,  230,    0,  244,  231,  232,
+      246,  248,  233,  238,  235,  236,  239,  240,  241,  250,
+      237,  254,  245,  251,  252,  249,  255,  256,  253,  257,
+      258,  260,  261,  262,  265,  264,  268,  266,  267,    9,
+      271,  273,  263,  272,    9,    9,  269,  275,  276,  277,
+
+      270,  279,  274,  282,  278,  280,  284,  283,  281,  285,
+      286,  287,  288,  292,  291,  297,  293,  289,  302,    9,
+        9,  290,  296,  308,    0,  317,  300,  299,  309,  294,
+      303,  295,  305,  306,  311,  298,  301,  304,  307,  310,
+      314,  312,  313,  315,  316,  318,  319,  331,    9,  321,
+
+      336,  320,    9,  330,  343,  328,  329,  323,  322,  324,
+      325,  332,  334,  326,  350,  327,  333,  338,  352,  340,
+      354,  351,  335,  339,  337,  342,  348,  353,  345,  347,
+      341,  346,  349,  355,  357,  344,  358,  360,  359,    9,
+        9,  364,  356,  361,  363,  369,  362,  367,  371,  372,
+
+      368,  376,  386,  365,  373,  374,  377,  366,    9,  389,
+        9,  370,  398,  375,  380,    0,  391,  378,    0,    0,
+        0,  379,  392,    9,  381,  383,  382,  385,  384,  388,
+      387,  390,  395,  396,  402,  400,  393,  394,  421,  401,
+      419,  397,  411,  399,  403,  404,  406,  410,  408,  409,
+
+      412,  405,  413,  407,  415,  416,  417,  418,  425,  429,
+      414,  426,  420,  422,  430,  423,  424,  433,  432,  435,
+        9,  427,  446,  431,  441,    9,  428,  436,  434,    9,
+      437,  439,  447,  438,  442,  448,  450,  440,  443,  444,
+      445,  451,  452,    9,    9,  453,  454,  456,  449,  455,
+
+      459,  457,  458,  465,  467,  463,    9,  466,  468,  460,
+      461,  462,  464,  469,  470,    9,  471,  472,    9,  473,
+      474,    9,  475,  476,  477,    9,  478,  482,  479,  480,
+      481,    9,  483,    9,  484,    9,  485,  487,  488,    9,
+      494,  490,  491,  492,  486,  496,  489,  493,  495,  497,
+
+      498,    9,  499,    9,  500,  501,  502,  503,  504,  505,
+        9,  506,  510,  508,  507,    9,  509,    9,    9,    9,
+      511,  515,  512,    9,  513,  517,  514,  520,    9,  521,
+      518,    9,  522,    9,    9,  516,    9,  519,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0
     } ;
 
-static yyconst flex_int16_t yy_chk[490] =
+static yyconst flex_int16_t yy_chk[1037] =
     {   0,
+      523,  523,  523,  523,  523,  523,  523,  523,  523,  523,
+      523,  523,  523,  523,  523,  523,  523,  523,  523,  523,
+      523,  523,  523,  523,  523,  523,  523,  523,  523,  523,
+      523,  523,  523,  523,  523,  523,  523,  523,  523,  523,
+      523,  523,  523,  523,  523,  523,  523,  523,  523,  523,
+
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    3,    3,    3,    3,    3,    3,   17,   23,
-       17,   20,   22,   25,   24,   26,   28,   29,   38,   38,
-       42,   39,   42,   32,   39,   53,   55,   30,   31,    3,
-        4,    4,    4,    4,    4,    4,   20,   24,   22,   29,
-       23,   30,   28,   26,   25,   32,   31,   33,   50,   30,
-       50,   54,   56,   32,   53,   58,   55,    4,    5,   57,
-
-       60,   33,   59,   64,   61,   62,  258,    5,   65,   63,
-       69,   54,    5,   69,   66,    5,    5,   58,   56,   80,
-        5,    5,   65,   60,   57,    5,    6,   64,   59,   66,
-       62,   63,   68,   68,   70,    6,   61,   70,   78,   74,
-        6,   74,   79,    6,    6,   79,   80,   81,    6,    6,
-       82,   88,   89,    6,    7,    7,    7,    7,    7,    7,
-        7,    7,    7,    7,    7,    7,    7,   83,   78,   84,
-       85,   88,   93,   86,    7,   82,   86,   81,   91,   87,
-       95,   83,   87,   89,   90,   96,   93,  251,   96,  105,
-       98,  112,   84,   85,    7,    7,    8,    8,    8,    8,
-
-        8,    8,    8,    8,    8,    8,    8,    8,    8,   91,
-       97,   95,   90,   98,  100,  101,    8,  100,   99,  105,
-      112,  104,  106,  101,  109,  106,  107,  103,   97,  111,
-      113,  120,  124,  149,  120,  124,    8,    8,   44,   44,
-       99,   44,   44,   44,  104,   44,   44,   44,  103,   44,
-       44,  107,  115,  118,  109,  113,  119,  111,  122,  127,
-      134,  149,  128,  127,  135,  115,  143,  163,  118,  143,
-      119,  249,  138,  176,  122,  150,  176,  248,   44,   44,
-       75,   75,  128,   75,   75,   75,  134,   75,   75,   75,
-      138,   75,   75,  150,  135,  164,  163,  177,  247,  246,
-
-      177,  245,  244,  243,  242,  239,  238,  237,  236,  235,
-      234,  233,  164,  232,  231,  230,  229,  228,  226,  224,
-       75,   75,  256,  256,  256,  256,  256,  257,  223,  222,
-      257,  257,  259,  221,  259,  220,  259,  260,  219,  260,
-      260,  260,  261,  218,  215,  261,  261,  262,  214,  262,
-      213,  262,  212,  211,  210,  209,  208,  207,  206,  204,
-      202,  201,  200,  199,  198,  197,  196,  195,  194,  193,
-      192,  191,  190,  189,  188,  187,  186,  185,  184,  183,
-      182,  181,  180,  179,  178,  175,  174,  173,  172,  171,
-      170,  169,  168,  166,  165,  162,  161,  160,  159,  158,
-
-      157,  156,  155,  154,  153,  152,  151,  148,  147,  146,
-      145,  144,  141,  140,  139,  137,  136,  133,  132,  131,
-      130,  129,  126,  125,  123,  121,  117,  116,  114,  110,
-      108,  102,   94,   73,   72,   52,   51,   49,   47,   46,
-       41,   40,   19,   16,   15,    9,  255,  255,  255,  255,
-      255,  255,  255,  255,  255,  255,  255,  255,  255,  255,
-      255,  255,  255,  255,  255,  255,  255,  255,  255,  255,
-      255,  255,  255,  255,  255,  255,  255,  255,  255,  255,
-      255,  255,  255,  255,  255,  255,  255,  255,  255
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+
+        2,    3,    4,    6,    8,    9,   10,    5,   11,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    5,    5,
+        5,    5,    5,    5,   12,    3,    5,    5,    5,   13,
+        5,    5,    5,    5,    3,   15,   18,   16,   21,    5,
+        7,    7,    3,    7,    7,    7,    7,    7,    7,    7,
+
+        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
+        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
+        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
+        7,    7,    7,    7,    7,    7,    7,    7,    7,   14,
+       14,   20,   14,   14,   22,   14,   14,   14,   14,   14,
+
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   17,   23,
+       17,   24,   26,   25,   27,   28,   29,   30,   33,   27,
+
+       31,   32,   34,   35,   30,   36,   39,   38,   37,   40,
+       41,   43,   44,   42,   41,   17,   19,   48,   50,   19,
+       17,   42,   19,   19,   19,   19,   19,   19,   19,   19,
+       19,   19,   19,   19,   19,   19,   19,   19,   19,   19,
+       19,   19,   19,   19,   19,   19,   19,   19,   19,   19,
+
+       19,   19,   19,   19,   19,   45,   46,   51,   54,   47,
+       55,   57,   59,   62,   45,   46,   47,   47,   49,   49,
+       60,   49,   49,   49,   63,   49,   49,   49,   49,   49,
+       49,   49,   49,   49,   49,   49,   49,   49,   49,   49,
+       49,   49,   49,   49,   49,   49,   49,   49,   49,   49,
+
+       49,   49,   49,   49,   49,   49,   49,   49,   49,   49,
+       49,   49,   49,   49,   49,   49,   49,   52,   52,   64,
+       52,   52,   52,   66,   52,   52,   52,   52,   52,   52,
+       52,   52,   52,   52,   52,   52,   52,   52,   52,   52,
+       52,   52,   52,   52,   52,   52,   52,   52,   52,   52,
+
+       52,   52,   52,   52,   52,   52,   52,   52,   52,   52,
+       52,   52,   52,   52,   52,   52,   53,   53,   67,   53,
+       53,   68,   53,   53,   53,   53,   53,   53,   53,   53,
+       53,   53,   53,   53,   53,   53,   53,   53,   53,   53,
+       53,   53,   53,   53,   53,   53,   53,   53,   53,   53,
+
+       53,   53,   53,   53,   53,   53,   53,   53,   53,   53,
+       53,   53,   53,   53,   53,   56,   61,   56,   65,   69,
+       71,   61,   72,   70,   73,   76,   65,   74,   75,   77,
+       79,   78,   80,   81,   83,   82,   85,   84,   86,   87,
+       93,   89,   56,   58,   90,   92,   58,   56,   91,   58,
+
+       58,   58,   58,   58,   58,   58,   58,   58,   58,   58,
+       58,   58,   58,   58,   58,   58,   58,   58,   58,   58,
+       58,   58,   58,   58,   58,   58,   58,   58,   58,   58,
+       58,   58,   88,   94,   95,   97,   96,   98,   88,   99,
+      100,  101,  102,  103,  105,  104,  106,  107,  108,  104,
+
+      109,  110,  107,  111,  112,  113,  114,  115,  116,  110,
+      118,  117,  120,  119,  121,  122,  124,  123,  125,  127,
+      126,  128,  137,  140,  141,  129,  130,  131,  134,  132,
+      151,  153,  154,    0,  133,  135,    0,    0,  160,    0,
+      143,  138,  139,  164,    0,  142,  136,    0,    0,  155,
+
+        0,  144,  149,  145,  150,  174,  176,    0,  158,  161,
+      183,  146,  147,  152,  148,  162,  163,  156,  157,  166,
+      167,  171,  159,  165,  186,  188,  169,  189,    0,  168,
+      172,    0,  178,  187,  170,  177,  175,  180,  207,  173,
+      192,  178,  181,  182,  184,  179,  185,  193,  190,  191,
+
+      208,  212,  221,  199,  194,  195,    0,  209,  196,  197,
+      211,  213,  198,  203,  200,  201,  204,  205,  206,  214,
+      202,  216,  210,  214,  215,  213,  217,  218,  215,  219,
+      220,  222,  223,  224,  226,  225,  229,  227,  228,  232,
+      233,  235,  224,  234,  237,  238,  230,  239,  240,  241,
+
+      231,  243,  236,  246,  242,  244,  248,  247,  245,  249,
+      250,  251,  252,  256,  255,  261,  257,  253,  266,  271,
+      273,  254,  260,  274,    0,  283,  264,  263,  275,  258,
+      267,  259,  269,  270,  277,  262,  265,  268,  272,  276,
+      280,  278,  279,  281,  282,  284,  285,  297,  300,  287,
+
+      303,  286,  308,  296,  311,  294,  295,  289,  288,  290,
+      291,  298,  301,  292,  318,  293,  299,  305,  320,  307,
+      322,  319,  302,  306,  304,  310,  316,  321,  313,  315,
+      309,  314,  317,  323,  325,  312,  326,  328,  327,  331,
+      336,  333,  324,  329,  332,  339,  330,  337,  341,  342,
+
+      338,  346,  356,  334,  343,  344,  347,  335,  358,  360,
+      369,  340,  370,  345,  350,    0,  362,  348,    0,    0,
+        0,  349,  363,  398,  351,  353,  352,  355,  354,  359,
+      357,  361,  366,  367,  374,  372,  364,  365,  393,  373,
+      391,  368,  383,  371,  375,  376,  378,  382,  380,  381,
+
+      384,  377,  385,  379,  387,  388,  389,  390,  397,  402,
+      386,  399,  392,  394,  403,  395,  396,  406,  405,  408,
+      419,  400,  420,  404,  414,  421,  401,  409,  407,  425,
+      410,  412,  422,  411,  415,  423,  426,  413,  416,  417,
+      418,  427,  428,  429,  430,  431,  432,  434,  424,  433,
+
+      437,  435,  436,  443,  445,  441,  446,  444,  447,  438,
+      439,  440,  442,  448,  449,  450,  451,  452,  453,  454,
+      455,  456,  457,  458,  459,  465,  460,  464,  461,  462,
+      463,  468,  466,  469,  467,  470,  471,  473,  474,  476,
+      481,  477,  478,  479,  472,  483,  475,  480,  482,  484,
+
+      485,  487,  486,  488,  489,  490,  491,  492,  493,  494,
+      498,  495,  500,  497,  496,  501,  499,  502,  503,  504,
+      505,  509,  506,  515,  507,  511,  508,  514,  517,  516,
+      512,  518,  519,  520,  521,  510,  522,  513,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0
     } ;
 
 /* Table of booleans, true if rule could match eol. */
-static yyconst flex_int32_t yy_rule_can_match_eol[34] =
+static yyconst flex_int32_t yy_rule_can_match_eol[59] =
     {   0,
 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0,     };
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0,     };
 
 static yy_state_type yy_last_accepting_state;
 static char *yy_last_accepting_cpos;
@@ -704,6 +953,7 @@ extern "C++" int yyparse(void);
 extern "C++" int yyerror(const char* s);
 
 char* trimdelims(const char*);
+double seconds(const char*);
 char* copy(const char*);
 
 unsigned int yycolno = 0; /* the column number */
@@ -717,7 +967,7 @@ char* foo;
 
 
 /* here we define some shortcuts for lexical categories */
-#line 721 "ExpSpec.yy.cpp"
+#line 971 "ExpSpec.yy.cpp"
 
 #define INITIAL 0
 #define instance 1
@@ -907,10 +1157,10 @@ YY_DECL
 	register char *yy_cp, *yy_bp;
 	register int yy_act;
     
-#line 72 "ExpSpec.lex"
+#line 74 "ExpSpec.lex"
 
 
-#line 914 "ExpSpec.yy.cpp"
+#line 1164 "ExpSpec.yy.cpp"
 
 	if ( !(yy_init) )
 		{
@@ -963,13 +1213,13 @@ yy_match:
 			while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 				{
 				yy_current_state = (int) yy_def[yy_current_state];
-				if ( yy_current_state >= 256 )
+				if ( yy_current_state >= 524 )
 					yy_c = yy_meta[(unsigned int) yy_c];
 				}
 			yy_current_state = yy_nxt[yy_base[yy_current_state] + (unsigned int) yy_c];
 			++yy_cp;
 			}
-		while ( yy_current_state != 255 );
+		while ( yy_current_state != 523 );
 		yy_cp = (yy_last_accepting_cpos);
 		yy_current_state = (yy_last_accepting_state);
 
@@ -1001,60 +1251,105 @@ do_action:	/* This label is used only to access EOF actions. */
 
 case 1:
 YY_RULE_SETUP
-#line 74 "ExpSpec.lex"
+#line 76 "ExpSpec.lex"
 comment_caller = YYSTATE;  BEGIN(comment); 
 	YY_BREAK
 
 case 2:
 YY_RULE_SETUP
-#line 76 "ExpSpec.lex"
+#line 78 "ExpSpec.lex"
 /* eat anything but a `*' */       
 	YY_BREAK
 case 3:
 YY_RULE_SETUP
-#line 77 "ExpSpec.lex"
+#line 79 "ExpSpec.lex"
 /* eat the `*' not followed by a `/' */
 	YY_BREAK
 case 4:
 YY_RULE_SETUP
-#line 78 "ExpSpec.lex"
+#line 80 "ExpSpec.lex"
 BEGIN(comment_caller); /* restart from last environment */
 	YY_BREAK
 
 case 5:
 YY_RULE_SETUP
-#line 81 "ExpSpec.lex"
+#line 83 "ExpSpec.lex"
 BEGIN(instance); return INSTANCE; 
 	YY_BREAK
 
 case 6:
 YY_RULE_SETUP
-#line 84 "ExpSpec.lex"
+#line 86 "ExpSpec.lex"
 return LOG_FILE;
 	YY_BREAK
 case 7:
 YY_RULE_SETUP
-#line 85 "ExpSpec.lex"
+#line 87 "ExpSpec.lex"
 return OUTPUT_PREFIX;
 	YY_BREAK
 case 8:
 YY_RULE_SETUP
-#line 86 "ExpSpec.lex"
+#line 88 "ExpSpec.lex"
 return PLOT_PREFIX;
 	YY_BREAK
 case 9:
 YY_RULE_SETUP
-#line 87 "ExpSpec.lex"
+#line 89 "ExpSpec.lex"
 return TRIALS;
 	YY_BREAK
 case 10:
 YY_RULE_SETUP
-#line 88 "ExpSpec.lex"
-BEGIN(runner); return RUNNER;
+#line 90 "ExpSpec.lex"
+return SOLVER_TIME_LIMIT;
 	YY_BREAK
 case 11:
 YY_RULE_SETUP
-#line 89 "ExpSpec.lex"
+#line 91 "ExpSpec.lex"
+return INITIAL_STATE;
+	YY_BREAK
+case 12:
+YY_RULE_SETUP
+#line 92 "ExpSpec.lex"
+return WORKERS;
+	YY_BREAK
+case 13:
+YY_RULE_SETUP
+#line 93 "ExpSpec.lex"
+return PROCESSES;
+	YY_BREAK
+case 14:
+YY_RULE_SETUP
+#line 94 "ExpSpec.lex"
+return SOLVER_KIND;
+	YY_BREAK
+case 15:
+YY_RULE_SETUP
+#line 95 "ExpSpec.lex"
+return DETERMINISTIC;
+	YY_BREAK
+case 16:
+YY_RULE_SETUP
+#line 96 "ExpSpec.lex"
+return COMMA;
+	YY_BREAK
+case 17:
+YY_RULE_SETUP
+#line 97 "ExpSpec.lex"
+return RANDOM;
+	YY_BREAK
+case 18:
+YY_RULE_SETUP
+#line 98 "ExpSpec.lex"
+return GREEDY;
+	YY_BREAK
+case 19:
+YY_RULE_SETUP
+#line 99 "ExpSpec.lex"
+BEGIN(runner); return RUNNER;
+	YY_BREAK
+case 20:
+YY_RULE_SETUP
+#line 100 "ExpSpec.lex"
 {  
                          /* end block, go back to the initial state */
                          BEGIN(INITIAL); return EBLOCK;
@@ -1062,121 +1357,201 @@ YY_RULE_SETUP
 	YY_BREAK
 
 
-case 12:
+case 21:
 YY_RULE_SETUP
-#line 96 "ExpSpec.lex"
+#line 107 "ExpSpec.lex"
 return HILL_CLIMBING;
 	YY_BREAK
-case 13:
+case 22:
 YY_RULE_SETUP
-#line 97 "ExpSpec.lex"
+#line 108 "ExpSpec.lex"
 return TABU_SEARCH;
 	YY_BREAK
-case 14:
+case 23:
 YY_RULE_SETUP
-#line 98 "ExpSpec.lex"
+#line 109 "ExpSpec.lex"
 return SIMULATED_ANNEALING;
 	YY_BREAK
-case 15:
+case 24:
 YY_RULE_SETUP
-#line 99 "ExpSpec.lex"
+#line 110 "ExpSpec.lex"
+return LATE_ACCEPTANCE;
+	YY_BREAK
+case 25:
+YY_RULE_SETUP
+#line 111 "ExpSpec.lex"
+return GREAT_DELUGE;
+	YY_BREAK
+case 26:
+YY_RULE_SETUP
+#line 112 "ExpSpec.lex"
+return PARALLEL_TEMPERING;
+	YY_BREAK
+case 27:
+YY_RULE_SETUP
+#line 113 "ExpSpec.lex"
+return ROOM_MATCHING;
+	YY_BREAK
+case 28:
+YY_RULE_SETUP
+#line 114 "ExpSpec.lex"
 return MAX_ITERATION;
 	YY_BREAK
-case 16:
+case 29:
 YY_RULE_SETUP
-#line 100 "ExpSpec.lex"
+#line 115 "ExpSpec.lex"
 return MAX_IDLE_ITERATION;
 	YY_BREAK
-case 17:
+case 30:
 YY_RULE_SETUP
-#line 101 "ExpSpec.lex"
+#line 116 "ExpSpec.lex"
 return MAX_TABU_TENURE;
 	YY_BREAK
-case 18:
+case 31:
 YY_RULE_SETUP
-#line 102 "ExpSpec.lex"
+#line 117 "ExpSpec.lex"
 return MIN_TABU_TENURE;
 	YY_BREAK
-case 19:
+case 32:
+YY_RULE_SETUP
+#line 118 "ExpSpec.lex"
+return DIVERSIFICATION;
+	YY_BREAK
+case 33:
 YY_RULE_SETUP
-#line 103 "ExpSpec.lex"
+#line 119 "ExpSpec.lex"
 return START_TEMPERATURE;
 	YY_BREAK
-case 20:
+case 34:
 YY_RULE_SETUP
-#line 104 "ExpSpec.lex"
+#line 120 "ExpSpec.lex"
 return COOLING_RATE; 
 	YY_BREAK
-case 21:
+case 35:
 YY_RULE_SETUP
-#line 105 "ExpSpec.lex"
+#line 121 "ExpSpec.lex"
 return NEIGHBORS_SAMPLED;
 	YY_BREAK
-case 22:
+case 36:
+YY_RULE_SETUP
+#line 122 "ExpSpec.lex"
+return HISTORY_LENGTH;
+	YY_BREAK
+case 37:
+YY_RULE_SETUP
+#line 123 "ExpSpec.lex"
+return LEVEL_FACTOR;
+	YY_BREAK
+case 38:
+YY_RULE_SETUP
+#line 124 "ExpSpec.lex"
+return FINAL_LEVEL;
+	YY_BREAK
+case 39:
+YY_RULE_SETUP
+#line 125 "ExpSpec.lex"
+return TIME_BUDGET;
+	YY_BREAK
+case 40:
+YY_RULE_SETUP
+#line 126 "ExpSpec.lex"
+return REPLICAS;
+	YY_BREAK
+case 41:
+YY_RULE_SETUP
+#line 127 "ExpSpec.lex"
+return MIN_TEMPERATURE;
+	YY_BREAK
+case 42:
+YY_RULE_SETUP
+#line 128 "ExpSpec.lex"
+return MAX_TEMPERATURE;
+	YY_BREAK
+case 43:
+YY_RULE_SETUP
+#line 129 "ExpSpec.lex"
+return EXCHANGE_INTERVAL;
+	YY_BREAK
+case 44:
 YY_RULE_SETUP
-#line 106 "ExpSpec.lex"
+#line 130 "ExpSpec.lex"
+return THREADS;
+	YY_BREAK
+case 45:
+YY_RULE_SETUP
+#line 131 "ExpSpec.lex"
+return TIME_LIMIT;
+	YY_BREAK
+case 46:
+YY_RULE_SETUP
+#line 132 "ExpSpec.lex"
 {
                          /* end block, go back to the previous state */ 
                          BEGIN(instance); return EBLOCK; 
                        }
 	YY_BREAK
 
-case 23:
+case 47:
 YY_RULE_SETUP
-#line 112 "ExpSpec.lex"
+#line 138 "ExpSpec.lex"
 return BBLOCK;  /* beginning block */
 	YY_BREAK
-case 24:
+case 48:
 YY_RULE_SETUP
-#line 113 "ExpSpec.lex"
+#line 139 "ExpSpec.lex"
 return ESTMT;   /* end of statement `;' */
 	YY_BREAK
-case 25:
+case 49:
 YY_RULE_SETUP
-#line 115 "ExpSpec.lex"
+#line 141 "ExpSpec.lex"
 yylval.char_string = new string(trimdelims(yytext)); return STRING;
 	YY_BREAK
-case 26:
+case 50:
 YY_RULE_SETUP
-#line 116 "ExpSpec.lex"
+#line 142 "ExpSpec.lex"
+yylval.real = seconds(yytext); return DURATION;
+	YY_BREAK
+case 51:
+YY_RULE_SETUP
+#line 143 "ExpSpec.lex"
 yylval.natural = strtoul(yytext,&foo,0); return NATURAL; 
 	YY_BREAK
-case 27:
+case 52:
 YY_RULE_SETUP
-#line 117 "ExpSpec.lex"
+#line 144 "ExpSpec.lex"
 yylval.real = strtod(yytext,&foo); return REAL;
 	YY_BREAK
-case 28:
+case 53:
 YY_RULE_SETUP
-#line 118 "ExpSpec.lex"
+#line 145 "ExpSpec.lex"
 yylval.char_string =  new string(yytext); return IDENTIFIER; 
 	YY_BREAK
-case 29:
+case 54:
 YY_RULE_SETUP
-#line 120 "ExpSpec.lex"
+#line 147 "ExpSpec.lex"
 /* skips the blanks and the carriage returns */
 	YY_BREAK
-case 30:
+case 55:
 YY_RULE_SETUP
-#line 121 "ExpSpec.lex"
+#line 148 "ExpSpec.lex"
 {
                          /* skips the tabs and update the column count */ 
                          yycolno += 7;                         
                        }
 	YY_BREAK
-case 31:
-/* rule 31 can match eol */
+case 56:
+/* rule 56 can match eol */
 YY_RULE_SETUP
-#line 125 "ExpSpec.lex"
+#line 152 "ExpSpec.lex"
 {
                          /* skipping the newline involves the update 
 						    of the column number */
                          yycolno = 0;
                        }
 	YY_BREAK
-case 32:
+case 57:
 YY_RULE_SETUP
-#line 132 "ExpSpec.lex"
+#line 159 "ExpSpec.lex"
 { /* overrules the default rule that echos all the 
 						    unmatched input raising a syntax error message 
 							as output */
@@ -1184,12 +1559,12 @@ YY_RULE_SETUP
 					     yyterminate();
                        }
 	YY_BREAK
-case 33:
+case 58:
 YY_RULE_SETUP
-#line 139 "ExpSpec.lex"
+#line 166 "ExpSpec.lex"
 ECHO;
 	YY_BREAK
-#line 1193 "ExpSpec.yy.cpp"
+#line 1568 "ExpSpec.yy.cpp"
 case YY_STATE_EOF(INITIAL):
 case YY_STATE_EOF(instance):
 case YY_STATE_EOF(runner):
@@ -1485,7 +1860,7 @@ static int yy_get_next_buffer (void)
 		while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 			{
 			yy_current_state = (int) yy_def[yy_current_state];
-			if ( yy_current_state >= 256 )
+			if ( yy_current_state >= 524 )
 				yy_c = yy_meta[(unsigned int) yy_c];
 			}
 		yy_current_state = yy_nxt[yy_base[yy_current_state] + (unsigned int) yy_c];
@@ -1513,11 +1888,11 @@ static int yy_get_next_buffer (void)
 	while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 		{
 		yy_current_state = (int) yy_def[yy_current_state];
-		if ( yy_current_state >= 256 )
+		if ( yy_current_state >= 524 )
 			yy_c = yy_meta[(unsigned int) yy_c];
 		}
 	yy_current_state = yy_nxt[yy_base[yy_current_state] + (unsigned int) yy_c];
-	yy_is_jam = (yy_current_state == 255);
+	yy_is_jam = (yy_current_state == 523);
 
 	return yy_is_jam ? 0 : yy_current_state;
 }
@@ -2199,7 +2574,7 @@ void yyfree (void * ptr )
 
 #define YYTABLES_NAME "yytables"
 
-#line 139 "ExpSpec.lex"
+#line 166 "ExpSpec.lex"
 
 
 
@@ -2212,6 +2587,17 @@ char* trimdelims(const char* t) {
   return s;
 }
 
+/* converts a duration (a number followed by s, ms or min) to seconds */
+double seconds(const char* t) {
+  char* unit;
+  double d = strtod(t,&unit);
+  if (strcmp(unit,"ms") == 0)
+    return d / 1000;
+  else if (strcmp(unit,"min") == 0)
+    return d * 60;
+  return d;
+}
+
 char* copy(const char* t) {
   int l = strlen(t);
   char* s = new char[l+1];